@@ -0,0 +1,93 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/async_ordering_service_persistent_state.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    constexpr std::chrono::seconds
+        AsyncOrderingServicePersistentState::kRetryDelay;
+
+    AsyncOrderingServicePersistentState::AsyncOrderingServicePersistentState(
+        std::shared_ptr<OrderingServicePersistentState> storage)
+        : storage_(std::move(storage)),
+          log_(logger::log("AsyncOrderingServicePersistentState")),
+          writer_([this] { this->run(); }) {}
+
+    bool AsyncOrderingServicePersistentState::saveProposalHeight(
+        size_t height) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      pending_ = height;
+      saved_ = height;
+      cv_.notify_one();
+      return true;
+    }
+
+    boost::optional<size_t>
+    AsyncOrderingServicePersistentState::loadProposalHeight() const {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (saved_) {
+          return saved_;
+        }
+      }
+      std::lock_guard<std::mutex> storage_lock(storage_mutex_);
+      return storage_->loadProposalHeight();
+    }
+
+    bool AsyncOrderingServicePersistentState::resetState() {
+      std::lock_guard<std::mutex> lock(mutex_);
+      pending_ = boost::none;
+      saved_ = boost::none;
+      // waits for the write in progress, so that it does not overwrite the
+      // reset state
+      std::lock_guard<std::mutex> storage_lock(storage_mutex_);
+      return storage_->resetState();
+    }
+
+    void AsyncOrderingServicePersistentState::run() {
+      std::unique_lock<std::mutex> lock(mutex_);
+      while (true) {
+        cv_.wait(lock, [this] { return stopped_ or pending_; });
+        if (not pending_) {
+          return;
+        }
+        auto height = *pending_;
+        pending_ = boost::none;
+        // storage is locked before the state is released, so that reset
+        // cannot happen between taking the height and writing it
+        std::unique_lock<std::mutex> storage_lock(storage_mutex_);
+        lock.unlock();
+        auto written = storage_->saveProposalHeight(height);
+        storage_lock.unlock();
+        lock.lock();
+
+        if (not written) {
+          log_->error("Cannot write proposal height {}", height);
+          if (stopped_) {
+            return;
+          }
+          // newer height makes this one obsolete
+          if (not pending_ and saved_ == height) {
+            pending_ = height;
+          }
+          cv_.wait_for(lock, kRetryDelay, [this] { return stopped_; });
+        }
+      }
+    }
+
+    AsyncOrderingServicePersistentState::
+        ~AsyncOrderingServicePersistentState() {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopped_ = true;
+      }
+      cv_.notify_one();
+      writer_.join();
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
@@ -0,0 +1,88 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_ASYNC_ORDERING_SERVICE_PERSISTENT_STATE_HPP
+#define IROHA_ASYNC_ORDERING_SERVICE_PERSISTENT_STATE_HPP
+
+#include "ametsuchi/ordering_service_persistent_state.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "logger/logger.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Decorator of OrderingServicePersistentState which writes proposal
+     * height in a separate thread, so that saving does not wait for the
+     * storage. Only the latest height is written if several are saved during
+     * a write. Heights which are saved, but not written yet, are written on
+     * destruction.
+     */
+    class AsyncOrderingServicePersistentState
+        : public OrderingServicePersistentState {
+     public:
+      /// delay before the failed write is repeated
+      static constexpr std::chrono::seconds kRetryDelay{1};
+
+      /**
+       * @param storage - storage to write heights to
+       */
+      explicit AsyncOrderingServicePersistentState(
+          std::shared_ptr<OrderingServicePersistentState> storage);
+
+      /**
+       * Schedule writing of the height
+       * @return true, errors of the write are logged and the write is
+       * repeated until a newer height is saved
+       */
+      bool saveProposalHeight(size_t height) override;
+
+      /**
+       * @return the latest saved height, even if it is not written yet
+       */
+      boost::optional<size_t> loadProposalHeight() const override;
+
+      /**
+       * Drop the height which is not written yet and reset the storage
+       */
+      bool resetState() override;
+
+      ~AsyncOrderingServicePersistentState() override;
+
+     private:
+      /**
+       * Body of the writing thread
+       */
+      void run();
+
+      std::shared_ptr<OrderingServicePersistentState> storage_;
+
+      /// guards state of the decorator, is taken before storage_mutex_
+      mutable std::mutex mutex_;
+      std::condition_variable cv_;
+      /// height to be written
+      boost::optional<size_t> pending_;
+      /// the latest saved height
+      boost::optional<size_t> saved_;
+      bool stopped_ = false;
+
+      /// serializes access to the storage
+      mutable std::mutex storage_mutex_;
+
+      logger::Logger log_;
+
+      std::thread writer_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_ASYNC_ORDERING_SERVICE_PERSISTENT_STATE_HPP
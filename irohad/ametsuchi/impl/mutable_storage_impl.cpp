@@ -31,30 +31,76 @@ namespace iroha {
   namespace ametsuchi {
     MutableStorageImpl::MutableStorageImpl(
         shared_model::interface::types::HashType top_hash,
-        std::unique_ptr<soci::session> sql,
-        std::shared_ptr<shared_model::interface::CommonObjectsFactory> factory)
+        std::shared_ptr<soci::session> sql,
+        std::shared_ptr<shared_model::interface::CommonObjectsFactory> factory,
+        boost::optional<shared_model::interface::types::HashType>
+            prepared_block_hash,
+        std::shared_ptr<WsvQuery> committed_wsv)
         : top_hash_(top_hash),
           sql_(std::move(sql)),
           wsv_(std::make_shared<PostgresWsvQuery>(*sql_, factory)),
           executor_(std::make_shared<PostgresWsvCommand>(*sql_)),
           block_index_(std::make_unique<PostgresBlockIndex>(*sql_)),
           command_executor_(std::make_shared<PostgresCommandExecutor>(*sql_)),
+          prepared_block_hash_(std::move(prepared_block_hash)),
+          committed_wsv_(std::move(committed_wsv)),
           committed(false),
           log_(logger::log("MutableStorage")) {
-      *sql_ << "BEGIN";
+      // transaction of the prepared block is open already
+      if (not prepared_block_hash_) {
+        *sql_ << "BEGIN";
+      }
     }
 
     bool MutableStorageImpl::check(
         const shared_model::interface::BlockVariant &block,
         MutableStorage::MutableStoragePredicateType<decltype(block)>
             predicate) {
-      return predicate(block, *wsv_, top_hash_);
+      // the session has changes of the prepared block, which is not applied
+      // yet
+      return predicate(
+          block, prepared_block_hash_ ? *committed_wsv_ : *wsv_, top_hash_);
+    }
+
+    boost::optional<bool> MutableStorageImpl::applyPrepared(
+        const shared_model::interface::Block &block,
+        const MutableStoragePredicateType<const shared_model::interface::Block &>
+            &function) {
+      if (not prepared_block_hash_) {
+        return boost::none;
+      }
+      auto prepared_block_hash = std::move(*prepared_block_hash_);
+      prepared_block_hash_ = boost::none;
+      if (prepared_block_hash != block.hash()) {
+        log_->info("Block {} is not prepared, executing it",
+                   block.hash().hex());
+        *sql_ << "ROLLBACK";
+        *sql_ << "BEGIN";
+        return boost::none;
+      }
+
+      // the session state is the one after the block, so the block is checked
+      // against the ledger, which is at the previous block
+      if (not function(block, *committed_wsv_, top_hash_)) {
+        *sql_ << "ROLLBACK";
+        *sql_ << "BEGIN";
+        return false;
+      }
+      log_->info("Applying prepared block {}", block.hash().hex());
+      block_store_.insert(std::make_pair(block.height(), clone(block)));
+      block_index_->index(block);
+      top_hash_ = block.hash();
+      return true;
     }
 
     bool MutableStorageImpl::apply(
         const shared_model::interface::Block &block,
         MutableStoragePredicateType<const shared_model::interface::Block &>
             function) {
+      if (auto result = applyPrepared(block, function)) {
+        return *result;
+      }
+
       auto execute_transaction = [this](auto &transaction) {
         command_executor_->setCreatorAccountId(transaction.creatorAccountId());
         auto execute_command = [this](auto &command) {
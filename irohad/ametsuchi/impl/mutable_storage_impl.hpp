@@ -19,6 +19,7 @@
 #define IROHA_MUTABLE_STORAGE_IMPL_HPP
 
 #include <soci/soci.h>
+#include <boost/optional.hpp>
 #include <map>
 
 #include "ametsuchi/mutable_storage.hpp"
@@ -37,10 +38,25 @@ namespace iroha {
       friend class StorageImpl;
 
      public:
-      MutableStorageImpl(shared_model::interface::types::HashType top_hash,
-                         std::unique_ptr<soci::session> sql,
-                         std::shared_ptr<shared_model::interface::CommonObjectsFactory>
-                         factory);
+      /**
+       * @param top_hash - hash of the top block of the ledger
+       * @param sql - session for the changes
+       * @param factory - factory of objects returned by queries
+       * @param prepared_block_hash - hash of the block, which transactions
+       * are already applied in the open transaction of the session. If this
+       * block is applied first, its transactions are not executed again,
+       * otherwise the session transaction is restarted
+       * @param committed_wsv - queries to the ledger state, which the
+       * prepared block is checked against, must be set if the block is given
+       */
+      MutableStorageImpl(
+          shared_model::interface::types::HashType top_hash,
+          std::shared_ptr<soci::session> sql,
+          std::shared_ptr<shared_model::interface::CommonObjectsFactory>
+              factory,
+          boost::optional<shared_model::interface::types::HashType>
+              prepared_block_hash = boost::none,
+          std::shared_ptr<WsvQuery> committed_wsv = nullptr);
       bool check(const shared_model::interface::BlockVariant &block,
                  MutableStoragePredicateType<decltype(block)> function) override;
 
@@ -51,18 +67,33 @@ namespace iroha {
       ~MutableStorageImpl() override;
 
      private:
+      /**
+       * Apply the prepared block, if it is given, without execution of its
+       * transactions
+       * @return boost::none if another block is given, otherwise the result
+       * of the predicate
+       */
+      boost::optional<bool> applyPrepared(
+          const shared_model::interface::Block &block,
+          const MutableStoragePredicateType<const shared_model::interface::Block &>
+              &function);
+
       shared_model::interface::types::HashType top_hash_;
       // ordered collection is used to enforce block insertion order in
       // StorageImpl::commit
       std::map<uint32_t, std::shared_ptr<shared_model::interface::Block>>
           block_store_;
 
-      std::unique_ptr<soci::session> sql_;
+      std::shared_ptr<soci::session> sql_;
       std::shared_ptr<WsvQuery> wsv_;
       std::shared_ptr<WsvCommand> executor_;
       std::unique_ptr<BlockIndex> block_index_;
       std::shared_ptr<CommandExecutor> command_executor_;
 
+      boost::optional<shared_model::interface::types::HashType>
+          prepared_block_hash_;
+      std::shared_ptr<WsvQuery> committed_wsv_;
+
       bool committed;
 
       logger::Logger log_;
@@ -0,0 +1,424 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/overlay_command_executor.hpp"
+
+#include <boost/format.hpp>
+
+#include "interfaces/commands/add_asset_quantity.hpp"
+#include "interfaces/commands/add_peer.hpp"
+#include "interfaces/commands/add_signatory.hpp"
+#include "interfaces/commands/append_role.hpp"
+#include "interfaces/commands/create_account.hpp"
+#include "interfaces/commands/create_asset.hpp"
+#include "interfaces/commands/create_domain.hpp"
+#include "interfaces/commands/create_role.hpp"
+#include "interfaces/commands/detach_role.hpp"
+#include "interfaces/commands/grant_permission.hpp"
+#include "interfaces/commands/remove_signatory.hpp"
+#include "interfaces/commands/revoke_permission.hpp"
+#include "interfaces/commands/set_account_detail.hpp"
+#include "interfaces/commands/set_quorum.hpp"
+#include "interfaces/commands/subtract_asset_quantity.hpp"
+#include "interfaces/commands/transfer_asset.hpp"
+#include "interfaces/common_objects/asset.hpp"
+#include "interfaces/common_objects/domain.hpp"
+#include "interfaces/common_objects/peer.hpp"
+
+namespace {
+  using Balance = iroha::ametsuchi::WsvOverlay::Balance;
+  using shared_model::interface::types::PrecisionType;
+
+  iroha::expected::Error<iroha::ametsuchi::CommandError> makeCommandError(
+      const std::string &error_message,
+      const std::string &command_name) noexcept {
+    return iroha::expected::makeError(
+        iroha::ametsuchi::CommandError{command_name, error_message});
+  }
+
+  boost::multiprecision::cpp_int pow10(PrecisionType precision) {
+    return boost::multiprecision::pow(boost::multiprecision::cpp_int(10),
+                                      precision);
+  }
+
+  Balance toBalance(const shared_model::interface::Amount &amount) {
+    return {boost::multiprecision::cpp_int(amount.intValue()),
+            amount.precision()};
+  }
+
+  /**
+   * @return balance with at least given precision
+   */
+  Balance rescale(const Balance &balance, PrecisionType precision) {
+    if (balance.precision >= precision) {
+      return balance;
+    }
+    return {balance.value * pow10(precision - balance.precision), precision};
+  }
+
+  /**
+   * Sum or difference with precision of the most precise operand, as
+   * Postgres computes decimals
+   */
+  Balance add(const Balance &lhs, const Balance &rhs) {
+    auto precision = std::max(lhs.precision, rhs.precision);
+    return {rescale(lhs, precision).value + rescale(rhs, precision).value,
+            precision};
+  }
+
+  Balance subtract(const Balance &lhs, const Balance &rhs) {
+    auto precision = std::max(lhs.precision, rhs.precision);
+    return {rescale(lhs, precision).value - rescale(rhs, precision).value,
+            precision};
+  }
+
+  /**
+   * @return true if the balance is less than 2 ^ (256 - precision)
+   */
+  bool isBelowLimit(const Balance &balance, PrecisionType precision) {
+    boost::multiprecision::cpp_int limit(1);
+    limit <<= 256 - precision;
+    return balance.value < limit * pow10(balance.precision);
+  }
+}  // namespace
+
+namespace iroha {
+  namespace ametsuchi {
+
+    OverlayCommandExecutor::OverlayCommandExecutor(
+        std::shared_ptr<WsvOverlay> overlay,
+        std::shared_ptr<shared_model::interface::CommonObjectsFactory> factory)
+        : overlay_(std::move(overlay)), factory_(std::move(factory)) {}
+
+    void OverlayCommandExecutor::setCreatorAccountId(
+        const shared_model::interface::types::AccountIdType
+            &creator_account_id) {
+      creator_account_id_ = creator_account_id;
+    }
+
+    CommandResult OverlayCommandExecutor::operator()(
+        const shared_model::interface::AddAssetQuantity &command) {
+      auto &account_id = creator_account_id_;
+      auto &asset_id = command.assetId();
+      auto precision = command.amount().precision();
+      if (not overlay_->getAccount(account_id)) {
+        return makeCommandError("Account does not exist", "AddAssetQuantity");
+      }
+      auto asset = overlay_->getAsset(asset_id);
+      if (not asset or (*asset)->precision() < precision) {
+        return makeCommandError("Asset with given precision does not exist",
+                                "AddAssetQuantity");
+      }
+      auto new_value =
+          add(overlay_->getBalance(account_id, asset_id).value_or(Balance{}),
+              toBalance(command.amount()));
+      if (not isBelowLimit(new_value, precision)) {
+        return makeCommandError("Summation overflows uint256",
+                                "AddAssetQuantity");
+      }
+      overlay_->setBalance(account_id, asset_id, std::move(new_value));
+      return {};
+    }
+
+    CommandResult OverlayCommandExecutor::operator()(
+        const shared_model::interface::AddPeer &command) {
+      auto &peer = command.peer();
+      auto peers = overlay_->getPeers();
+      auto duplicate = peers
+          and std::any_of(peers->begin(), peers->end(), [&peer](auto &p) {
+                return p->pubkey() == peer.pubkey()
+                    or p->address() == peer.address();
+              });
+      auto message_gen = [&] {
+        return (boost::format(
+                    "failed to insert peer, public key: '%s', address: '%s'")
+                % peer.pubkey().hex() % peer.address())
+            .str();
+      };
+      if (duplicate) {
+        return makeCommandError(message_gen(), "AddPeer");
+      }
+      return factory_->createPeer(peer.address(), peer.pubkey()).match(
+          [this](expected::Value<
+                 std::unique_ptr<shared_model::interface::Peer>> &v)
+              -> CommandResult {
+            overlay_->insertPeer(std::move(v.value));
+            return {};
+          },
+          [&message_gen](expected::Error<std::string> &e) -> CommandResult {
+            return makeCommandError(message_gen() + "\n" + e.error,
+                                    "AddPeer");
+          });
+    }
+
+    CommandResult OverlayCommandExecutor::operator()(
+        const shared_model::interface::AddSignatory &command) {
+      auto &account_id = command.accountId();
+      auto &pubkey = command.pubkey();
+      if (not overlay_->getAccount(account_id)
+          or overlay_->hasSignatory(account_id, pubkey)) {
+        return makeCommandError(
+            (boost::format("failed to insert account signatory, account id: "
+                           "'%s', signatory hex string: '%s")
+             % account_id % pubkey.hex())
+                .str(),
+            "AddSignatory");
+      }
+      overlay_->insertSignatory(account_id, pubkey);
+      return {};
+    }
+
+    CommandResult OverlayCommandExecutor::operator()(
+        const shared_model::interface::AppendRole &command) {
+      auto &account_id = command.accountId();
+      auto &role_name = command.roleName();
+      if (not overlay_->getAccount(account_id) or not overlay_->hasRole(role_name)
+          or overlay_->hasAccountRole(account_id, role_name)) {
+        return makeCommandError(
+            (boost::format("failed to insert account role, account: '%s', "
+                           "role name: '%s'")
+             % account_id % role_name)
+                .str(),
+            "AppendRole");
+      }
+      overlay_->insertAccountRole(account_id, role_name);
+      return {};
+    }
+
+    CommandResult OverlayCommandExecutor::operator()(
+        const shared_model::interface::CreateAccount &command) {
+      auto &domain_id = command.domainId();
+      auto &pubkey = command.pubkey();
+      std::string account_id = command.accountName() + "@" + domain_id;
+      auto domain = overlay_->getDomain(domain_id);
+      if (not domain or overlay_->getAccount(account_id)
+          or not overlay_->insertAccount(account_id, domain_id)) {
+        return makeCommandError((boost::format("failed to insert account, "
+                                               "account id: '%s', "
+                                               "domain id: '%s', "
+                                               "quorum: '1', "
+                                               "json_data: {}")
+                                 % account_id % domain_id)
+                                    .str(),
+                                "CreateAccount");
+      }
+      overlay_->insertSignatory(account_id, pubkey);
+      overlay_->insertAccountRole(account_id, (*domain)->defaultRole());
+      return {};
+    }
+
+    CommandResult OverlayCommandExecutor::operator()(
+        const shared_model::interface::CreateAsset &command) {
+      auto &domain_id = command.domainId();
+      auto asset_id = command.assetName() + "#" + domain_id;
+      auto precision = command.precision();
+      if (not overlay_->getDomain(domain_id) or overlay_->getAsset(asset_id)
+          or not overlay_->insertAsset(asset_id, domain_id, precision)) {
+        return makeCommandError(
+            (boost::format("failed to insert asset, asset id: '%s', "
+                           "domain id: '%s', precision: %d")
+             % asset_id % domain_id % precision)
+                .str(),
+            "CreateAsset");
+      }
+      return {};
+    }
+
+    CommandResult OverlayCommandExecutor::operator()(
+        const shared_model::interface::CreateDomain &command) {
+      auto &domain_id = command.domainId();
+      auto &default_role = command.userDefaultRole();
+      if (not overlay_->hasRole(default_role) or overlay_->getDomain(domain_id)
+          or not overlay_->insertDomain(domain_id, default_role)) {
+        return makeCommandError(
+            (boost::format("failed to insert domain, domain id: '%s', "
+                           "default role: '%s'")
+             % domain_id % default_role)
+                .str(),
+            "CreateDomain");
+      }
+      return {};
+    }
+
+    CommandResult OverlayCommandExecutor::operator()(
+        const shared_model::interface::CreateRole &command) {
+      auto &role_id = command.roleName();
+      if (overlay_->hasRole(role_id)) {
+        return makeCommandError(
+            (boost::format("failed to insert role: '%s'") % role_id).str(),
+            "CreateRole");
+      }
+      overlay_->insertRole(role_id, command.rolePermissions());
+      return {};
+    }
+
+    CommandResult OverlayCommandExecutor::operator()(
+        const shared_model::interface::DetachRole &command) {
+      overlay_->deleteAccountRole(command.accountId(), command.roleName());
+      return {};
+    }
+
+    CommandResult OverlayCommandExecutor::operator()(
+        const shared_model::interface::GrantPermission &command) {
+      auto &permittee_account_id = command.accountId();
+      auto &account_id = creator_account_id_;
+      auto permission = command.permissionName();
+      if (not overlay_->getAccount(permittee_account_id)
+          or not overlay_->getAccount(account_id)
+          or overlay_->hasAccountGrantablePermission(
+                 permittee_account_id, account_id, permission)) {
+        return makeCommandError(
+            (boost::format("failed to insert account grantable permission, "
+                           "permittee account id: '%s', "
+                           "account id: '%s'")
+             % permittee_account_id % account_id)
+                .str(),
+            "GrantPermission");
+      }
+      overlay_->setGrantablePermission(
+          permittee_account_id, account_id, permission, true);
+      return {};
+    }
+
+    CommandResult OverlayCommandExecutor::operator()(
+        const shared_model::interface::RemoveSignatory &command) {
+      auto &account_id = command.accountId();
+      auto &pubkey = command.pubkey();
+      if (not overlay_->hasSignatory(account_id, pubkey)) {
+        return makeCommandError(
+            (boost::format("failed to delete account signatory, account id: "
+                           "'%s', signatory hex string: '%s'")
+             % account_id % pubkey.hex())
+                .str(),
+            "RemoveSignatory");
+      }
+      overlay_->deleteSignatory(account_id, pubkey);
+      return {};
+    }
+
+    CommandResult OverlayCommandExecutor::operator()(
+        const shared_model::interface::RevokePermission &command) {
+      auto &permittee_account_id = command.accountId();
+      auto &account_id = creator_account_id_;
+      auto permission = command.permissionName();
+      if (not overlay_->hasAccountGrantablePermission(
+              permittee_account_id, account_id, permission)) {
+        return makeCommandError(
+            (boost::format("failed to delete account grantable permission, "
+                           "permittee account id: '%s', "
+                           "account id: '%s'")
+             % permittee_account_id % account_id)
+                .str(),
+            "RevokePermission");
+      }
+      overlay_->setGrantablePermission(
+          permittee_account_id, account_id, permission, false);
+      return {};
+    }
+
+    CommandResult OverlayCommandExecutor::operator()(
+        const shared_model::interface::SetAccountDetail &command) {
+      auto &account_id = command.accountId();
+      auto &key = command.key();
+      auto &value = command.value();
+      if (creator_account_id_.empty()) {
+        // When creator is not known, it is genesis block
+        creator_account_id_ = "genesis";
+      }
+      if (not overlay_->setAccountDetail(
+              account_id, creator_account_id_, key, value)) {
+        return makeCommandError(
+            (boost::format(
+                 "failed to set account key-value, account id: '%s', "
+                 "creator account id: '%s',\n key: '%s', value: '%s'")
+             % account_id % creator_account_id_ % key % value)
+                .str(),
+            "SetAccountDetail");
+      }
+      return {};
+    }
+
+    CommandResult OverlayCommandExecutor::operator()(
+        const shared_model::interface::SetQuorum &command) {
+      auto &account_id = command.accountId();
+      auto quorum = command.newQuorum();
+      if (not overlay_->setQuorum(account_id, quorum)) {
+        return makeCommandError(
+            (boost::format(
+                 "failed to update account, account id: '%s', quorum: '%s'")
+             % account_id % quorum)
+                .str(),
+            "SetQuorum");
+      }
+      return {};
+    }
+
+    CommandResult OverlayCommandExecutor::operator()(
+        const shared_model::interface::SubtractAssetQuantity &command) {
+      auto &account_id = creator_account_id_;
+      auto &asset_id = command.assetId();
+      auto precision = command.amount().precision();
+      if (not overlay_->getAccount(account_id)) {
+        return makeCommandError("Account does not exist with given precision",
+                                "SubtractAssetQuantity");
+      }
+      auto asset = overlay_->getAsset(asset_id);
+      if (not asset or (*asset)->precision() < precision) {
+        return makeCommandError("Asset with given precision does not exist",
+                                "SubtractAssetQuantity");
+      }
+      auto new_value = subtract(
+          overlay_->getBalance(account_id, asset_id).value_or(Balance{}),
+          toBalance(command.amount()));
+      if (new_value.value < 0) {
+        return makeCommandError("Subtracts overdrafts account asset",
+                                "SubtractAssetQuantity");
+      }
+      overlay_->setBalance(account_id, asset_id, std::move(new_value));
+      return {};
+    }
+
+    CommandResult OverlayCommandExecutor::operator()(
+        const shared_model::interface::TransferAsset &command) {
+      auto &src_account_id = command.srcAccountId();
+      auto &dest_account_id = command.destAccountId();
+      auto &asset_id = command.assetId();
+      auto precision = command.amount().precision();
+      if (not overlay_->getAccount(dest_account_id)) {
+        return makeCommandError("Destination account does not exist",
+                                "TransferAsset");
+      }
+      if (not overlay_->getAccount(src_account_id)) {
+        return makeCommandError("Source account does not exist",
+                                "TransferAsset");
+      }
+      auto asset = overlay_->getAsset(asset_id);
+      if (not asset or (*asset)->precision() < precision) {
+        return makeCommandError("Asset with given precision does not exist",
+                                "TransferAsset");
+      }
+      auto amount = toBalance(command.amount());
+      auto new_src_value = subtract(
+          overlay_->getBalance(src_account_id, asset_id).value_or(Balance{}),
+          amount);
+      if (new_src_value.value < 0) {
+        return makeCommandError("Transfer overdrafts source account asset",
+                                "TransferAsset");
+      }
+      auto new_dest_value = add(
+          overlay_->getBalance(dest_account_id, asset_id).value_or(Balance{}),
+          amount);
+      if (not isBelowLimit(new_dest_value, precision)) {
+        return makeCommandError("Transfer overflows destanation account asset",
+                                "TransferAsset");
+      }
+      overlay_->setBalance(src_account_id, asset_id, std::move(new_src_value));
+      overlay_->setBalance(
+          dest_account_id, asset_id, std::move(new_dest_value));
+      return {};
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
@@ -0,0 +1,88 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_OVERLAY_COMMAND_EXECUTOR_HPP
+#define IROHA_OVERLAY_COMMAND_EXECUTOR_HPP
+
+#include "ametsuchi/command_executor.hpp"
+#include "ametsuchi/impl/wsv_overlay.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Executes commands on in-memory world state view. Results and error
+     * messages are the same as of Postgres command executor
+     */
+    class OverlayCommandExecutor : public CommandExecutor {
+     public:
+      OverlayCommandExecutor(
+          std::shared_ptr<WsvOverlay> overlay,
+          std::shared_ptr<shared_model::interface::CommonObjectsFactory>
+              factory);
+
+      void setCreatorAccountId(
+          const shared_model::interface::types::AccountIdType
+              &creator_account_id) override;
+
+      CommandResult operator()(
+          const shared_model::interface::AddAssetQuantity &command) override;
+
+      CommandResult operator()(
+          const shared_model::interface::AddPeer &command) override;
+
+      CommandResult operator()(
+          const shared_model::interface::AddSignatory &command) override;
+
+      CommandResult operator()(
+          const shared_model::interface::AppendRole &command) override;
+
+      CommandResult operator()(
+          const shared_model::interface::CreateAccount &command) override;
+
+      CommandResult operator()(
+          const shared_model::interface::CreateAsset &command) override;
+
+      CommandResult operator()(
+          const shared_model::interface::CreateDomain &command) override;
+
+      CommandResult operator()(
+          const shared_model::interface::CreateRole &command) override;
+
+      CommandResult operator()(
+          const shared_model::interface::DetachRole &command) override;
+
+      CommandResult operator()(
+          const shared_model::interface::GrantPermission &command) override;
+
+      CommandResult operator()(
+          const shared_model::interface::RemoveSignatory &command) override;
+
+      CommandResult operator()(
+          const shared_model::interface::RevokePermission &command) override;
+
+      CommandResult operator()(
+          const shared_model::interface::SetAccountDetail &command) override;
+
+      CommandResult operator()(
+          const shared_model::interface::SetQuorum &command) override;
+
+      CommandResult operator()(
+          const shared_model::interface::SubtractAssetQuantity &command)
+          override;
+
+      CommandResult operator()(
+          const shared_model::interface::TransferAsset &command) override;
+
+     private:
+      std::shared_ptr<WsvOverlay> overlay_;
+      std::shared_ptr<shared_model::interface::CommonObjectsFactory> factory_;
+
+      shared_model::interface::types::AccountIdType creator_account_id_;
+    };
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_OVERLAY_COMMAND_EXECUTOR_HPP
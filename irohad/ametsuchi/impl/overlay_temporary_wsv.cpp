@@ -0,0 +1,99 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/overlay_temporary_wsv.hpp"
+
+#include "ametsuchi/impl/overlay_command_executor.hpp"
+#include "ametsuchi/impl/postgres_wsv_query.hpp"
+#include "ametsuchi/impl/wsv_overlay.hpp"
+#include "interfaces/transaction.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    OverlayTemporaryWsv::OverlayTemporaryWsv(
+        std::unique_ptr<soci::session> sql,
+        std::shared_ptr<shared_model::interface::CommonObjectsFactory> factory)
+        : sql_(std::move(sql)),
+          overlay_(std::make_shared<WsvOverlay>(
+              std::make_shared<PostgresWsvQuery>(*sql_, factory), factory)),
+          command_executor_(
+              std::make_shared<OverlayCommandExecutor>(overlay_, factory)),
+          command_validator_(std::make_shared<CommandValidator>(overlay_)) {
+      // all reads of the overlay must see the same state of the ledger
+      *sql_ << "BEGIN TRANSACTION ISOLATION LEVEL REPEATABLE READ READ ONLY";
+    }
+
+    expected::Result<void, validation::CommandError> OverlayTemporaryWsv::apply(
+        const shared_model::interface::Transaction &tx,
+        std::function<expected::Result<void, validation::CommandError>(
+            const shared_model::interface::Transaction &, WsvQuery &)>
+            apply_function) {
+      const auto &tx_creator = tx.creatorAccountId();
+      command_executor_->setCreatorAccountId(tx_creator);
+      command_validator_->setCreatorAccountId(tx_creator);
+      auto execute_command =
+          [this](auto &command) -> expected::Result<void, CommandError> {
+        return boost::apply_visitor(*command_validator_, command.get()) |
+            [this, &command] {
+              return boost::apply_visitor(*command_executor_, command.get());
+            };
+      };
+
+      SavepointWrapperImpl savepoint(overlay_);
+      return apply_function(tx, *overlay_) |
+                 [&savepoint, &execute_command, &tx]()
+                 -> expected::Result<void, validation::CommandError> {
+        const auto &commands = tx.commands();
+        validation::CommandError cmd_error;
+        for (size_t i = 0; i < commands.size(); ++i) {
+          auto cmd_is_valid =
+              execute_command(commands[i])
+                  .match([](expected::Value<void> &) { return true; },
+                         [i, &cmd_error](expected::Error<CommandError> &error) {
+                           cmd_error = {error.error.command_name,
+                                        error.error.toString(),
+                                        true,
+                                        i};
+                           return false;
+                         });
+          if (not cmd_is_valid) {
+            return expected::makeError(cmd_error);
+          }
+        }
+        savepoint.release();
+        return {};
+      };
+    }
+
+    std::unique_ptr<TemporaryWsv::SavepointWrapper>
+    OverlayTemporaryWsv::createSavepoint(const std::string &) {
+      return std::make_unique<SavepointWrapperImpl>(overlay_);
+    }
+
+    OverlayTemporaryWsv::~OverlayTemporaryWsv() {
+      *sql_ << "ROLLBACK";
+    }
+
+    OverlayTemporaryWsv::SavepointWrapperImpl::SavepointWrapperImpl(
+        std::shared_ptr<WsvOverlay> overlay)
+        : overlay_(std::move(overlay)),
+          savepoint_(overlay_->createSavepoint()),
+          is_released_(false) {}
+
+    void OverlayTemporaryWsv::SavepointWrapperImpl::release() {
+      is_released_ = true;
+    }
+
+    OverlayTemporaryWsv::SavepointWrapperImpl::~SavepointWrapperImpl() {
+      if (is_released_) {
+        overlay_->releaseSavepoint(savepoint_);
+      } else {
+        overlay_->rollbackToSavepoint(savepoint_);
+      }
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
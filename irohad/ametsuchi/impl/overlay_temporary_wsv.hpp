@@ -0,0 +1,67 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_OVERLAY_TEMPORARY_WSV_HPP
+#define IROHA_OVERLAY_TEMPORARY_WSV_HPP
+
+#include <soci/soci.h>
+
+#include "ametsuchi/temporary_wsv.hpp"
+#include "execution/command_executor.hpp"
+#include "interfaces/common_objects/common_objects_factory.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    class WsvOverlay;
+
+    /**
+     * Temporary wsv, which keeps changes in memory on top of a read-only
+     * snapshot of the ledger. Savepoints and rollbacks do not touch the
+     * database, and reads of the snapshot are cached, so the database is
+     * queried once per key
+     */
+    class OverlayTemporaryWsv : public TemporaryWsv {
+     public:
+      struct SavepointWrapperImpl : public TemporaryWsv::SavepointWrapper {
+        explicit SavepointWrapperImpl(std::shared_ptr<WsvOverlay> overlay);
+
+        void release() override;
+
+        ~SavepointWrapperImpl() override;
+
+       private:
+        std::shared_ptr<WsvOverlay> overlay_;
+        size_t savepoint_;
+        bool is_released_;
+      };
+
+      OverlayTemporaryWsv(
+          std::unique_ptr<soci::session> sql,
+          std::shared_ptr<shared_model::interface::CommonObjectsFactory>
+              factory);
+
+      expected::Result<void, validation::CommandError> apply(
+          const shared_model::interface::Transaction &,
+          std::function<expected::Result<void, validation::CommandError>(
+              const shared_model::interface::Transaction &, WsvQuery &)>
+              function) override;
+
+      std::unique_ptr<TemporaryWsv::SavepointWrapper> createSavepoint(
+          const std::string &name) override;
+
+      ~OverlayTemporaryWsv() override;
+
+     private:
+      std::unique_ptr<soci::session> sql_;
+      std::shared_ptr<WsvOverlay> overlay_;
+      std::shared_ptr<CommandExecutor> command_executor_;
+      std::shared_ptr<CommandValidator> command_validator_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_OVERLAY_TEMPORARY_WSV_HPP
@@ -13,10 +13,13 @@
 namespace iroha {
   namespace ametsuchi {
 
-    PostgresBlockQuery::PostgresBlockQuery(soci::session &sql,
-                                           KeyValueStorage &file_store)
+    PostgresBlockQuery::PostgresBlockQuery(
+        soci::session &sql,
+        KeyValueStorage &file_store,
+        std::shared_ptr<TopBlockCache> top_block_cache)
         : sql_(sql),
           block_store_(file_store),
+          top_block_cache_(std::move(top_block_cache)),
           log_(logger::log("PostgresBlockIndex")) {}
 
     std::vector<BlockQuery::wBlock> PostgresBlockQuery::getBlocks(
@@ -30,12 +33,9 @@ namespace iroha {
       }
       for (auto i = height; i <= to; i++) {
         block_store_.get(i) | [](const auto &bytes) {
-          return shared_model::converters::protobuf::jsonToModel<
+          return shared_model::converters::protobuf::jsonToArenaModel<
               shared_model::proto::Block>(bytesToString(bytes));
-        } | [&result](auto &&block) {
-          result.push_back(
-              std::make_shared<shared_model::proto::Block>(std::move(block)));
-        };
+        } | [&result](auto &&block) { result.push_back(std::move(block)); };
       }
       return result;
     }
@@ -92,7 +92,7 @@ namespace iroha {
                                  uint64_t block_id) {
       return [this, &blocks, block_id](std::vector<std::string> &result) {
         auto block = block_store_.get(block_id) | [](const auto &bytes) {
-          return shared_model::converters::protobuf::jsonToModel<
+          return shared_model::converters::protobuf::jsonToArenaModel<
               shared_model::proto::Block>(bytesToString(bytes));
         };
         if (not block) {
@@ -109,7 +109,7 @@ namespace iroha {
             }),
             [&](const auto &x) {
               blocks.push_back(PostgresBlockQuery::wTransaction(
-                  clone(block->transactions()[x])));
+                  clone((*block)->transactions()[x])));
             });
       };
     }
@@ -192,7 +192,7 @@ namespace iroha {
       auto block = getBlockId(hash) | [this](const auto &block_id) {
         return block_store_.get(block_id);
       } | [](const auto &bytes) {
-        return shared_model::converters::protobuf::jsonToModel<
+        return shared_model::converters::protobuf::jsonToArenaModel<
             shared_model::proto::Block>(bytesToString(bytes));
       };
       if (not block) {
@@ -202,10 +202,10 @@ namespace iroha {
 
       boost::optional<PostgresBlockQuery::wTransaction> result;
       auto it =
-          std::find_if(block->transactions().begin(),
-                       block->transactions().end(),
+          std::find_if((*block)->transactions().begin(),
+                       (*block)->transactions().end(),
                        [&hash](const auto &tx) { return tx.hash() == hash; });
-      if (it != block->transactions().end()) {
+      if (it != (*block)->transactions().end()) {
         result = boost::optional<PostgresBlockQuery::wTransaction>(
             PostgresBlockQuery::wTransaction(clone(*it)));
       }
@@ -223,17 +223,21 @@ namespace iroha {
 
     expected::Result<BlockQuery::wBlock, std::string>
     PostgresBlockQuery::getTopBlock() {
+      if (top_block_cache_) {
+        if (auto top_block = top_block_cache_->get()) {
+          return expected::makeValue(std::move(top_block));
+        }
+      }
       // TODO 18/06/18 Akvinikym: add dependency injection IR-937 IR-1040
       auto block =
           block_store_.get(block_store_.last_id()) | [](const auto &bytes) {
-            return shared_model::converters::protobuf::jsonToModel<
+            return shared_model::converters::protobuf::jsonToArenaModel<
                 shared_model::proto::Block>(bytesToString(bytes));
           };
       if (not block) {
         return expected::makeError("error while fetching the last block");
       }
-      return expected::makeValue(std::make_shared<shared_model::proto::Block>(
-          std::move(block.value())));
+      return expected::makeValue<wBlock>(std::move(block.value()));
     }
 
   }  // namespace ametsuchi
@@ -11,6 +11,7 @@
 #include "ametsuchi/block_query.hpp"
 #include "ametsuchi/impl/flat_file/flat_file.hpp"
 #include "ametsuchi/impl/soci_utils.hpp"
+#include "ametsuchi/impl/top_block_cache.hpp"
 #include "logger/logger.hpp"
 
 namespace iroha {
@@ -23,8 +24,14 @@ namespace iroha {
      */
     class PostgresBlockQuery : public BlockQuery {
      public:
-      explicit PostgresBlockQuery(soci::session &sql,
-                                  KeyValueStorage &file_store);
+      /**
+       * @param top_block_cache - last committed block, which is returned
+       * instead of reading the block store, if set
+       */
+      PostgresBlockQuery(
+          soci::session &sql,
+          KeyValueStorage &file_store,
+          std::shared_ptr<TopBlockCache> top_block_cache = nullptr);
 
       std::vector<wTransaction> getAccountTransactions(
           const shared_model::interface::types::AccountIdType &account_id)
@@ -85,6 +92,7 @@ namespace iroha {
       soci::session &sql_;
 
       KeyValueStorage &block_store_;
+      std::shared_ptr<TopBlockCache> top_block_cache_;
       logger::Logger log_;
     };
   }  // namespace ametsuchi
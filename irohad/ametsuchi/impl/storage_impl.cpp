@@ -10,6 +10,7 @@
 
 #include "ametsuchi/impl/flat_file/flat_file.hpp"
 #include "ametsuchi/impl/mutable_storage_impl.hpp"
+#include "ametsuchi/impl/overlay_temporary_wsv.hpp"
 #include "ametsuchi/impl/postgres_block_query.hpp"
 #include "ametsuchi/impl/postgres_wsv_query.hpp"
 #include "ametsuchi/impl/temporary_wsv_impl.hpp"
@@ -33,52 +34,118 @@ namespace iroha {
         PostgresOptions postgres_options,
         std::unique_ptr<KeyValueStorage> block_store,
         std::shared_ptr<soci::connection_pool> connection,
-        std::shared_ptr<shared_model::interface::CommonObjectsFactory> factory)
+        std::shared_ptr<shared_model::interface::CommonObjectsFactory> factory,
+        bool overlay_temporary_wsv)
         : block_store_dir_(std::move(block_store_dir)),
           postgres_options_(std::move(postgres_options)),
           block_store_(std::move(block_store)),
           connection_(connection),
           factory_(factory),
+          overlay_temporary_wsv_(overlay_temporary_wsv),
+          top_block_cache_(std::make_shared<TopBlockCache>()),
           log_(logger::log("StorageImpl")) {
       soci::session sql(*connection_);
       sql << init_;
+
+      // the top block is read from the block store only here and after a
+      // failed commit, otherwise it is updated on commit
+      reloadTopBlock(sql);
+    }
+
+    void StorageImpl::reloadTopBlock(soci::session &sql) {
+      PostgresBlockQuery(sql, *block_store_)
+          .getTopBlock()
+          .match(
+              [this](expected::Value<
+                     std::shared_ptr<shared_model::interface::Block>> &block) {
+                top_block_cache_->set(block.value);
+              },
+              [this](expected::Error<std::string> &) {
+                top_block_cache_->set(nullptr);
+              });
     }
 
     expected::Result<std::unique_ptr<TemporaryWsv>, std::string>
     StorageImpl::createTemporaryWsv() {
+      // changes of the prepared block would lock rows for the new state
+      dropPreparedBlock();
       std::shared_lock<std::shared_timed_mutex> lock(drop_mutex);
       if (connection_ == nullptr) {
         return expected::makeError("Connection was closed");
       }
       auto sql = std::make_unique<soci::session>(*connection_);
 
+      if (overlay_temporary_wsv_) {
+        return expected::makeValue<std::unique_ptr<TemporaryWsv>>(
+            std::make_unique<OverlayTemporaryWsv>(std::move(sql), factory_));
+      }
       return expected::makeValue<std::unique_ptr<TemporaryWsv>>(
           std::make_unique<TemporaryWsvImpl>(std::move(sql), factory_));
     }
 
+    void StorageImpl::prepareBlock(
+        std::unique_ptr<TemporaryWsv> wsv,
+        const shared_model::interface::types::HashType &block_hash,
+        const shared_model::interface::types::HashType &top_hash) {
+      auto wsv_impl = dynamic_cast<TemporaryWsvImpl *>(wsv.get());
+      if (wsv_impl == nullptr) {
+        // changes of the wsv are not in the database
+        return;
+      }
+      PreparedBlock prepared{std::move(wsv_impl->sql_), block_hash, top_hash};
+      wsv.reset();
+
+      dropPreparedBlock();
+      std::lock_guard<std::mutex> lock(prepared_block_mutex_);
+      prepared_block_ = std::move(prepared);
+    }
+
+    boost::optional<StorageImpl::PreparedBlock>
+    StorageImpl::takePreparedBlock() {
+      std::lock_guard<std::mutex> lock(prepared_block_mutex_);
+      auto prepared = std::move(prepared_block_);
+      prepared_block_ = boost::none;
+      return prepared;
+    }
+
+    void StorageImpl::dropPreparedBlock() {
+      if (auto prepared = takePreparedBlock()) {
+        log_->info("Dropping prepared block {}", prepared->block_hash.hex());
+        *prepared->sql << "ROLLBACK";
+      }
+    }
+
     expected::Result<std::unique_ptr<MutableStorage>, std::string>
     StorageImpl::createMutableStorage() {
-      boost::optional<shared_model::interface::types::HashType> top_hash;
+      auto prepared = takePreparedBlock();
 
       std::shared_lock<std::shared_timed_mutex> lock(drop_mutex);
       if (connection_ == nullptr) {
         return expected::makeError("Connection was closed");
       }
 
+      auto top_block = top_block_cache_->get();
+      auto top_hash = top_block
+          ? top_block->hash()
+          : shared_model::interface::types::HashType("");
+
+      // the prepared state is stale if other blocks were committed since
+      if (prepared and prepared->top_hash == top_hash) {
+        return expected::makeValue<std::unique_ptr<MutableStorage>>(
+            std::make_unique<MutableStorageImpl>(top_hash,
+                                                 std::move(prepared->sql),
+                                                 factory_,
+                                                 prepared->block_hash,
+                                                 getWsvQuery()));
+      }
+      if (prepared) {
+        *prepared->sql << "ROLLBACK";
+      }
+
       auto sql = std::make_unique<soci::session>(*connection_);
-      auto block_result = getBlockQuery()->getTopBlock();
       return expected::makeValue<std::unique_ptr<MutableStorage>>(
           std::make_unique<MutableStorageImpl>(
-              block_result.match(
-                  [](expected::Value<
-                      std::shared_ptr<shared_model::interface::Block>> &block) {
-                    return block.value->hash();
-                  },
-                  [](expected::Error<std::string> &) {
-                    return shared_model::interface::types::HashType("");
-                  }),
-              std::move(sql),
-              factory_));
+              top_hash, std::move(sql), factory_));
     }
 
     bool StorageImpl::insertBlock(const shared_model::interface::Block &block) {
@@ -130,6 +197,7 @@ namespace iroha {
     }
 
     void StorageImpl::reset() {
+      dropPreparedBlock();
       // erase db
       log_->info("drop db");
 
@@ -138,6 +206,7 @@ namespace iroha {
     }
 
     void StorageImpl::dropStorage() {
+      dropPreparedBlock();
       log_->info("drop storage");
       if (connection_ == nullptr) {
         log_->warn("Tried to drop storage without active connection");
@@ -167,6 +236,7 @@ WHERE pg_stat_activity.datname = :dbname
       // erase blocks
       log_->info("drop block store");
       block_store_->dropAll();
+      top_block_cache_->set(nullptr);
     }
 
     expected::Result<bool, std::string> StorageImpl::createDatabaseIfNotExist(
@@ -228,7 +298,8 @@ WHERE pg_stat_activity.datname = :dbname
         std::string block_store_dir,
         std::string postgres_options,
         std::shared_ptr<shared_model::interface::CommonObjectsFactory>
-            factory) {
+            factory,
+        bool overlay_temporary_wsv) {
       boost::optional<std::string> string_res = boost::none;
 
       PostgresOptions options(postgres_options);
@@ -259,7 +330,8 @@ WHERE pg_stat_activity.datname = :dbname
                                       options,
                                       std::move(ctx.value.block_store),
                                       connection.value,
-                                      factory)));
+                                      factory,
+                                      overlay_temporary_wsv)));
                 },
                 [&](expected::Error<std::string> &error) { storage = error; });
           },
@@ -270,16 +342,28 @@ WHERE pg_stat_activity.datname = :dbname
     void StorageImpl::commit(std::unique_ptr<MutableStorage> mutableStorage) {
       auto storage_ptr = std::move(mutableStorage);  // get ownership of storage
       auto storage = static_cast<MutableStorageImpl *>(storage_ptr.get());
-      for (const auto &block : storage->block_store_) {
-        block_store_->add(
-            block.first,
-            stringToBytes(shared_model::converters::protobuf::modelToJson(
-                *std::static_pointer_cast<shared_model::proto::Block>(
-                    block.second))));
-        notifier_.get_subscriber().on_next(block.second);
-      }
+      try {
+        for (const auto &block : storage->block_store_) {
+          if (block_store_->add(
+                  block.first,
+                  stringToBytes(shared_model::converters::protobuf::modelToJson(
+                      *std::static_pointer_cast<shared_model::proto::Block>(
+                          block.second))))) {
+            // subscribers of committed blocks read the top block from the
+            // cache, so it follows the block store before they are notified
+            top_block_cache_->set(block.second);
+          } else {
+            log_->error("Failed to store block {}", block.first);
+          }
+          notifier_.get_subscriber().on_next(block.second);
+        }
 
-      *(storage->sql_) << "COMMIT";
+        *(storage->sql_) << "COMMIT";
+      } catch (...) {
+        // the cache must not run ahead of the block store
+        reloadTopBlock(*storage->sql_);
+        throw;
+      }
       storage->committed = true;
     }
 
@@ -309,22 +393,22 @@ WHERE pg_stat_activity.datname = :dbname
       /**
        * Factory method for query object creation which uses connection_pool
        * @tparam Query object type to create
-       * @tparam Backend object type to use as a backend for Query
-       * @param b is a backend obj
+       * @tparam Backends object types to use as backends for Query
        * @param conn is pointer to connection pool for getting and releaseing
        * the session
        * @param log is a logger
        * @param drop_mutex is mutex for preventing connection destruction
        *        during the function
+       * @param b are backend objects
        * @return pointer to created query object
        * note: blocks untils connection can be leased from the pool
        */
-      template <typename Query, typename Backend>
+      template <typename Query, typename... Backends>
       std::shared_ptr<Query> setupQuery(
-          Backend &b,
           std::shared_ptr<soci::connection_pool> conn,
           const logger::Logger &log,
-          std::shared_timed_mutex &drop_mutex) {
+          std::shared_timed_mutex &drop_mutex,
+          Backends &&... b) {
         std::shared_lock<std::shared_timed_mutex> lock(drop_mutex);
         if (conn == nullptr) {
           log->warn("Storage was deleted, cannot perform setup");
@@ -333,19 +417,19 @@ WHERE pg_stat_activity.datname = :dbname
         auto pool_pos = conn->lease();
         soci::session &session = conn->at(pool_pos);
         lock.unlock();
-        return {new Query(session, b),
+        return {new Query(session, std::forward<Backends>(b)...),
                 Deleter<Query>(std::move(conn), pool_pos)};
       }
     }  // namespace
 
     std::shared_ptr<WsvQuery> StorageImpl::getWsvQuery() const {
       return setupQuery<PostgresWsvQuery>(
-          factory_, connection_, log_, drop_mutex);
+          connection_, log_, drop_mutex, factory_);
     }
 
     std::shared_ptr<BlockQuery> StorageImpl::getBlockQuery() const {
       return setupQuery<PostgresBlockQuery>(
-          *block_store_, connection_, log_, drop_mutex);
+          connection_, log_, drop_mutex, *block_store_, top_block_cache_);
     }
 
     rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
@@ -9,12 +9,14 @@
 #include "ametsuchi/storage.hpp"
 
 #include <cmath>
+#include <mutex>
 #include <shared_mutex>
 
 #include <soci/soci.h>
 #include <boost/optional.hpp>
 
 #include "ametsuchi/impl/postgres_options.hpp"
+#include "ametsuchi/impl/top_block_cache.hpp"
 #include "ametsuchi/key_value_storage.hpp"
 #include "interfaces/common_objects/common_objects_factory.hpp"
 #include "logger/logger.hpp"
@@ -44,15 +46,26 @@ namespace iroha {
       initPostgresConnection(std::string &options_str, size_t pool_size = 10);
 
      public:
+      /**
+       * @param overlay_temporary_wsv - keep changes of temporary wsvs in
+       * memory instead of the database, such wsvs can not be prepared for
+       * commit
+       */
       static expected::Result<std::shared_ptr<StorageImpl>, std::string> create(
           std::string block_store_dir,
           std::string postgres_connection,
           std::shared_ptr<shared_model::interface::CommonObjectsFactory>
-              factory_);
+              factory_,
+          bool overlay_temporary_wsv = false);
 
       expected::Result<std::unique_ptr<TemporaryWsv>, std::string>
       createTemporaryWsv() override;
 
+      void prepareBlock(
+          std::unique_ptr<TemporaryWsv> wsv,
+          const shared_model::interface::types::HashType &block_hash,
+          const shared_model::interface::types::HashType &top_hash) override;
+
       expected::Result<std::unique_ptr<MutableStorage>, std::string>
       createMutableStorage() override;
 
@@ -91,7 +104,8 @@ namespace iroha {
                   std::unique_ptr<KeyValueStorage> block_store,
                   std::shared_ptr<soci::connection_pool> connection,
                   std::shared_ptr<shared_model::interface::CommonObjectsFactory>
-                      factory);
+                      factory,
+                  bool overlay_temporary_wsv = false);
 
       /**
        * Folder with raw blocks
@@ -102,12 +116,47 @@ namespace iroha {
       const PostgresOptions postgres_options_;
 
      private:
+      /**
+       * Session with an open transaction, where all transactions of a block
+       * are applied
+       */
+      struct PreparedBlock {
+        std::shared_ptr<soci::session> sql;
+        shared_model::interface::types::HashType block_hash;
+        shared_model::interface::types::HashType top_hash;
+      };
+
+      /**
+       * Take the prepared block, if any
+       * @return boost::none if there is no prepared block
+       */
+      boost::optional<PreparedBlock> takePreparedBlock();
+
+      /**
+       * Roll back changes of the prepared block, so that its session does not
+       * lock the changed rows
+       */
+      void dropPreparedBlock();
+
+      /**
+       * Put the last block of the block store to the top block cache
+       * @param sql - session for the block query
+       */
+      void reloadTopBlock(soci::session &sql);
+
       std::unique_ptr<KeyValueStorage> block_store_;
 
       std::shared_ptr<soci::connection_pool> connection_;
 
       std::shared_ptr<shared_model::interface::CommonObjectsFactory> factory_;
 
+      const bool overlay_temporary_wsv_;
+
+      /**
+       * Last committed block, shared with block queries
+       */
+      std::shared_ptr<TopBlockCache> top_block_cache_;
+
       rxcpp::subjects::subject<std::shared_ptr<shared_model::interface::Block>>
           notifier_;
 
@@ -115,6 +164,9 @@ namespace iroha {
 
       mutable std::shared_timed_mutex drop_mutex;
 
+      boost::optional<PreparedBlock> prepared_block_;
+      std::mutex prepared_block_mutex_;
+
      protected:
       static const std::string &drop_;
       static const std::string &reset_;
@@ -79,7 +79,10 @@ namespace iroha {
     }
 
     TemporaryWsvImpl::~TemporaryWsvImpl() {
-      *sql_ << "ROLLBACK";
+      // session is taken away if the state is kept for commit
+      if (sql_) {
+        *sql_ << "ROLLBACK";
+      }
     }
 
     TemporaryWsvImpl::SavepointWrapperImpl::SavepointWrapperImpl(
@@ -0,0 +1,54 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_TOP_BLOCK_CACHE_HPP
+#define IROHA_TOP_BLOCK_CACHE_HPP
+
+#include <atomic>
+#include <memory>
+
+#include "interfaces/iroha_internal/block.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Last committed block of the ledger, kept in memory so that its height
+     * and hash are available without reading the block store
+     */
+    class TopBlockCache {
+     public:
+      /**
+       * @return the last committed block, nullptr if the ledger is empty
+       */
+      std::shared_ptr<shared_model::interface::Block> get() const {
+        return std::atomic_load(&block_);
+      }
+
+      /**
+       * Replace the last committed block
+       * @param block - new top block, nullptr if the ledger was dropped
+       */
+      void set(std::shared_ptr<shared_model::interface::Block> block) {
+        if (block) {
+          // fields of the block are computed lazily, which is not thread safe
+          block->hash();
+          block->prevHash();
+          block->transactions();
+          block->signatures();
+          block->blob();
+          block->payload();
+        }
+        std::atomic_store(&block_, std::move(block));
+      }
+
+     private:
+      std::shared_ptr<shared_model::interface::Block> block_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_TOP_BLOCK_CACHE_HPP
@@ -0,0 +1,600 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/wsv_overlay.hpp"
+
+#include <algorithm>
+
+#include <rapidjson/document.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+#include "common/result.hpp"
+#include "interfaces/common_objects/account.hpp"
+#include "interfaces/common_objects/account_asset.hpp"
+#include "interfaces/common_objects/asset.hpp"
+#include "interfaces/common_objects/domain.hpp"
+#include "interfaces/common_objects/peer.hpp"
+
+namespace {
+  template <typename T>
+  boost::optional<std::shared_ptr<T>> fromResult(
+      shared_model::interface::CommonObjectsFactory::FactoryResult<
+          std::unique_ptr<T>> &&result) {
+    return result.match(
+        [](iroha::expected::Value<std::unique_ptr<T>> &v) {
+          return boost::make_optional(std::shared_ptr<T>(std::move(v.value)));
+        },
+        [](iroha::expected::Error<std::string>)
+            -> boost::optional<std::shared_ptr<T>> { return boost::none; });
+  }
+
+  /**
+   * @return decimal representation of the balance
+   */
+  std::string toAmountString(
+      const iroha::ametsuchi::WsvOverlay::Balance &balance) {
+    auto digits = balance.value.str();
+    if (balance.precision == 0) {
+      return digits;
+    }
+    if (digits.size() <= balance.precision) {
+      digits.insert(0, balance.precision + 1 - digits.size(), '0');
+    }
+    digits.insert(digits.size() - balance.precision, 1, '.');
+    return digits;
+  }
+
+  std::string toJson(const rapidjson::Value &value) {
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    value.Accept(writer);
+    return buffer.GetString();
+  }
+
+  /**
+   * Set detail in account data in the same way as Postgres wsv does
+   * @return new account data
+   */
+  std::string setDetail(const std::string &json,
+                        const std::string &writer,
+                        const std::string &key,
+                        const std::string &value) {
+    rapidjson::Document document;
+    document.Parse(json.c_str());
+    if (document.HasParseError() or not document.IsObject()) {
+      document.SetObject();
+    }
+    auto &allocator = document.GetAllocator();
+
+    auto details = document.FindMember(writer.c_str());
+    if (details == document.MemberEnd()) {
+      document.AddMember(rapidjson::Value(writer.c_str(), allocator),
+                         rapidjson::Value(rapidjson::kObjectType),
+                         allocator);
+      details = document.FindMember(writer.c_str());
+    } else if (not details->value.IsObject()) {
+      details->value.SetObject();
+    }
+
+    rapidjson::Value new_value(
+        value.data(), static_cast<rapidjson::SizeType>(value.size()), allocator);
+    auto detail = details->value.FindMember(key.c_str());
+    if (detail == details->value.MemberEnd()) {
+      details->value.AddMember(
+          rapidjson::Value(key.c_str(), allocator), new_value, allocator);
+    } else {
+      detail->value = new_value;
+    }
+    return toJson(document);
+  }
+
+  /**
+   * Select details from account data in the same way as Postgres wsv does
+   */
+  boost::optional<std::string> getDetail(const std::string &json,
+                                         const std::string &key,
+                                         const std::string &writer) {
+    if (key.empty() and writer.empty()) {
+      return json;
+    }
+    rapidjson::Document document;
+    document.Parse(json.c_str());
+    if (document.HasParseError() or not document.IsObject()) {
+      return boost::none;
+    }
+
+    rapidjson::Document result(rapidjson::kObjectType);
+    auto &allocator = result.GetAllocator();
+    if (not writer.empty()) {
+      auto details = document.FindMember(writer.c_str());
+      rapidjson::Value value;
+      if (details != document.MemberEnd()) {
+        if (key.empty()) {
+          value.CopyFrom(details->value, allocator);
+        } else if (details->value.IsObject()) {
+          auto detail = details->value.FindMember(key.c_str());
+          if (detail != details->value.MemberEnd()) {
+            value.CopyFrom(detail->value, allocator);
+          }
+        }
+      }
+      if (not key.empty()) {
+        rapidjson::Value by_key(rapidjson::kObjectType);
+        by_key.AddMember(
+            rapidjson::Value(key.c_str(), allocator), value, allocator);
+        value = by_key;
+      }
+      result.AddMember(
+          rapidjson::Value(writer.c_str(), allocator), value, allocator);
+      return toJson(result);
+    }
+
+    // values from all writers under the key
+    for (auto details = document.MemberBegin();
+         details != document.MemberEnd();
+         ++details) {
+      if (not details->value.IsObject()) {
+        continue;
+      }
+      auto detail = details->value.FindMember(key.c_str());
+      if (detail == details->value.MemberEnd()) {
+        continue;
+      }
+      rapidjson::Value by_key(rapidjson::kObjectType);
+      by_key.AddMember(rapidjson::Value(key.c_str(), allocator),
+                       rapidjson::Value(detail->value, allocator),
+                       allocator);
+      result.AddMember(
+          rapidjson::Value(details->name, allocator), by_key, allocator);
+    }
+    if (result.MemberCount() == 0) {
+      return boost::none;
+    }
+    return toJson(result);
+  }
+}  // namespace
+
+namespace iroha {
+  namespace ametsuchi {
+
+    using shared_model::interface::types::AccountDetailKeyType;
+    using shared_model::interface::types::AccountDetailValueType;
+    using shared_model::interface::types::AccountIdType;
+    using shared_model::interface::types::AssetIdType;
+    using shared_model::interface::types::DomainIdType;
+    using shared_model::interface::types::PrecisionType;
+    using shared_model::interface::types::PubkeyType;
+    using shared_model::interface::types::QuorumType;
+    using shared_model::interface::types::RoleIdType;
+
+    WsvOverlay::WsvOverlay(
+        std::shared_ptr<WsvQuery> base,
+        std::shared_ptr<shared_model::interface::CommonObjectsFactory> factory)
+        : base_(std::move(base)),
+          factory_(std::move(factory)),
+          open_savepoints_(0) {}
+
+    // ------------------------------| queries |--------------------------------
+
+    bool WsvOverlay::hasAccountGrantablePermission(
+        const AccountIdType &permitee_account_id,
+        const AccountIdType &account_id,
+        shared_model::interface::permissions::Grantable permission) {
+      auto key = std::make_tuple(permitee_account_id, account_id, permission);
+      auto it = grantable_permissions_.find(key);
+      if (it == grantable_permissions_.end()) {
+        it = grantable_permissions_
+                 .emplace(key,
+                          base_->hasAccountGrantablePermission(
+                              permitee_account_id, account_id, permission))
+                 .first;
+      }
+      return it->second;
+    }
+
+    boost::optional<std::vector<RoleIdType>> WsvOverlay::getAccountRoles(
+        const AccountIdType &account_id) {
+      return accountRoles(account_id);
+    }
+
+    boost::optional<shared_model::interface::RolePermissionSet>
+    WsvOverlay::getRolePermissions(const RoleIdType &role_name) {
+      auto created = created_roles_.find(role_name);
+      if (created != created_roles_.end()) {
+        return created->second;
+      }
+      auto it = role_permissions_.find(role_name);
+      if (it == role_permissions_.end()) {
+        auto permissions = base_->getRolePermissions(role_name);
+        if (not permissions) {
+          return boost::none;
+        }
+        it = role_permissions_.emplace(role_name, *permissions).first;
+      }
+      return it->second;
+    }
+
+    boost::optional<std::vector<RoleIdType>> WsvOverlay::getRoles() {
+      std::vector<RoleIdType> roles(baseRoles().begin(), baseRoles().end());
+      for (const auto &role : created_roles_) {
+        roles.push_back(role.first);
+      }
+      return roles;
+    }
+
+    boost::optional<std::shared_ptr<shared_model::interface::Account>>
+    WsvOverlay::getAccount(const AccountIdType &account_id) {
+      auto it = accounts_.find(account_id);
+      if (it == accounts_.end()) {
+        it = accounts_.emplace(account_id, base_->getAccount(account_id)).first;
+      }
+      return it->second;
+    }
+
+    boost::optional<std::string> WsvOverlay::getAccountDetail(
+        const AccountIdType &account_id,
+        const AccountDetailKeyType &key,
+        const AccountIdType &writer) {
+      if (changed_details_.count(account_id) == 0) {
+        return base_->getAccountDetail(account_id, key, writer);
+      }
+      auto account = getAccount(account_id);
+      if (not account) {
+        return boost::none;
+      }
+      return getDetail((*account)->jsonData(), key, writer);
+    }
+
+    boost::optional<std::vector<PubkeyType>> WsvOverlay::getSignatories(
+        const AccountIdType &account_id) {
+      return signatories(account_id);
+    }
+
+    boost::optional<std::shared_ptr<shared_model::interface::Asset>>
+    WsvOverlay::getAsset(const AssetIdType &asset_id) {
+      auto it = assets_.find(asset_id);
+      if (it == assets_.end()) {
+        it = assets_.emplace(asset_id, base_->getAsset(asset_id)).first;
+      }
+      return it->second;
+    }
+
+    boost::optional<
+        std::vector<std::shared_ptr<shared_model::interface::AccountAsset>>>
+    WsvOverlay::getAccountAssets(const AccountIdType &account_id) {
+      auto base_assets = base_->getAccountAssets(account_id);
+      if (base_assets) {
+        for (const auto &asset : *base_assets) {
+          // cached balances may be changed in the overlay
+          account_assets_.emplace(
+              AccountAssetKey(account_id, asset->assetId()),
+              AccountAssetState{
+                  Balance{boost::multiprecision::cpp_int(
+                              asset->balance().intValue()),
+                          asset->balance().precision()},
+                  asset});
+        }
+      }
+
+      std::vector<std::shared_ptr<shared_model::interface::AccountAsset>>
+          assets;
+      for (auto it = account_assets_.lower_bound(
+               AccountAssetKey(account_id, AssetIdType()));
+           it != account_assets_.end() and it->first.first == account_id;
+           ++it) {
+        if (it->second) {
+          getAccountAsset(account_id, it->first.second) |
+              [&assets](const auto &asset) { assets.push_back(asset); };
+        }
+      }
+      return assets;
+    }
+
+    boost::optional<std::shared_ptr<shared_model::interface::AccountAsset>>
+    WsvOverlay::getAccountAsset(const AccountIdType &account_id,
+                                const AssetIdType &asset_id) {
+      auto &state = accountAsset(account_id, asset_id);
+      if (not state) {
+        return boost::none;
+      }
+      if (not state->object) {
+        auto object = fromResult(factory_->createAccountAsset(
+            account_id,
+            asset_id,
+            shared_model::interface::Amount(toAmountString(state->balance))));
+        if (not object) {
+          return boost::none;
+        }
+        state->object = *object;
+      }
+      return state->object;
+    }
+
+    boost::optional<std::shared_ptr<shared_model::interface::Domain>>
+    WsvOverlay::getDomain(const DomainIdType &domain_id) {
+      auto it = domains_.find(domain_id);
+      if (it == domains_.end()) {
+        it = domains_.emplace(domain_id, base_->getDomain(domain_id)).first;
+      }
+      return it->second;
+    }
+
+    boost::optional<std::vector<std::shared_ptr<shared_model::interface::Peer>>>
+    WsvOverlay::getPeers() {
+      auto peers = basePeers();
+      peers.insert(peers.end(), added_peers_.begin(), added_peers_.end());
+      return peers;
+    }
+
+    // -----------------------------| savepoints |------------------------------
+
+    size_t WsvOverlay::createSavepoint() {
+      ++open_savepoints_;
+      return journal_.size();
+    }
+
+    void WsvOverlay::releaseSavepoint(size_t) {
+      if (--open_savepoints_ == 0) {
+        journal_.clear();
+      }
+    }
+
+    void WsvOverlay::rollbackToSavepoint(size_t savepoint) {
+      while (journal_.size() > savepoint) {
+        journal_.back()();
+        journal_.pop_back();
+      }
+      if (--open_savepoints_ == 0) {
+        journal_.clear();
+      }
+    }
+
+    // -------------------------| state for commands |--------------------------
+
+    bool WsvOverlay::hasRole(const RoleIdType &role) {
+      return created_roles_.count(role) != 0 or baseRoles().count(role) != 0;
+    }
+
+    bool WsvOverlay::hasAccountRole(const AccountIdType &account_id,
+                                    const RoleIdType &role) {
+      const auto &roles = accountRoles(account_id);
+      return std::find(roles.begin(), roles.end(), role) != roles.end();
+    }
+
+    bool WsvOverlay::hasSignatory(const AccountIdType &account_id,
+                                  const PubkeyType &signatory) {
+      const auto &keys = signatories(account_id);
+      return std::find(keys.begin(), keys.end(), signatory) != keys.end();
+    }
+
+    boost::optional<WsvOverlay::Balance> WsvOverlay::getBalance(
+        const AccountIdType &account_id, const AssetIdType &asset_id) {
+      const auto &state = accountAsset(account_id, asset_id);
+      if (not state) {
+        return boost::none;
+      }
+      return state->balance;
+    }
+
+    // ------------------------------| changes |--------------------------------
+
+    bool WsvOverlay::insertAccount(const AccountIdType &account_id,
+                                   const DomainIdType &domain_id) {
+      auto account =
+          fromResult(factory_->createAccount(account_id, domain_id, 1, "{}"));
+      if (not account) {
+        return false;
+      }
+      assign(accounts_, account_id, account);
+      return true;
+    }
+
+    bool WsvOverlay::setQuorum(const AccountIdType &account_id,
+                               QuorumType quorum) {
+      auto account = getAccount(account_id);
+      if (not account) {
+        return true;
+      }
+      auto changed = fromResult(factory_->createAccount(
+          account_id, (*account)->domainId(), quorum, (*account)->jsonData()));
+      if (not changed) {
+        return false;
+      }
+      assign(accounts_, account_id, changed);
+      return true;
+    }
+
+    bool WsvOverlay::setAccountDetail(const AccountIdType &account_id,
+                                      const AccountIdType &writer,
+                                      const AccountDetailKeyType &key,
+                                      const AccountDetailValueType &value) {
+      auto account = getAccount(account_id);
+      if (not account) {
+        return true;
+      }
+      auto changed = fromResult(factory_->createAccount(
+          account_id,
+          (*account)->domainId(),
+          (*account)->quorum(),
+          setDetail((*account)->jsonData(), writer, key, value)));
+      if (not changed) {
+        return false;
+      }
+      assign(accounts_, account_id, changed);
+      assign(changed_details_, account_id, true);
+      return true;
+    }
+
+    bool WsvOverlay::insertAsset(const AssetIdType &asset_id,
+                                 const DomainIdType &domain_id,
+                                 PrecisionType precision) {
+      auto asset =
+          fromResult(factory_->createAsset(asset_id, domain_id, precision));
+      if (not asset) {
+        return false;
+      }
+      assign(assets_, asset_id, asset);
+      return true;
+    }
+
+    bool WsvOverlay::insertDomain(const DomainIdType &domain_id,
+                                  const RoleIdType &default_role) {
+      auto domain =
+          fromResult(factory_->createDomain(domain_id, default_role));
+      if (not domain) {
+        return false;
+      }
+      assign(domains_, domain_id, domain);
+      return true;
+    }
+
+    void WsvOverlay::setBalance(const AccountIdType &account_id,
+                                const AssetIdType &asset_id,
+                                Balance balance) {
+      assign(account_assets_,
+             AccountAssetKey(account_id, asset_id),
+             AccountAssetState{std::move(balance), nullptr});
+    }
+
+    void WsvOverlay::insertRole(
+        const RoleIdType &role,
+        const shared_model::interface::RolePermissionSet &permissions) {
+      assign(created_roles_, role, permissions);
+    }
+
+    void WsvOverlay::insertAccountRole(const AccountIdType &account_id,
+                                       const RoleIdType &role) {
+      auto roles = accountRoles(account_id);
+      roles.push_back(role);
+      assign(account_roles_, account_id, std::move(roles));
+    }
+
+    void WsvOverlay::deleteAccountRole(const AccountIdType &account_id,
+                                       const RoleIdType &role) {
+      auto roles = accountRoles(account_id);
+      roles.erase(std::remove(roles.begin(), roles.end(), role), roles.end());
+      assign(account_roles_, account_id, std::move(roles));
+    }
+
+    void WsvOverlay::insertSignatory(const AccountIdType &account_id,
+                                     const PubkeyType &signatory) {
+      auto keys = signatories(account_id);
+      keys.push_back(signatory);
+      assign(signatories_, account_id, std::move(keys));
+    }
+
+    void WsvOverlay::deleteSignatory(const AccountIdType &account_id,
+                                     const PubkeyType &signatory) {
+      auto keys = signatories(account_id);
+      keys.erase(std::remove(keys.begin(), keys.end(), signatory), keys.end());
+      assign(signatories_, account_id, std::move(keys));
+    }
+
+    void WsvOverlay::setGrantablePermission(
+        const AccountIdType &permitee_account_id,
+        const AccountIdType &account_id,
+        shared_model::interface::permissions::Grantable permission,
+        bool granted) {
+      assign(grantable_permissions_,
+             std::make_tuple(permitee_account_id, account_id, permission),
+             granted);
+    }
+
+    void WsvOverlay::insertPeer(
+        std::shared_ptr<shared_model::interface::Peer> peer) {
+      added_peers_.push_back(std::move(peer));
+      if (open_savepoints_ != 0) {
+        journal_.emplace_back([this] { added_peers_.pop_back(); });
+      }
+    }
+
+    // ------------------------------| private |--------------------------------
+
+    template <typename Map>
+    void WsvOverlay::assign(Map &map,
+                            const typename Map::key_type &key,
+                            typename Map::mapped_type value) {
+      auto it = map.find(key);
+      if (it == map.end()) {
+        map.emplace(key, std::move(value));
+        if (open_savepoints_ != 0) {
+          journal_.emplace_back([&map, key] { map.erase(key); });
+        }
+        return;
+      }
+      if (open_savepoints_ != 0) {
+        journal_.emplace_back(
+            [&map, key, previous = it->second] { map[key] = previous; });
+      }
+      it->second = std::move(value);
+    }
+
+    const std::set<RoleIdType> &WsvOverlay::baseRoles() {
+      if (not base_roles_) {
+        auto roles = base_->getRoles();
+        base_roles_ = roles ? std::set<RoleIdType>(roles->begin(), roles->end())
+                            : std::set<RoleIdType>();
+      }
+      return *base_roles_;
+    }
+
+    const std::vector<std::shared_ptr<shared_model::interface::Peer>>
+        &WsvOverlay::basePeers() {
+      if (not base_peers_) {
+        base_peers_ = base_->getPeers().value_or(
+            std::vector<std::shared_ptr<shared_model::interface::Peer>>{});
+      }
+      return *base_peers_;
+    }
+
+    std::vector<RoleIdType> &WsvOverlay::accountRoles(
+        const AccountIdType &account_id) {
+      auto it = account_roles_.find(account_id);
+      if (it == account_roles_.end()) {
+        it = account_roles_
+                 .emplace(account_id,
+                          base_->getAccountRoles(account_id)
+                              .value_or(std::vector<RoleIdType>{}))
+                 .first;
+      }
+      return it->second;
+    }
+
+    std::vector<PubkeyType> &WsvOverlay::signatories(
+        const AccountIdType &account_id) {
+      auto it = signatories_.find(account_id);
+      if (it == signatories_.end()) {
+        it = signatories_
+                 .emplace(account_id,
+                          base_->getSignatories(account_id)
+                              .value_or(std::vector<PubkeyType>{}))
+                 .first;
+      }
+      return it->second;
+    }
+
+    boost::optional<WsvOverlay::AccountAssetState> &WsvOverlay::accountAsset(
+        const AccountIdType &account_id, const AssetIdType &asset_id) {
+      AccountAssetKey key(account_id, asset_id);
+      auto it = account_assets_.find(key);
+      if (it == account_assets_.end()) {
+        boost::optional<AccountAssetState> state;
+        base_->getAccountAsset(account_id, asset_id) |
+            [&state](const auto &asset) {
+              state = AccountAssetState{
+                  Balance{
+                      boost::multiprecision::cpp_int(
+                          asset->balance().intValue()),
+                      asset->balance().precision()},
+                  asset};
+            };
+        it = account_assets_.emplace(key, std::move(state)).first;
+      }
+      return it->second;
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
@@ -0,0 +1,287 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_WSV_OVERLAY_HPP
+#define IROHA_WSV_OVERLAY_HPP
+
+#include "ametsuchi/wsv_query.hpp"
+
+#include <functional>
+#include <map>
+#include <set>
+#include <tuple>
+
+#include <boost/multiprecision/cpp_int.hpp>
+
+#include "interfaces/common_objects/common_objects_factory.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * World state view, which reads through to another one and keeps all
+     * changes in memory. Values read from the underlying wsv are cached, so
+     * every key is queried once.
+     *
+     * Changes are journaled: a savepoint is a position in the journal, and
+     * rolling back to it undoes the later changes. The journal is cleared
+     * when no savepoints are open.
+     */
+    class WsvOverlay : public WsvQuery {
+     public:
+      /**
+       * Asset balance as an integer number of the smallest units
+       */
+      struct Balance {
+        boost::multiprecision::cpp_int value;
+        shared_model::interface::types::PrecisionType precision;
+      };
+
+      /**
+       * @param base - wsv to read through to, must not change while the
+       * overlay is used
+       * @param factory - factory of objects returned by queries
+       */
+      WsvOverlay(
+          std::shared_ptr<WsvQuery> base,
+          std::shared_ptr<shared_model::interface::CommonObjectsFactory>
+              factory);
+
+      bool hasAccountGrantablePermission(
+          const shared_model::interface::types::AccountIdType
+              &permitee_account_id,
+          const shared_model::interface::types::AccountIdType &account_id,
+          shared_model::interface::permissions::Grantable permission) override;
+
+      boost::optional<std::vector<shared_model::interface::types::RoleIdType>>
+      getAccountRoles(const shared_model::interface::types::AccountIdType
+                          &account_id) override;
+
+      boost::optional<shared_model::interface::RolePermissionSet>
+      getRolePermissions(const shared_model::interface::types::RoleIdType
+                             &role_name) override;
+
+      boost::optional<std::vector<shared_model::interface::types::RoleIdType>>
+      getRoles() override;
+
+      boost::optional<std::shared_ptr<shared_model::interface::Account>>
+      getAccount(const shared_model::interface::types::AccountIdType
+                     &account_id) override;
+
+      boost::optional<std::string> getAccountDetail(
+          const shared_model::interface::types::AccountIdType &account_id,
+          const shared_model::interface::types::AccountDetailKeyType &key = "",
+          const shared_model::interface::types::AccountIdType &writer =
+              "") override;
+
+      boost::optional<std::vector<shared_model::interface::types::PubkeyType>>
+      getSignatories(const shared_model::interface::types::AccountIdType
+                         &account_id) override;
+
+      boost::optional<std::shared_ptr<shared_model::interface::Asset>>
+      getAsset(
+          const shared_model::interface::types::AssetIdType &asset_id) override;
+
+      boost::optional<
+          std::vector<std::shared_ptr<shared_model::interface::AccountAsset>>>
+      getAccountAssets(const shared_model::interface::types::AccountIdType
+                           &account_id) override;
+
+      boost::optional<std::shared_ptr<shared_model::interface::AccountAsset>>
+      getAccountAsset(
+          const shared_model::interface::types::AccountIdType &account_id,
+          const shared_model::interface::types::AssetIdType &asset_id) override;
+
+      boost::optional<std::shared_ptr<shared_model::interface::Domain>>
+      getDomain(const shared_model::interface::types::DomainIdType &domain_id)
+          override;
+
+      boost::optional<
+          std::vector<std::shared_ptr<shared_model::interface::Peer>>>
+      getPeers() override;
+
+      /**
+       * @return savepoint at the current state
+       */
+      size_t createSavepoint();
+
+      /**
+       * Keep changes made after the savepoint
+       */
+      void releaseSavepoint(size_t savepoint);
+
+      /**
+       * Undo changes made after the savepoint
+       */
+      void rollbackToSavepoint(size_t savepoint);
+
+      // ------------------------| state for commands |-------------------------
+
+      bool hasRole(const shared_model::interface::types::RoleIdType &role);
+
+      bool hasAccountRole(
+          const shared_model::interface::types::AccountIdType &account_id,
+          const shared_model::interface::types::RoleIdType &role);
+
+      bool hasSignatory(
+          const shared_model::interface::types::AccountIdType &account_id,
+          const shared_model::interface::types::PubkeyType &signatory);
+
+      /**
+       * @return balance of the account, boost::none if it has no such asset
+       */
+      boost::optional<Balance> getBalance(
+          const shared_model::interface::types::AccountIdType &account_id,
+          const shared_model::interface::types::AssetIdType &asset_id);
+
+      // -----------------------------| changes |-------------------------------
+      // Changes do not check constraints of the ledger, which is done by
+      // their callers. They return false only if an object can not be
+      // created by the factory.
+
+      bool insertAccount(
+          const shared_model::interface::types::AccountIdType &account_id,
+          const shared_model::interface::types::DomainIdType &domain_id);
+
+      bool setQuorum(
+          const shared_model::interface::types::AccountIdType &account_id,
+          shared_model::interface::types::QuorumType quorum);
+
+      bool setAccountDetail(
+          const shared_model::interface::types::AccountIdType &account_id,
+          const shared_model::interface::types::AccountIdType &writer,
+          const shared_model::interface::types::AccountDetailKeyType &key,
+          const shared_model::interface::types::AccountDetailValueType &value);
+
+      bool insertAsset(
+          const shared_model::interface::types::AssetIdType &asset_id,
+          const shared_model::interface::types::DomainIdType &domain_id,
+          shared_model::interface::types::PrecisionType precision);
+
+      bool insertDomain(
+          const shared_model::interface::types::DomainIdType &domain_id,
+          const shared_model::interface::types::RoleIdType &default_role);
+
+      void setBalance(
+          const shared_model::interface::types::AccountIdType &account_id,
+          const shared_model::interface::types::AssetIdType &asset_id,
+          Balance balance);
+
+      void insertRole(
+          const shared_model::interface::types::RoleIdType &role,
+          const shared_model::interface::RolePermissionSet &permissions);
+
+      void insertAccountRole(
+          const shared_model::interface::types::AccountIdType &account_id,
+          const shared_model::interface::types::RoleIdType &role);
+
+      void deleteAccountRole(
+          const shared_model::interface::types::AccountIdType &account_id,
+          const shared_model::interface::types::RoleIdType &role);
+
+      void insertSignatory(
+          const shared_model::interface::types::AccountIdType &account_id,
+          const shared_model::interface::types::PubkeyType &signatory);
+
+      void deleteSignatory(
+          const shared_model::interface::types::AccountIdType &account_id,
+          const shared_model::interface::types::PubkeyType &signatory);
+
+      void setGrantablePermission(
+          const shared_model::interface::types::AccountIdType
+              &permitee_account_id,
+          const shared_model::interface::types::AccountIdType &account_id,
+          shared_model::interface::permissions::Grantable permission,
+          bool granted);
+
+      void insertPeer(std::shared_ptr<shared_model::interface::Peer> peer);
+
+     private:
+      using AccountAssetKey =
+          std::pair<shared_model::interface::types::AccountIdType,
+                    shared_model::interface::types::AssetIdType>;
+      using GrantableKey =
+          std::tuple<shared_model::interface::types::AccountIdType,
+                     shared_model::interface::types::AccountIdType,
+                     shared_model::interface::permissions::Grantable>;
+
+      /**
+       * Balance with the object returned by queries, which is created on
+       * demand
+       */
+      struct AccountAssetState {
+        Balance balance;
+        std::shared_ptr<shared_model::interface::AccountAsset> object;
+      };
+
+      /**
+       * Set value in the map and journal the previous one
+       */
+      template <typename Map>
+      void assign(Map &map,
+                  const typename Map::key_type &key,
+                  typename Map::mapped_type value);
+
+      const std::set<shared_model::interface::types::RoleIdType> &baseRoles();
+
+      const std::vector<std::shared_ptr<shared_model::interface::Peer>>
+          &basePeers();
+
+      std::vector<shared_model::interface::types::RoleIdType> &accountRoles(
+          const shared_model::interface::types::AccountIdType &account_id);
+
+      std::vector<shared_model::interface::types::PubkeyType> &signatories(
+          const shared_model::interface::types::AccountIdType &account_id);
+
+      boost::optional<AccountAssetState> &accountAsset(
+          const shared_model::interface::types::AccountIdType &account_id,
+          const shared_model::interface::types::AssetIdType &asset_id);
+
+      std::shared_ptr<WsvQuery> base_;
+      std::shared_ptr<shared_model::interface::CommonObjectsFactory> factory_;
+
+      // boost::none values mean that there is no such object
+      std::map<shared_model::interface::types::AccountIdType,
+               boost::optional<std::shared_ptr<shared_model::interface::Account>>>
+          accounts_;
+      std::map<shared_model::interface::types::AssetIdType,
+               boost::optional<std::shared_ptr<shared_model::interface::Asset>>>
+          assets_;
+      std::map<shared_model::interface::types::DomainIdType,
+               boost::optional<std::shared_ptr<shared_model::interface::Domain>>>
+          domains_;
+      std::map<AccountAssetKey, boost::optional<AccountAssetState>>
+          account_assets_;
+      std::map<shared_model::interface::types::AccountIdType,
+               std::vector<shared_model::interface::types::RoleIdType>>
+          account_roles_;
+      std::map<shared_model::interface::types::AccountIdType,
+               std::vector<shared_model::interface::types::PubkeyType>>
+          signatories_;
+      std::map<GrantableKey, bool> grantable_permissions_;
+      std::map<shared_model::interface::types::RoleIdType,
+               shared_model::interface::RolePermissionSet>
+          role_permissions_;
+      std::map<shared_model::interface::types::RoleIdType,
+               shared_model::interface::RolePermissionSet>
+          created_roles_;
+      /// accounts with details set in the overlay
+      std::map<shared_model::interface::types::AccountIdType, bool>
+          changed_details_;
+      boost::optional<std::set<shared_model::interface::types::RoleIdType>>
+          base_roles_;
+      boost::optional<
+          std::vector<std::shared_ptr<shared_model::interface::Peer>>>
+          base_peers_;
+      std::vector<std::shared_ptr<shared_model::interface::Peer>> added_peers_;
+
+      std::vector<std::function<void()>> journal_;
+      size_t open_savepoints_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_WSV_OVERLAY_HPP
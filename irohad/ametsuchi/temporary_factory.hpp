@@ -20,6 +20,7 @@
 
 #include <memory>
 #include "common/result.hpp"
+#include "interfaces/common_objects/types.hpp"
 
 namespace iroha {
   namespace ametsuchi {
@@ -38,6 +39,22 @@ namespace iroha {
       virtual expected::Result<std::unique_ptr<TemporaryWsv>, std::string>
       createTemporaryWsv() = 0;
 
+      /**
+       * Keep the state of temporary wsv, which has all transactions of the
+       * block applied, until the next block is committed. If it is the given
+       * block, it is committed from this state without executing its
+       * transactions again. The state is dropped when another temporary wsv
+       * or mutable storage is created
+       * @param wsv - temporary wsv produced by this factory
+       * @param block_hash - hash of the block
+       * @param top_hash - hash of the top block of the ledger the state is
+       * based on
+       */
+      virtual void prepareBlock(
+          std::unique_ptr<TemporaryWsv> wsv,
+          const shared_model::interface::types::HashType &block_hash,
+          const shared_model::interface::types::HashType &top_hash) = 0;
+
       virtual ~TemporaryFactory() = default;
     };
 
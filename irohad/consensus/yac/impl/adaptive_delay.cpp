@@ -0,0 +1,70 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "consensus/yac/impl/adaptive_delay.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace iroha {
+  namespace consensus {
+    namespace yac {
+
+      /// weight of a new observation in the average
+      static constexpr double kAverageGain = 1. / 8;
+      /// weight of a new observation in the deviation
+      static constexpr double kDeviationGain = 1. / 4;
+      /// number of deviations added to the average
+      static constexpr double kDeviationFactor = 4.;
+
+      constexpr const char *AdaptiveDelay::kDelayGauge;
+
+      AdaptiveDelay::AdaptiveDelay(DelayType initial,
+                                   DelayType min,
+                                   DelayType max,
+                                   std::shared_ptr<metrics::MetricsSink> sink)
+          : min_(min),
+            max_(std::max(min, max)),
+            sink_(std::move(sink)),
+            has_observations_(false),
+            average_(0),
+            deviation_(0),
+            current_(std::min(std::max(initial, min_), max_)) {
+        if (sink_) {
+          sink_->onGauge(kDelayGauge, current_.count());
+        }
+      }
+
+      void AdaptiveDelay::observe(DelayType latency) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        auto sample = static_cast<double>(latency.count());
+        if (not has_observations_) {
+          average_ = sample;
+          deviation_ = sample / 2;
+          has_observations_ = true;
+        } else {
+          deviation_ = (1 - kDeviationGain) * deviation_
+              + kDeviationGain * std::abs(average_ - sample);
+          average_ = (1 - kAverageGain) * average_ + kAverageGain * sample;
+        }
+        auto estimate = DelayType(static_cast<DelayType::rep>(
+            std::ceil(average_ + kDeviationFactor * deviation_)));
+        current_ = std::min(std::max(estimate, min_), max_);
+        auto delay = current_;
+        lock.unlock();
+
+        if (sink_) {
+          sink_->onGauge(kDelayGauge, delay.count());
+        }
+      }
+
+      AdaptiveDelay::DelayType AdaptiveDelay::current() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return current_;
+      }
+
+    }  // namespace yac
+  }    // namespace consensus
+}  // namespace iroha
@@ -0,0 +1,76 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_YAC_ADAPTIVE_DELAY_HPP
+#define IROHA_YAC_ADAPTIVE_DELAY_HPP
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+
+#include "metrics/metrics_sink.hpp"
+
+namespace iroha {
+  namespace consensus {
+    namespace yac {
+
+      /**
+       * Estimates delay before sending vote to the next peer from observed
+       * vote-to-commit latency. Latency is smoothed with exponentially
+       * weighted moving average and its mean deviation, the same way as TCP
+       * retransmission timeout is derived from round-trip time: the delay is
+       * average plus four deviations, clamped to configured bounds.
+       *
+       * Fixed delay is represented by equal bounds.
+       */
+      class AdaptiveDelay {
+       public:
+        using DelayType = std::chrono::milliseconds;
+
+        /// name of the gauge with the current delay reported to the sink
+        static constexpr const char *kDelayGauge = "yac_vote_delay_ms";
+
+        /**
+         * @param initial - delay used until the first observation
+         * @param min - lower bound of the delay
+         * @param max - upper bound of the delay
+         * @param sink - receiver of the current delay, may be null
+         */
+        AdaptiveDelay(DelayType initial,
+                      DelayType min,
+                      DelayType max,
+                      std::shared_ptr<metrics::MetricsSink> sink = nullptr);
+
+        /**
+         * Take into account time passed from the first vote of the round to
+         * the commit
+         * @param latency - observed vote-to-commit latency
+         */
+        void observe(DelayType latency);
+
+        /**
+         * @return delay to be used for the next vote
+         */
+        DelayType current() const;
+
+       private:
+        const DelayType min_;
+        const DelayType max_;
+        std::shared_ptr<metrics::MetricsSink> sink_;
+
+        mutable std::mutex mutex_;
+        bool has_observations_;
+        /// smoothed latency in milliseconds
+        double average_;
+        /// smoothed mean deviation of latency in milliseconds
+        double deviation_;
+        DelayType current_;
+      };
+
+    }  // namespace yac
+  }    // namespace consensus
+}  // namespace iroha
+
+#endif  // IROHA_YAC_ADAPTIVE_DELAY_HPP
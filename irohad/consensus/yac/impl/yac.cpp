@@ -22,6 +22,7 @@
 #include "common/types.hpp"
 #include "common/visitor.hpp"
 #include "consensus/yac/cluster_order.hpp"
+#include "consensus/yac/impl/adaptive_delay.hpp"
 #include "consensus/yac/storage/yac_proposal_storage.hpp"
 #include "consensus/yac/timer.hpp"
 #include "consensus/yac/yac_crypto_provider.hpp"
@@ -56,20 +57,31 @@ namespace iroha {
           std::shared_ptr<YacNetwork> network,
           std::shared_ptr<YacCryptoProvider> crypto,
           std::shared_ptr<Timer> timer,
-          ClusterOrdering order) {
-        return std::make_shared<Yac>(
-            vote_storage, network, crypto, timer, order);
+          ClusterOrdering order,
+          std::shared_ptr<metrics::RoundTimer> round_timer,
+          std::shared_ptr<AdaptiveDelay> vote_delay) {
+        return std::make_shared<Yac>(vote_storage,
+                                     network,
+                                     crypto,
+                                     timer,
+                                     order,
+                                     round_timer,
+                                     vote_delay);
       }
 
       Yac::Yac(YacVoteStorage vote_storage,
                std::shared_ptr<YacNetwork> network,
                std::shared_ptr<YacCryptoProvider> crypto,
                std::shared_ptr<Timer> timer,
-               ClusterOrdering order)
+               ClusterOrdering order,
+               std::shared_ptr<metrics::RoundTimer> round_timer,
+               std::shared_ptr<AdaptiveDelay> vote_delay)
           : vote_storage_(std::move(vote_storage)),
             network_(std::move(network)),
             crypto_(std::move(crypto)),
             timer_(std::move(timer)),
+            round_timer_(std::move(round_timer)),
+            vote_delay_(std::move(vote_delay)),
             cluster_order_(order) {
         log_ = logger::log("YAC");
       }
@@ -82,6 +94,11 @@ namespace iroha {
                                      [](auto val) { return val->address(); }));
 
         cluster_order_ = order;
+        if (vote_delay_) {
+          std::lock_guard<std::mutex> guard(mutex_);
+          vote_started_ = std::make_pair(hash.proposal_hash,
+                                         std::chrono::steady_clock::now());
+        }
         auto vote = crypto_->getVote(hash);
         votingStep(vote);
       }
@@ -134,6 +151,8 @@ namespace iroha {
                    vote.hash.block_hash);
 
         network_->send_vote(cluster_order_.currentLeader(), vote);
+        // timer keeps only the first vote of the round
+        metrics::markStage(round_timer_, metrics::RoundStage::kFirstVoteSent);
         cluster_order_.switchToNext();
         if (cluster_order_.hasNext()) {
           timer_->invokeAfterDelay([this, vote] { this->votingStep(vote); });
@@ -173,6 +192,7 @@ namespace iroha {
             vote_storage_.markAsProcessedState(proposal_hash);
             visit_in_place(answer,
                            [&](const CommitMessage &commit) {
+                             this->onSupermajority(proposal_hash);
                              notifier_.get_subscriber().on_next(commit);
                            },
                            [&](const RejectMessage &reject) {
@@ -204,6 +224,7 @@ namespace iroha {
                              // IR-497
                            },
                            [&](const CommitMessage &commit) {
+                             this->onSupermajority(proposal_hash);
                              this->propagateCommit(commit);
                              notifier_.get_subscriber().on_next(commit);
                            });
@@ -237,6 +258,7 @@ namespace iroha {
             vote_storage_.markAsProcessedState(proposal_hash);
             visit_in_place(answer,
                            [&](const CommitMessage &commit) {
+                             this->onSupermajority(proposal_hash);
                              // propagate for all
                              log_->info("Propagate commit {} to whole network",
                                         vote.hash.block_hash);
@@ -266,6 +288,18 @@ namespace iroha {
         };
       }
 
+      void Yac::onSupermajority(const std::string &proposal_hash) {
+        metrics::markStage(round_timer_,
+                           metrics::RoundStage::kSupermajorityReached);
+        if (vote_delay_ and vote_started_
+            and vote_started_->first == proposal_hash) {
+          vote_delay_->observe(
+              std::chrono::duration_cast<AdaptiveDelay::DelayType>(
+                  std::chrono::steady_clock::now() - vote_started_->second));
+          vote_started_ = boost::none;
+        }
+      }
+
       // ------|Propagation|------
 
       void Yac::propagateCommit(const CommitMessage &msg) {
@@ -23,46 +23,61 @@
 namespace iroha {
   namespace consensus {
     namespace yac {
+      namespace {
+        /**
+         * Serialize the signed part of the vote, which is its hash
+         * @param vote - vote to serialize
+         * @param buffer - receiver of the bytes, its memory is reused
+         */
+        void serializeSignedPart(const VoteMessage &vote,
+                                 shared_model::crypto::Blob::Bytes &buffer) {
+          auto pb_vote = PbConverters::serializeVotePayload(vote);
+          buffer.resize(pb_vote.hash().ByteSizeLong());
+          pb_vote.hash().SerializeWithCachedSizesToArray(buffer.data());
+        }
+      }  // namespace
+
       CryptoProviderImpl::CryptoProviderImpl(
           const shared_model::crypto::Keypair &keypair)
           : keypair_(keypair) {}
 
-      bool CryptoProviderImpl::verify(CommitMessage msg) {
+      bool CryptoProviderImpl::verify(const CommitMessage &msg) {
         return std::all_of(
             std::begin(msg.votes),
             std::end(msg.votes),
             [this](const auto &vote) { return this->verify(vote); });
       }
 
-      bool CryptoProviderImpl::verify(RejectMessage msg) {
+      bool CryptoProviderImpl::verify(const RejectMessage &msg) {
         return std::all_of(
             std::begin(msg.votes),
             std::end(msg.votes),
             [this](const auto &vote) { return this->verify(vote); });
       }
 
-      bool CryptoProviderImpl::verify(VoteMessage msg) {
-        auto serialized =
-            PbConverters::serializeVote(msg).hash().SerializeAsString();
-        auto blob = shared_model::crypto::Blob(serialized);
+      bool CryptoProviderImpl::verify(const VoteMessage &msg) {
+        // votes are verified by the transport threads, every one of them
+        // keeps its own buffer
+        thread_local shared_model::crypto::Blob::Bytes buffer;
+        serializeSignedPart(msg, buffer);
 
         return shared_model::crypto::CryptoVerifier<>::verify(
-            msg.signature->signedData(), blob, msg.signature->publicKey());
+            msg.signature->signedData(),
+            buffer.data(),
+            buffer.size(),
+            msg.signature->publicKey());
       }
 
       VoteMessage CryptoProviderImpl::getVote(YacHash hash) {
         VoteMessage vote;
-        vote.hash = hash;
-        auto serialized =
-            PbConverters::serializeVotePayload(vote).hash().SerializeAsString();
-        auto blob = shared_model::crypto::Blob(serialized);
-        const auto &pubkey = keypair_.publicKey();
-        const auto &privkey = keypair_.privateKey();
+        vote.hash = std::move(hash);
+        shared_model::crypto::Blob::Bytes serialized;
+        serializeSignedPart(vote, serialized);
         auto signature = shared_model::crypto::CryptoSigner<>::sign(
-            blob, shared_model::crypto::Keypair(pubkey, privkey));
+            shared_model::crypto::Blob(std::move(serialized)), keypair_);
 
         shared_model::builder::DefaultSignatureBuilder()
-            .publicKey(pubkey)
+            .publicKey(keypair_.publicKey())
             .signedData(signature)
             .build()
             .match([&vote](iroha::expected::Value<
@@ -17,6 +17,8 @@
 
 #include "consensus/yac/impl/yac_gate_impl.hpp"
 
+#include <grpc++/client_context.h>
+
 #include "backend/protobuf/block.hpp"
 #include "builders/protobuf/common_objects/proto_signature_builder.hpp"
 #include "common/visitor.hpp"
@@ -34,19 +36,23 @@ namespace iroha {
   namespace consensus {
     namespace yac {
 
+      constexpr size_t YacGateImpl::kParallelBlockRequests;
+
       YacGateImpl::YacGateImpl(
           std::shared_ptr<HashGate> hash_gate,
           std::shared_ptr<YacPeerOrderer> orderer,
           std::shared_ptr<YacHashProvider> hash_provider,
           std::shared_ptr<simulator::BlockCreator> block_creator,
           std::shared_ptr<network::BlockLoader> block_loader,
-          uint64_t delay)
+          uint64_t delay,
+          bool run_async)
           : hash_gate_(std::move(hash_gate)),
             orderer_(std::move(orderer)),
             hash_provider_(std::move(hash_provider)),
             block_creator_(std::move(block_creator)),
             block_loader_(std::move(block_loader)),
-            delay_(delay) {
+            delay_(delay),
+            run_async_(run_async) {
         log_ = logger::log("YacGate");
         block_creator_->on_block().subscribe(
             [this](const auto &block) { this->vote(block); });
@@ -97,22 +103,20 @@ namespace iroha {
             rxcpp::observable<>::iterate(commit_message.votes)
                 // allow other peers to apply commit
                 .delay(std::chrono::milliseconds(delay_))
-                .flat_map([this, model_hash](auto vote) {
-                  // map vote to block if it can be loaded
-                  return rxcpp::observable<>::create<
-                      std::shared_ptr<shared_model::interface::Block>>(
-                      [this, model_hash, vote](auto subscriber) {
-                        auto block = block_loader_->retrieveBlock(
-                            vote.signature->publicKey(),
-                            shared_model::crypto::Hash(model_hash));
-                        // if load is successful
-                        if (block) {
-                          subscriber.on_next(block.value());
-                        }
-                        subscriber.on_completed();
-                      });
+                // race several voters at once, so that a slow or dead peer
+                // does not stall the commit; next voters are asked only if
+                // none of the current ones provided the block
+                .buffer(kParallelBlockRequests)
+                .concat_map([this, model_hash](std::vector<VoteMessage> votes) {
+                  return rxcpp::observable<>::iterate(votes).flat_map(
+                      [this, model_hash](const auto &vote) {
+                        // map vote to block if it can be loaded
+                        return this->loadBlock(vote, model_hash);
+                      },
+                      rxcpp::serialize_new_thread());
                 })
-                // need only the first
+                // need only the first, requests to other voters are
+                // unsubscribed, which cancels their calls
                 .first()
                 .retry()
                 .subscribe(
@@ -130,6 +134,33 @@ namespace iroha {
         });
       }
 
+      rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
+      YacGateImpl::loadBlock(
+          const VoteMessage &vote,
+          const shared_model::interface::types::HashType &hash) {
+        auto request = rxcpp::observable<>::create<
+            std::shared_ptr<shared_model::interface::Block>>(
+            [this, hash, vote](auto subscriber) {
+              auto context = std::make_shared<grpc::ClientContext>();
+              // cancellation of a finished call is a no-op
+              subscriber.add([context] { context->TryCancel(); });
+              auto block = block_loader_->retrieveBlock(
+                  vote.signature->publicKey(),
+                  shared_model::crypto::Hash(hash),
+                  *context);
+              // if load is successful and the block is still needed
+              if (block and subscriber.is_subscribed()) {
+                subscriber.on_next(block.value());
+              }
+              subscriber.on_completed();
+            });
+        if (run_async_) {
+          return request.subscribe_on(rxcpp::observe_on_new_thread())
+              .as_dynamic();
+        }
+        return request.as_dynamic();
+      }
+
       void YacGateImpl::copySignatures(const CommitMessage &commit) {
         for (const auto &vote : commit.votes) {
           auto sig = vote.hash.block_signature;
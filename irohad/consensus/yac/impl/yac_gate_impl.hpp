@@ -39,16 +39,26 @@ namespace iroha {
     namespace yac {
 
       struct CommitMessage;
+      struct VoteMessage;
       class YacPeerOrderer;
 
       class YacGateImpl : public YacGate {
        public:
+        /// number of voters which are asked for the committed block at once
+        static constexpr size_t kParallelBlockRequests = 3;
+
+        /**
+         * @param delay - delay in milliseconds before loading committed block
+         * @param run_async - whether committed block is requested from
+         * voters in parallel on separate threads. Default is true.
+         */
         YacGateImpl(std::shared_ptr<HashGate> hash_gate,
                     std::shared_ptr<YacPeerOrderer> orderer,
                     std::shared_ptr<YacHashProvider> hash_provider,
                     std::shared_ptr<simulator::BlockCreator> block_creator,
                     std::shared_ptr<network::BlockLoader> block_loader,
-                    uint64_t delay);
+                    uint64_t delay,
+                    bool run_async = true);
         void vote(const shared_model::interface::BlockVariant &) override;
         /**
          * method called when commit recived
@@ -65,6 +75,16 @@ namespace iroha {
          */
         void copySignatures(const CommitMessage &commit);
 
+        /**
+         * Request the block from the peer which voted for it
+         * @param vote - vote of the peer
+         * @param hash - hash of the block
+         * @return observable with the block if it is loaded, empty otherwise
+         */
+        rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
+        loadBlock(const VoteMessage &vote,
+                  const shared_model::interface::types::HashType &hash);
+
         std::shared_ptr<HashGate> hash_gate_;
         std::shared_ptr<YacPeerOrderer> orderer_;
         std::shared_ptr<YacHashProvider> hash_provider_;
@@ -72,6 +92,7 @@ namespace iroha {
         std::shared_ptr<network::BlockLoader> block_loader_;
 
         const uint64_t delay_;
+        const bool run_async_;
 
         logger::Logger log_;
 
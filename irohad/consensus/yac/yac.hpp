@@ -19,6 +19,7 @@
 #define IROHA_YAC_HPP
 
 #include <boost/optional.hpp>
+#include <chrono>
 #include <memory>
 #include <mutex>
 #include <rxcpp/rx-observable.hpp>
@@ -29,6 +30,7 @@
 #include "consensus/yac/transport/yac_network_interface.hpp"  // for YacNetworkNotifications
 #include "consensus/yac/yac_gate.hpp"                         // for HashGate
 #include "logger/logger.hpp"
+#include "metrics/round_timer.hpp"
 
 namespace iroha {
   namespace consensus {
@@ -36,25 +38,34 @@ namespace iroha {
 
       class YacCryptoProvider;
       class Timer;
+      class AdaptiveDelay;
 
       class Yac : public HashGate, public YacNetworkNotifications {
        public:
         /**
          * Method for creating Yac consensus object
          * @param delay for timer in milliseconds
+         * @param round_timer - collector of round stage timings, null if
+         * metrics are disabled
+         * @param vote_delay - estimator of the timer delay, which is fed with
+         * vote-to-commit latency of every round, may be null
          */
         static std::shared_ptr<Yac> create(
             YacVoteStorage vote_storage,
             std::shared_ptr<YacNetwork> network,
             std::shared_ptr<YacCryptoProvider> crypto,
             std::shared_ptr<Timer> timer,
-            ClusterOrdering order);
+            ClusterOrdering order,
+            std::shared_ptr<metrics::RoundTimer> round_timer = nullptr,
+            std::shared_ptr<AdaptiveDelay> vote_delay = nullptr);
 
         Yac(YacVoteStorage vote_storage,
             std::shared_ptr<YacNetwork> network,
             std::shared_ptr<YacCryptoProvider> crypto,
             std::shared_ptr<Timer> timer,
-            ClusterOrdering order);
+            ClusterOrdering order,
+            std::shared_ptr<metrics::RoundTimer> round_timer = nullptr,
+            std::shared_ptr<AdaptiveDelay> vote_delay = nullptr);
 
         // ------|Hash gate|------
 
@@ -112,6 +123,13 @@ namespace iroha {
                            std::shared_ptr<shared_model::interface::Peer>> from,
                        const VoteMessage &vote);
 
+        /**
+         * Account commit of the proposal for which supermajority is
+         * collected: report round stage and vote-to-commit latency
+         * @param proposal_hash - hash of the committed proposal
+         */
+        void onSupermajority(const std::string &proposal_hash);
+
         // ------|Propagation|------
         void propagateCommit(const CommitMessage &msg);
         void propagateCommitDirectly(const shared_model::interface::Peer &to,
@@ -127,10 +145,17 @@ namespace iroha {
         std::shared_ptr<Timer> timer_;
         rxcpp::subjects::subject<CommitMessage> notifier_;
         std::mutex mutex_;
+        std::shared_ptr<metrics::RoundTimer> round_timer_;
+        std::shared_ptr<AdaptiveDelay> vote_delay_;
 
         // ------|One round|------
         ClusterOrdering cluster_order_;
 
+        /// proposal hash of own vote and time when the vote was made
+        boost::optional<
+            std::pair<std::string, std::chrono::steady_clock::time_point>>
+            vote_started_;
+
         // ------|Logger|------
         logger::Logger log_;
       };
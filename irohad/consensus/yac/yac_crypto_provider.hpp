@@ -35,21 +35,21 @@ namespace iroha {
          * @param msg - for verification
          * @return true if signature correct
          */
-        virtual bool verify(CommitMessage msg) = 0;
+        virtual bool verify(const CommitMessage &msg) = 0;
 
         /**
          * Verify signatory of message
          * @param msg - for verification
          * @return true if signature correct
          */
-        virtual bool verify(RejectMessage msg) = 0;
+        virtual bool verify(const RejectMessage &msg) = 0;
 
         /**
          * Verify signatory of message
          * @param msg - for verification
          * @return true if signature correct
          */
-        virtual bool verify(VoteMessage msg) = 0;
+        virtual bool verify(const VoteMessage &msg) = 0;
 
         /**
          * Generate vote for provided hash;
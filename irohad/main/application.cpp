@@ -4,6 +4,7 @@
  */
 
 #include "main/application.hpp"
+#include "ametsuchi/impl/async_ordering_service_persistent_state.hpp"
 #include "ametsuchi/impl/postgres_ordering_service_persistent_state.hpp"
 #include "ametsuchi/impl/wsv_restorer_impl.hpp"
 #include "backend/protobuf/common_objects/proto_common_objects_factory.hpp"
@@ -41,7 +42,18 @@ Irohad::Irohad(const std::string &block_store_dir,
                std::chrono::milliseconds vote_delay,
                std::chrono::milliseconds load_delay,
                const shared_model::crypto::Keypair &keypair,
-               bool is_mst_supported)
+               bool is_mst_supported,
+               boost::optional<std::chrono::milliseconds> min_vote_delay,
+               boost::optional<std::chrono::milliseconds> max_vote_delay,
+               std::shared_ptr<iroha::metrics::MetricsSink> metrics_sink,
+               boost::optional<size_t> max_proposal_bytes,
+               boost::optional<std::chrono::milliseconds>
+                   proposal_target_latency,
+               bool rotating_ordering,
+               boost::optional<size_t> max_ordering_queue_size,
+               bool commit_validated_state,
+               size_t stateful_validation_threads,
+               bool in_memory_validation)
     : block_store_dir_(block_store_dir),
       pg_conn_(pg_conn),
       torii_port_(torii_port),
@@ -49,8 +61,19 @@ Irohad::Irohad(const std::string &block_store_dir,
       max_proposal_size_(max_proposal_size),
       proposal_delay_(proposal_delay),
       vote_delay_(vote_delay),
+      min_vote_delay_(min_vote_delay.value_or(vote_delay)),
+      max_vote_delay_(max_vote_delay.value_or(vote_delay)),
       load_delay_(load_delay),
       is_mst_supported_(is_mst_supported),
+      metrics_sink_(std::move(metrics_sink)),
+      max_proposal_bytes_(
+          max_proposal_bytes.value_or(std::numeric_limits<size_t>::max())),
+      proposal_target_latency_(proposal_target_latency),
+      rotating_ordering_(rotating_ordering),
+      max_ordering_queue_size_(max_ordering_queue_size),
+      commit_validated_state_(commit_validated_state),
+      stateful_validation_threads_(stateful_validation_threads),
+      in_memory_validation_(in_memory_validation),
       keypair(keypair) {
   log_ = logger::log("IROHAD");
   log_->info("created");
@@ -67,6 +90,7 @@ void Irohad::init() {
   initWsvRestorer();
   restoreWsv();
 
+  initMetrics();
   initCryptoProvider();
   initValidators();
   initOrderingGate();
@@ -98,7 +122,8 @@ void Irohad::initStorage() {
   auto factory =
       std::make_shared<shared_model::proto::ProtoCommonObjectsFactory<
           shared_model::validation::FieldValidator>>();
-  auto storageResult = StorageImpl::create(block_store_dir_, pg_conn_, factory);
+  auto storageResult = StorageImpl::create(
+      block_store_dir_, pg_conn_, factory, in_memory_validation_);
   storageResult.match(
       [&](expected::Value<std::shared_ptr<ametsuchi::StorageImpl>> &_storage) {
         storage = _storage.value;
@@ -108,7 +133,12 @@ void Irohad::initStorage() {
   PostgresOrderingServicePersistentState::create(pg_conn_).match(
       [&](expected::Value<
           std::shared_ptr<ametsuchi::PostgresOrderingServicePersistentState>>
-              &_storage) { ordering_service_storage_ = _storage.value; },
+              &_storage) {
+        // proposal height is written behind, not to delay proposals
+        ordering_service_storage_ =
+            std::make_shared<AsyncOrderingServicePersistentState>(
+                _storage.value);
+      },
       [&](expected::Error<std::string> &error) { log_->error(error.error); });
 
   log_->info("[Init] => storage", logger::logBool(storage));
@@ -131,6 +161,25 @@ bool Irohad::restoreWsv() {
 /**
  * Initializing peer query interface
  */
+void Irohad::initMetrics() {
+  auto round_sink = metrics_sink_;
+  if (proposal_target_latency_) {
+    // proposal sizing learns from round traces and passes them to the sink
+    adaptive_proposal_size_ =
+        std::make_shared<iroha::ordering::AdaptiveProposalSize>(
+            max_proposal_size_,
+            proposal_delay_,
+            *proposal_target_latency_,
+            metrics_sink_);
+    round_sink = adaptive_proposal_size_;
+  }
+  if (round_sink) {
+    round_timer_ = std::make_shared<iroha::metrics::RoundTimer>(round_sink);
+  }
+
+  log_->info("[Init] => round metrics - [{}]", logger::logBool(round_timer_));
+}
+
 std::unique_ptr<iroha::ametsuchi::PeerQuery> Irohad::initPeerQuery() {
   return std::make_unique<ametsuchi::PeerQueryWsv>(storage->getWsvQuery());
 }
@@ -151,8 +200,8 @@ void Irohad::initCryptoProvider() {
 void Irohad::initValidators() {
   auto factory = std::make_unique<shared_model::proto::ProtoProposalFactory<
       shared_model::validation::DefaultProposalValidator>>();
-  stateful_validator =
-      std::make_shared<StatefulValidatorImpl>(std::move(factory));
+  stateful_validator = std::make_shared<StatefulValidatorImpl>(
+      std::move(factory), storage, stateful_validation_threads_);
   chain_validator = std::make_shared<ChainValidatorImpl>(
       std::make_shared<consensus::yac::SupermajorityCheckerImpl>());
 
@@ -163,11 +212,22 @@ void Irohad::initValidators() {
  * Initializing ordering gate
  */
 void Irohad::initOrderingGate() {
+  // own key is needed to recognize own rounds in the schedule
+  boost::optional<shared_model::interface::types::PubkeyType> self_key;
+  if (rotating_ordering_) {
+    self_key = keypair.publicKey();
+  }
   ordering_gate = ordering_init.initOrderingGate(initPeerQuery(),
                                                  max_proposal_size_,
                                                  proposal_delay_,
                                                  ordering_service_storage_,
-                                                 storage->getBlockQuery());
+                                                 storage->getBlockQuery(),
+                                                 round_timer_,
+                                                 metrics_sink_,
+                                                 max_proposal_bytes_,
+                                                 adaptive_proposal_size_,
+                                                 self_key,
+                                                 max_ordering_queue_size_);
   log_->info("[Init] => init ordering gate - [{}]",
              logger::logBool(ordering_gate));
 }
@@ -176,11 +236,23 @@ void Irohad::initOrderingGate() {
  * Initializing iroha verified proposal creator and block creator
  */
 void Irohad::initSimulator() {
+  // parallel validation leaves changes of the proposal in several temporary
+  // wsv, so there is no single state to commit, and in-memory validation
+  // does not change the database at all
+  auto prepare_blocks = commit_validated_state_
+      and stateful_validation_threads_ <= 1 and not in_memory_validation_;
+  if (commit_validated_state_ and not prepare_blocks) {
+    log_->warn(
+        "commit of validated state is disabled by parallel or in-memory "
+        "stateful validation");
+  }
   simulator = std::make_shared<Simulator>(ordering_gate,
                                           stateful_validator,
                                           storage,
                                           storage->getBlockQuery(),
-                                          crypto_signer_);
+                                          crypto_signer_,
+                                          round_timer_,
+                                          prepare_blocks);
 
   log_->info("[Init] => init simulator");
 }
@@ -199,12 +271,15 @@ void Irohad::initBlockLoader() {
  * Initializing consensus gate
  */
 void Irohad::initConsensusGate() {
+  auto vote_delay = std::make_shared<AdaptiveDelay>(
+      vote_delay_, min_vote_delay_, max_vote_delay_, metrics_sink_);
   consensus_gate = yac_init.initConsensusGate(initPeerQuery(),
                                               simulator,
                                               block_loader,
                                               keypair,
-                                              vote_delay_,
-                                              load_delay_);
+                                              vote_delay,
+                                              load_delay_,
+                                              round_timer_);
 
   log_->info("[Init] => consensus gate");
 }
@@ -214,7 +289,7 @@ void Irohad::initConsensusGate() {
  */
 void Irohad::initSynchronizer() {
   synchronizer = std::make_shared<SynchronizerImpl>(
-      consensus_gate, chain_validator, storage, block_loader);
+      consensus_gate, chain_validator, storage, block_loader, round_timer_);
 
   log_->info("[Init] => synchronizer");
 }
@@ -275,7 +350,8 @@ void Irohad::initTransactionCommandService() {
                                                 storage,
                                                 status_bus_,
                                                 std::chrono::seconds(1),
-                                                2 * proposal_delay_);
+                                                2 * proposal_delay_,
+                                                ordering_init.ordering_load);
 
   log_->info("[Init] => command service");
 }
@@ -28,6 +28,8 @@
 #include "main/impl/consensus_init.hpp"
 #include "main/impl/ordering_init.hpp"
 #include "main/server_runner.hpp"
+#include "metrics/metrics_sink.hpp"
+#include "metrics/round_timer.hpp"
 #include "multi_sig_transactions/mst_processor.hpp"
 #include "network/block_loader.hpp"
 #include "network/consensus_gate.hpp"
@@ -70,6 +72,27 @@ class Irohad {
    * peer
    * @param keypair - public and private keys for crypto signer
    * @param is_mst_supported - enable or disable mst processing support
+   * @param min_vote_delay - lower bound of vote delay adapted to commit
+   * latency, vote_delay if not set
+   * @param max_vote_delay - upper bound of vote delay adapted to commit
+   * latency, vote_delay if not set
+   * @param metrics_sink - receiver of consensus round timings, metrics are
+   * not collected if null
+   * @param max_proposal_bytes - maximum size of transactions in one proposal,
+   * unlimited if not set
+   * @param proposal_target_latency - desired time from transaction arrival to
+   * commit, proposal size and delay are adapted to it if set
+   * @param rotating_ordering - whether proposals are created by ledger peers
+   * in turn, otherwise the first peer creates all of them
+   * @param max_ordering_queue_size - number of transactions queued by the
+   * ordering service, over which new transactions are rejected by Torii,
+   * capacity of the queue if not set
+   * @param commit_validated_state - whether blocks are committed from the
+   * state of their stateful validation instead of being applied again
+   * @param stateful_validation_threads - number of threads validating
+   * independent transactions of a proposal in parallel
+   * @param in_memory_validation - whether changes of stateful validation are
+   * kept in memory instead of the database
    */
   Irohad(const std::string &block_store_dir,
          const std::string &pg_conn,
@@ -80,7 +103,18 @@ class Irohad {
          std::chrono::milliseconds vote_delay,
          std::chrono::milliseconds load_delay,
          const shared_model::crypto::Keypair &keypair,
-         bool is_mst_supported);
+         bool is_mst_supported,
+         boost::optional<std::chrono::milliseconds> min_vote_delay = boost::none,
+         boost::optional<std::chrono::milliseconds> max_vote_delay = boost::none,
+         std::shared_ptr<iroha::metrics::MetricsSink> metrics_sink = nullptr,
+         boost::optional<size_t> max_proposal_bytes = boost::none,
+         boost::optional<std::chrono::milliseconds> proposal_target_latency =
+             boost::none,
+         bool rotating_ordering = false,
+         boost::optional<size_t> max_ordering_queue_size = boost::none,
+         bool commit_validated_state = false,
+         size_t stateful_validation_threads = 1,
+         bool in_memory_validation = false);
 
   /**
    * Initialization of whole objects in system
@@ -115,6 +149,8 @@ class Irohad {
 
   virtual void initStorage();
 
+  virtual void initMetrics();
+
   virtual std::unique_ptr<iroha::ametsuchi::PeerQuery> initPeerQuery();
 
   virtual void initCryptoProvider();
@@ -154,11 +190,28 @@ class Irohad {
   size_t max_proposal_size_;
   std::chrono::milliseconds proposal_delay_;
   std::chrono::milliseconds vote_delay_;
+  std::chrono::milliseconds min_vote_delay_;
+  std::chrono::milliseconds max_vote_delay_;
   std::chrono::milliseconds load_delay_;
   bool is_mst_supported_;
+  std::shared_ptr<iroha::metrics::MetricsSink> metrics_sink_;
+  size_t max_proposal_bytes_;
+  boost::optional<std::chrono::milliseconds> proposal_target_latency_;
+  bool rotating_ordering_;
+  boost::optional<size_t> max_ordering_queue_size_;
+  bool commit_validated_state_;
+  size_t stateful_validation_threads_;
+  bool in_memory_validation_;
 
   // ------------------------| internal dependencies |-------------------------
 
+  // consensus round timings, null if metrics are disabled
+  std::shared_ptr<iroha::metrics::RoundTimer> round_timer_;
+
+  // proposal size and delay, null if they are fixed
+  std::shared_ptr<iroha::ordering::AdaptiveProposalSize>
+      adaptive_proposal_size_;
+
   // crypto provider
   std::shared_ptr<shared_model::crypto::CryptoModelSigner<>> crypto_signer_;
 
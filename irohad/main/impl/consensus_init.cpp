@@ -45,8 +45,8 @@ namespace iroha {
         return crypto;
       }
 
-      auto YacInit::createTimer(std::chrono::milliseconds delay_milliseconds) {
-        return std::make_shared<TimerImpl>([delay_milliseconds] {
+      auto YacInit::createTimer(std::shared_ptr<AdaptiveDelay> delay) {
+        return std::make_shared<TimerImpl>([delay] {
           // static factory with a single thread
           //
           // observe_on_new_thread -- coordination which creates new thread with
@@ -70,8 +70,10 @@ namespace iroha {
               rxcpp::observe_on_new_thread()
                   .create_coordinator()
                   .get_scheduler());
-          return rxcpp::observable<>::timer(
-              std::chrono::milliseconds(delay_milliseconds), coordination);
+          //
+          // delay is requested on each invocation, since it is adapted to
+          // observed commit latency
+          return rxcpp::observable<>::timer(delay->current(), coordination);
         });
       }
 
@@ -82,12 +84,15 @@ namespace iroha {
       std::shared_ptr<consensus::yac::Yac> YacInit::createYac(
           ClusterOrdering initial_order,
           const shared_model::crypto::Keypair &keypair,
-          std::chrono::milliseconds delay_milliseconds) {
+          std::shared_ptr<AdaptiveDelay> vote_delay,
+          std::shared_ptr<metrics::RoundTimer> round_timer) {
         return Yac::create(YacVoteStorage(),
                            createNetwork(),
                            createCryptoProvider(keypair),
-                           createTimer(delay_milliseconds),
-                           initial_order);
+                           createTimer(vote_delay),
+                           initial_order,
+                           std::move(round_timer),
+                           vote_delay);
       }
 
       std::shared_ptr<YacGate> YacInit::initConsensusGate(
@@ -95,13 +100,15 @@ namespace iroha {
           std::shared_ptr<simulator::BlockCreator> block_creator,
           std::shared_ptr<network::BlockLoader> block_loader,
           const shared_model::crypto::Keypair &keypair,
-          std::chrono::milliseconds vote_delay_milliseconds,
-          std::chrono::milliseconds load_delay_milliseconds) {
+          std::shared_ptr<AdaptiveDelay> vote_delay,
+          std::chrono::milliseconds load_delay_milliseconds,
+          std::shared_ptr<metrics::RoundTimer> round_timer) {
         auto peer_orderer = createPeerOrderer(wsv);
 
         auto yac = createYac(peer_orderer->getInitialOrdering().value(),
                              keypair,
-                             vote_delay_milliseconds);
+                             std::move(vote_delay),
+                             std::move(round_timer));
         consensus_network->subscribe(yac);
 
         auto hash_provider = createHashProvider();
@@ -23,6 +23,7 @@
 #include <vector>
 
 #include "ametsuchi/peer_query.hpp"
+#include "consensus/yac/impl/adaptive_delay.hpp"
 #include "consensus/yac/messages.hpp"
 #include "consensus/yac/timer.hpp"
 #include "consensus/yac/transport/impl/network_impl.hpp"
@@ -31,6 +32,7 @@
 #include "consensus/yac/yac_hash_provider.hpp"
 #include "consensus/yac/yac_peer_orderer.hpp"
 #include "cryptography/keypair.hpp"
+#include "metrics/round_timer.hpp"
 #include "network/block_loader.hpp"
 #include "simulator/block_creator.hpp"
 
@@ -48,23 +50,33 @@ namespace iroha {
 
         auto createCryptoProvider(const shared_model::crypto::Keypair &keypair);
 
-        auto createTimer(std::chrono::milliseconds delay_milliseconds);
+        auto createTimer(std::shared_ptr<AdaptiveDelay> delay);
 
         auto createHashProvider();
 
         std::shared_ptr<consensus::yac::Yac> createYac(
             ClusterOrdering initial_order,
             const shared_model::crypto::Keypair &keypair,
-            std::chrono::milliseconds delay_milliseconds);
+            std::shared_ptr<AdaptiveDelay> vote_delay,
+            std::shared_ptr<metrics::RoundTimer> round_timer);
 
        public:
+        /**
+         * Initialize YAC and consensus gate on top of it
+         * @param vote_delay - delay before sending vote to the next peer,
+         * adapted to observed commit latency unless its bounds are equal
+         * @param load_delay_milliseconds - delay before loading committed
+         * block from other peers
+         * @param round_timer - collector of round stage timings, may be null
+         */
         std::shared_ptr<YacGate> initConsensusGate(
             std::shared_ptr<ametsuchi::PeerQuery> wsv,
             std::shared_ptr<simulator::BlockCreator> block_creator,
             std::shared_ptr<network::BlockLoader> block_loader,
             const shared_model::crypto::Keypair &keypair,
-            std::chrono::milliseconds vote_delay_milliseconds,
-            std::chrono::milliseconds load_delay_milliseconds);
+            std::shared_ptr<AdaptiveDelay> vote_delay,
+            std::chrono::milliseconds load_delay_milliseconds,
+            std::shared_ptr<metrics::RoundTimer> round_timer = nullptr);
 
         std::shared_ptr<NetworkImpl> consensus_network;
       };
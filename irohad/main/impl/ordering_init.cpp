@@ -11,16 +11,30 @@
 
 namespace iroha {
   namespace network {
+    constexpr std::chrono::minutes OrderingInit::kDuplicateBatchExpiration;
+    constexpr size_t OrderingInit::kCoalescingSize;
+    constexpr std::chrono::microseconds OrderingInit::kCoalescingDelay;
+    constexpr size_t OrderingInit::kRoundTimeoutInDelays;
+
     auto OrderingInit::createGate(
         std::shared_ptr<OrderingGateTransport> transport,
-        std::shared_ptr<ametsuchi::BlockQuery> block_query) {
+        std::shared_ptr<ametsuchi::BlockQuery> block_query,
+        std::shared_ptr<metrics::RoundTimer> round_timer,
+        std::shared_ptr<ordering::OrderingPeerRotation> rotation,
+        std::chrono::milliseconds round_timeout) {
       return block_query->getTopBlock().match(
-          [this, &transport](
+          [this, &transport, &round_timer, &rotation, &round_timeout](
               expected::Value<std::shared_ptr<shared_model::interface::Block>>
                   &block) -> std::shared_ptr<OrderingGate> {
             const auto &height = block.value->height();
-            auto gate =
-                std::make_shared<ordering::OrderingGateImpl>(transport, height);
+            auto gate = std::make_shared<ordering::OrderingGateImpl>(
+                transport,
+                height,
+                true,
+                std::move(round_timer),
+                std::move(rotation),
+                round_timeout,
+                block.value->createdTime());
             log_->info("Creating Ordering Gate with initial height {}", height);
             transport->subscribe(gate);
             return gate;
@@ -39,17 +53,43 @@ namespace iroha {
         std::chrono::milliseconds delay_milliseconds,
         std::shared_ptr<network::OrderingServiceTransport> transport,
         std::shared_ptr<ametsuchi::OrderingServicePersistentState>
-            persistent_state) {
+            persistent_state,
+        std::shared_ptr<metrics::MetricsSink> metrics_sink,
+        size_t max_bytes,
+        std::shared_ptr<ordering::AdaptiveProposalSize> adaptive_size,
+        std::shared_ptr<ordering::OrderingPeerRotation> rotation,
+        boost::optional<size_t> high_water_mark) {
+      using TimeoutType = ordering::OrderingServiceImpl::TimeoutType;
       auto factory = std::make_unique<shared_model::proto::ProtoProposalFactory<
           shared_model::validation::DefaultProposalValidator>>();
+      rxcpp::observable<TimeoutType> proposal_timeout =
+          rxcpp::observable<>::interval(delay_milliseconds,
+                                        rxcpp::observe_on_new_thread());
+      if (adaptive_size) {
+        // every timer is started with the delay which is current by then
+        proposal_timeout =
+            rxcpp::observable<>::defer([adaptive_size] {
+              return rxcpp::observable<>::timer(
+                  adaptive_size->delay(), rxcpp::observe_on_new_thread());
+            })
+                .repeat()
+                .map([](auto) { return TimeoutType{0}; });
+      }
       return std::make_shared<ordering::OrderingServiceImpl>(
           wsv,
           max_size,
-          rxcpp::observable<>::interval(delay_milliseconds,
-                                        rxcpp::observe_on_new_thread()),
+          proposal_timeout,
           transport,
           persistent_state,
-          std::move(factory));
+          std::move(factory),
+          true,
+          std::make_shared<ordering::DuplicateBatchFilter>(
+              kDuplicateBatchExpiration, metrics_sink),
+          max_bytes,
+          std::move(adaptive_size),
+          std::move(rotation),
+          high_water_mark,
+          metrics_sink);
     }
 
     std::shared_ptr<OrderingGate> OrderingInit::initOrderingGate(
@@ -58,27 +98,71 @@ namespace iroha {
         std::chrono::milliseconds delay_milliseconds,
         std::shared_ptr<ametsuchi::OrderingServicePersistentState>
             persistent_state,
-        std::shared_ptr<ametsuchi::BlockQuery> block_query) {
+        std::shared_ptr<ametsuchi::BlockQuery> block_query,
+        std::shared_ptr<metrics::RoundTimer> round_timer,
+        std::shared_ptr<metrics::MetricsSink> metrics_sink,
+        size_t max_bytes,
+        std::shared_ptr<ordering::AdaptiveProposalSize> adaptive_size,
+        boost::optional<shared_model::interface::types::PubkeyType>
+            self_key,
+        boost::optional<size_t> queue_high_water_mark) {
       auto ledger_peers = wsv->getLedgerPeers();
       if (not ledger_peers or ledger_peers.value().empty()) {
         log_->error(
             "Ledger don't have peers. Do you set correct genesis block?");
       }
+      std::shared_ptr<ordering::OrderingPeerRotation> rotation;
+      if (self_key) {
+        rotation = std::make_shared<ordering::OrderingPeerRotation>(
+            wsv, *self_key, block_query->getTopBlockHeight());
+        log_->info("Ordering peer changes every round");
+      }
+      // the first peer receives transactions if the rotation cannot tell
+      // the ordering peer
       auto network_address = ledger_peers->front()->address();
       log_->info("Ordering gate is at {}", network_address);
+      ordering_load = std::make_shared<OrderingLoad>();
       ordering_gate_transport =
           std::make_shared<iroha::ordering::OrderingGateTransportGrpc>(
-              network_address);
+              network_address,
+              rotation,
+              kCoalescingSize,
+              kCoalescingDelay,
+              ordering_load);
+
+      // the last saved heights could have been lost in a crash, when they
+      // are written behind, while their blocks are in the ledger
+      auto next_height = block_query->getTopBlockHeight() + 1;
+      auto saved_height = persistent_state->loadProposalHeight();
+      if (not rotation and saved_height and *saved_height < next_height) {
+        log_->warn("Proposal height {} is behind the ledger, restored to {}",
+                   *saved_height,
+                   next_height);
+        persistent_state->saveProposalHeight(next_height);
+      }
 
       ordering_service_transport =
-          std::make_shared<ordering::OrderingServiceTransportGrpc>();
+          std::make_shared<ordering::OrderingServiceTransportGrpc>(self_key);
       ordering_service = createService(wsv,
                                        max_size,
                                        delay_milliseconds,
                                        ordering_service_transport,
-                                       persistent_state);
+                                       persistent_state,
+                                       std::move(metrics_sink),
+                                       max_bytes,
+                                       std::move(adaptive_size),
+                                       rotation,
+                                       queue_high_water_mark);
       ordering_service_transport->subscribe(ordering_service);
-      ordering_gate = createGate(ordering_gate_transport, block_query);
+      // only the rotation skips a silent ordering peer, the fixed one has no
+      // replacement to move to
+      auto round_timeout = rotation ? delay_milliseconds * kRoundTimeoutInDelays
+                                    : std::chrono::milliseconds::zero();
+      ordering_gate = createGate(ordering_gate_transport,
+                                 block_query,
+                                 std::move(round_timer),
+                                 std::move(rotation),
+                                 round_timeout);
       return ordering_gate;
     }
   }  // namespace network
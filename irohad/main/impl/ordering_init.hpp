@@ -21,8 +21,12 @@
 #include "ametsuchi/block_query.hpp"
 #include "ametsuchi/peer_query.hpp"
 #include "logger/logger.hpp"
+#include "metrics/metrics_sink.hpp"
+#include "metrics/round_timer.hpp"
+#include "network/ordering_load.hpp"
 #include "ordering/impl/ordering_gate_impl.hpp"
 #include "ordering/impl/ordering_gate_transport_grpc.hpp"
+#include "ordering/impl/ordering_peer_rotation.hpp"
 #include "ordering/impl/ordering_service_impl.hpp"
 #include "ordering/impl/ordering_service_transport_grpc.hpp"
 
@@ -45,9 +49,16 @@ namespace iroha {
        * @param transport - object which will be notified
        * about incoming proposals and send transactions
        * @param block_query - block store to get last block height
+       * @param round_timer - collector of round stage timings
+       * @param rotation - schedule of ordering peers, may be null
+       * @param round_timeout - time without proposal after which the gate
+       * passes an empty one, zero to wait for the proposal forever
        */
       auto createGate(std::shared_ptr<OrderingGateTransport> transport,
-                      std::shared_ptr<ametsuchi::BlockQuery> block_query);
+                      std::shared_ptr<ametsuchi::BlockQuery> block_query,
+                      std::shared_ptr<metrics::RoundTimer> round_timer,
+                      std::shared_ptr<ordering::OrderingPeerRotation> rotation,
+                      std::chrono::milliseconds round_timeout);
 
       /**
        * Init ordering service
@@ -55,6 +66,13 @@ namespace iroha {
        * @param max_size - limitation of proposal size
        * @param delay_milliseconds - delay before emitting proposal
        * @param loop - handler of async events
+       * @param metrics_sink - receiver of the ordering service counters
+       * @param max_bytes - limit of proposal size in bytes
+       * @param adaptive_size - source of proposal size and delay, which
+       * replace max_size and delay_milliseconds, may be null
+       * @param rotation - schedule of ordering peers, may be null
+       * @param high_water_mark - number of queued transactions, over which
+       * batches are rejected
        */
       auto createService(
           std::shared_ptr<ametsuchi::PeerQuery> wsv,
@@ -62,7 +80,12 @@ namespace iroha {
           std::chrono::milliseconds delay_milliseconds,
           std::shared_ptr<network::OrderingServiceTransport> transport,
           std::shared_ptr<ametsuchi::OrderingServicePersistentState>
-              persistent_state);
+              persistent_state,
+          std::shared_ptr<metrics::MetricsSink> metrics_sink,
+          size_t max_bytes,
+          std::shared_ptr<ordering::AdaptiveProposalSize> adaptive_size,
+          std::shared_ptr<ordering::OrderingPeerRotation> rotation,
+          boost::optional<size_t> high_water_mark);
 
      public:
       /**
@@ -72,6 +95,20 @@ namespace iroha {
        * @param max_size - limitation of proposal size
        * @param delay_milliseconds - delay before emitting proposal
        * @param block_query - block store to get last block height
+       * @param round_timer - collector of round stage timings, null if
+       * metrics are disabled
+       * @param metrics_sink - receiver of the ordering service counters, may
+       * be null
+       * @param max_bytes - limit of proposal size in bytes
+       * @param adaptive_size - source of proposal size and delay, which
+       * replace max_size and delay_milliseconds, may be null
+       * @param self_key - public key of this peer, if it is set the ordering
+       * peer changes every round, and a silent one is skipped with an empty
+       * block after kRoundTimeoutInDelays proposal delays, otherwise the
+       * first ledger peer orders all transactions
+       * @param queue_high_water_mark - number of transactions queued by the
+       * ordering service, over which it is overloaded, capacity of the queue
+       * if not set
        * @return efficient implementation of OrderingGate
        */
       std::shared_ptr<iroha::network::OrderingGate> initOrderingGate(
@@ -80,7 +117,26 @@ namespace iroha {
           std::chrono::milliseconds delay_milliseconds,
           std::shared_ptr<ametsuchi::OrderingServicePersistentState>
               persistent_state,
-          std::shared_ptr<ametsuchi::BlockQuery> block_query);
+          std::shared_ptr<ametsuchi::BlockQuery> block_query,
+          std::shared_ptr<metrics::RoundTimer> round_timer = nullptr,
+          std::shared_ptr<metrics::MetricsSink> metrics_sink = nullptr,
+          size_t max_bytes = std::numeric_limits<size_t>::max(),
+          std::shared_ptr<ordering::AdaptiveProposalSize> adaptive_size =
+              nullptr,
+          boost::optional<shared_model::interface::types::PubkeyType>
+              self_key = boost::none,
+          boost::optional<size_t> queue_high_water_mark = boost::none);
+
+      /// time to remember batches which have been received or proposed
+      static constexpr std::chrono::minutes kDuplicateBatchExpiration{5};
+
+      /// number of transactions sent to the ordering service in one message
+      static constexpr size_t kCoalescingSize = 100;
+      /// time a transaction may wait for others before it is sent
+      static constexpr std::chrono::microseconds kCoalescingDelay{500};
+      /// number of proposal delays without a proposal, after which the gate
+      /// passes an empty proposal, so that the next peer orders transactions
+      static constexpr size_t kRoundTimeoutInDelays = 10;
 
       std::shared_ptr<iroha::network::OrderingService> ordering_service;
       std::shared_ptr<iroha::network::OrderingGate> ordering_gate;
@@ -88,6 +144,8 @@ namespace iroha {
           ordering_gate_transport;
       std::shared_ptr<ordering::OrderingServiceTransportGrpc>
           ordering_service_transport;
+      /// overload state of the ordering service reported to this peer
+      std::shared_ptr<OrderingLoad> ordering_load;
 
      protected:
       logger::Logger log_ = logger::log("OrderingInit");
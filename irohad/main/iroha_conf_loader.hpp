@@ -37,6 +37,16 @@ namespace config_members {
   const char *VoteDelay = "vote_delay";
   const char *LoadDelay = "load_delay";
   const char *MstSupport = "mst_enable";
+  const char *RoundMetrics = "round_metrics";
+  const char *MinVoteDelay = "min_vote_delay";
+  const char *MaxVoteDelay = "max_vote_delay";
+  const char *MaxProposalBytes = "max_proposal_bytes";
+  const char *ProposalTargetLatency = "proposal_target_latency";
+  const char *RotatingOrdering = "rotating_ordering";
+  const char *MaxOrderingQueueSize = "max_ordering_queue_size";
+  const char *CommitValidatedState = "commit_validated_state";
+  const char *StatefulValidationThreads = "stateful_validation_threads";
+  const char *InMemoryValidation = "in_memory_validation";
 }  // namespace config_members
 
 /**
@@ -52,6 +62,7 @@ inline rapidjson::Document parse_iroha_config(const std::string &conf_path) {
   rapidjson::IStreamWrapper isw(ifs_iroha);
   const std::string kStrType = "string";
   const std::string kUintType = "uint";
+  const std::string kPositiveUintType = "positive uint";
   const std::string kBoolType = "bool";
   doc.ParseStream(isw);
   ac::assert_fatal(
@@ -102,6 +113,50 @@ inline rapidjson::Document parse_iroha_config(const std::string &conf_path) {
                    ac::no_member_error(mbr::MstSupport));
   ac::assert_fatal(doc[mbr::MstSupport].IsBool(),
                    ac::type_error(mbr::MstSupport, kBoolType));
+
+  // optional members
+  ac::assert_fatal(
+      not doc.HasMember(mbr::RoundMetrics) or doc[mbr::RoundMetrics].IsBool(),
+      ac::type_error(mbr::RoundMetrics, kBoolType));
+
+  ac::assert_fatal(
+      not doc.HasMember(mbr::MinVoteDelay) or doc[mbr::MinVoteDelay].IsUint(),
+      ac::type_error(mbr::MinVoteDelay, kUintType));
+
+  ac::assert_fatal(
+      not doc.HasMember(mbr::MaxVoteDelay) or doc[mbr::MaxVoteDelay].IsUint(),
+      ac::type_error(mbr::MaxVoteDelay, kUintType));
+
+  ac::assert_fatal(not doc.HasMember(mbr::MaxProposalBytes)
+                       or doc[mbr::MaxProposalBytes].IsUint(),
+                   ac::type_error(mbr::MaxProposalBytes, kUintType));
+
+  ac::assert_fatal(not doc.HasMember(mbr::ProposalTargetLatency)
+                       or doc[mbr::ProposalTargetLatency].IsUint(),
+                   ac::type_error(mbr::ProposalTargetLatency, kUintType));
+
+  ac::assert_fatal(not doc.HasMember(mbr::RotatingOrdering)
+                       or doc[mbr::RotatingOrdering].IsBool(),
+                   ac::type_error(mbr::RotatingOrdering, kBoolType));
+
+  // the service would reject every batch with zero size
+  ac::assert_fatal(not doc.HasMember(mbr::MaxOrderingQueueSize)
+                       or (doc[mbr::MaxOrderingQueueSize].IsUint()
+                           and doc[mbr::MaxOrderingQueueSize].GetUint() > 0),
+                   ac::type_error(mbr::MaxOrderingQueueSize,
+                                  kPositiveUintType));
+
+  ac::assert_fatal(not doc.HasMember(mbr::CommitValidatedState)
+                       or doc[mbr::CommitValidatedState].IsBool(),
+                   ac::type_error(mbr::CommitValidatedState, kBoolType));
+
+  ac::assert_fatal(not doc.HasMember(mbr::StatefulValidationThreads)
+                       or doc[mbr::StatefulValidationThreads].IsUint(),
+                   ac::type_error(mbr::StatefulValidationThreads, kUintType));
+
+  ac::assert_fatal(not doc.HasMember(mbr::InMemoryValidation)
+                       or doc[mbr::InMemoryValidation].IsBool(),
+                   ac::type_error(mbr::InMemoryValidation, kBoolType));
   return doc;
 }
 
@@ -25,6 +25,7 @@
 #include "main/application.hpp"
 #include "main/iroha_conf_loader.hpp"
 #include "main/raw_block_loader.hpp"
+#include "metrics/impl/log_metrics_sink.hpp"
 
 /**
  * Gflag validator.
@@ -112,6 +113,46 @@ int main(int argc, char *argv[]) {
     return EXIT_FAILURE;
   }
 
+  // Consensus round timings are written to the log if enabled
+  std::shared_ptr<iroha::metrics::MetricsSink> metrics_sink;
+  if (config.HasMember(mbr::RoundMetrics)
+      and config[mbr::RoundMetrics].GetBool()) {
+    metrics_sink = std::make_shared<iroha::metrics::LogMetricsSink>();
+  }
+
+  // Optional delays and latencies are given in milliseconds
+  auto optional_delay = [&config](const char *member)
+      -> boost::optional<std::chrono::milliseconds> {
+    if (config.HasMember(member)) {
+      return std::chrono::milliseconds(config[member].GetUint());
+    }
+    return boost::none;
+  };
+
+  boost::optional<size_t> max_proposal_bytes;
+  if (config.HasMember(mbr::MaxProposalBytes)) {
+    max_proposal_bytes = config[mbr::MaxProposalBytes].GetUint();
+  }
+
+  auto rotating_ordering = config.HasMember(mbr::RotatingOrdering)
+      and config[mbr::RotatingOrdering].GetBool();
+
+  boost::optional<size_t> max_ordering_queue_size;
+  if (config.HasMember(mbr::MaxOrderingQueueSize)) {
+    max_ordering_queue_size = config[mbr::MaxOrderingQueueSize].GetUint();
+  }
+
+  auto commit_validated_state = config.HasMember(mbr::CommitValidatedState)
+      and config[mbr::CommitValidatedState].GetBool();
+
+  size_t stateful_validation_threads =
+      config.HasMember(mbr::StatefulValidationThreads)
+      ? config[mbr::StatefulValidationThreads].GetUint()
+      : 1;
+
+  auto in_memory_validation = config.HasMember(mbr::InMemoryValidation)
+      and config[mbr::InMemoryValidation].GetBool();
+
   // Configuring iroha daemon
   Irohad irohad(config[mbr::BlockStorePath].GetString(),
                 config[mbr::PgOpt].GetString(),
@@ -122,7 +163,17 @@ int main(int argc, char *argv[]) {
                 std::chrono::milliseconds(config[mbr::VoteDelay].GetUint()),
                 std::chrono::milliseconds(config[mbr::LoadDelay].GetUint()),
                 *keypair,
-                config[mbr::MstSupport].GetBool());
+                config[mbr::MstSupport].GetBool(),
+                optional_delay(mbr::MinVoteDelay),
+                optional_delay(mbr::MaxVoteDelay),
+                metrics_sink,
+                max_proposal_bytes,
+                optional_delay(mbr::ProposalTargetLatency),
+                rotating_ordering,
+                max_ordering_queue_size,
+                commit_validated_state,
+                stateful_validation_threads,
+                in_memory_validation);
 
   // Check if iroha daemon storage was successfully initialized
   if (not irohad.storage) {
@@ -19,6 +19,8 @@
 
 #include <boost/format.hpp>
 
+#include "network/impl/grpc_channel_builder.hpp"
+
 const auto kPortBindError = "Cannot bind server to address %s";
 
 ServerRunner::ServerRunner(const std::string &address, bool reuse)
@@ -48,6 +50,12 @@ iroha::expected::Result<int, std::string> ServerRunner::run() {
   builder.SetMaxReceiveMessageSize(INT_MAX);
   builder.SetMaxSendMessageSize(INT_MAX);
 
+  // accept pings of idle clients created by network::createKeepAliveClient
+  builder.AddChannelArgument(GRPC_ARG_KEEPALIVE_PERMIT_WITHOUT_CALLS, 1);
+  builder.AddChannelArgument(
+      GRPC_ARG_HTTP2_MIN_RECV_PING_INTERVAL_WITHOUT_DATA_MS,
+      iroha::network::kKeepAliveTimeMs);
+
   serverInstance_ = builder.BuildAndStart();
   serverInstanceCV_.notify_one();
 
@@ -0,0 +1,69 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "metrics/latency_histogram.hpp"
+
+#include <algorithm>
+
+namespace iroha {
+  namespace metrics {
+
+    constexpr size_t LatencyHistogram::kBucketsCount;
+
+    LatencyHistogram::LatencyHistogram() : count_(0), sum_(0) {
+      for (auto &bucket : buckets_) {
+        bucket.store(0, std::memory_order_relaxed);
+      }
+    }
+
+    void LatencyHistogram::record(Duration value) {
+      auto micros =
+          static_cast<uint64_t>(std::max<Duration::rep>(value.count(), 0));
+      // index of the highest set bit plus one, so 0 -> 0, 1 -> 1, 2..3 -> 2
+      size_t index = 0;
+      while (micros >> index and index < kBucketsCount - 1) {
+        ++index;
+      }
+      buckets_[index].fetch_add(1, std::memory_order_relaxed);
+      count_.fetch_add(1, std::memory_order_relaxed);
+      sum_.fetch_add(micros, std::memory_order_relaxed);
+    }
+
+    uint64_t LatencyHistogram::count() const {
+      return count_.load(std::memory_order_relaxed);
+    }
+
+    LatencyHistogram::Duration LatencyHistogram::sum() const {
+      return Duration(sum_.load(std::memory_order_relaxed));
+    }
+
+    uint64_t LatencyHistogram::bucket(size_t index) const {
+      return buckets_.at(index).load(std::memory_order_relaxed);
+    }
+
+    LatencyHistogram::Duration LatencyHistogram::upperBound(size_t index) {
+      return Duration(Duration::rep(1) << index);
+    }
+
+    LatencyHistogram::Duration LatencyHistogram::percentile(
+        double percentile) const {
+      auto total = count();
+      if (total == 0) {
+        return Duration::zero();
+      }
+      auto rank =
+          std::min(static_cast<uint64_t>(percentile * total), total - 1);
+      uint64_t seen = 0;
+      for (size_t i = 0; i < kBucketsCount; ++i) {
+        seen += bucket(i);
+        if (seen > rank) {
+          return upperBound(i);
+        }
+      }
+      return upperBound(kBucketsCount - 1);
+    }
+
+  }  // namespace metrics
+}  // namespace iroha
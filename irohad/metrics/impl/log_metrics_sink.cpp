@@ -0,0 +1,45 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "metrics/impl/log_metrics_sink.hpp"
+
+namespace iroha {
+  namespace metrics {
+
+    LogMetricsSink::LogMetricsSink() : log_(logger::log("Metrics")) {}
+
+    void LogMetricsSink::onRoundTrace(const RoundTrace &trace) {
+      const auto &begin = trace.at(RoundStage::kProposalReceived);
+      std::string stages;
+      for (size_t i = 0; i < kRoundStagesCount; ++i) {
+        const auto &reached_at = trace.stages[i];
+        if (not reached_at) {
+          continue;
+        }
+        stages += " ";
+        stages += stageName(static_cast<RoundStage>(i));
+        stages += "=";
+        stages += begin
+            ? std::to_string(std::chrono::duration_cast<
+                                 std::chrono::microseconds>(*reached_at
+                                                            - *begin)
+                                 .count())
+                + "us"
+            : "?";
+      }
+      log_->info("round {}:{}", trace.height, stages);
+    }
+
+    void LogMetricsSink::onGauge(const std::string &name, int64_t value) {
+      log_->info("{} = {}", name, value);
+    }
+
+    void LogMetricsSink::onCounter(const std::string &name,
+                                   int64_t increment) {
+      log_->info("{} += {}", name, increment);
+    }
+
+  }  // namespace metrics
+}  // namespace iroha
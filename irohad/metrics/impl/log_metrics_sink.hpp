@@ -0,0 +1,36 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_LOG_METRICS_SINK_HPP
+#define IROHA_LOG_METRICS_SINK_HPP
+
+#include "metrics/metrics_sink.hpp"
+
+#include "logger/logger.hpp"
+
+namespace iroha {
+  namespace metrics {
+
+    /**
+     * Sink which writes metrics to the log
+     */
+    class LogMetricsSink : public MetricsSink {
+     public:
+      LogMetricsSink();
+
+      void onRoundTrace(const RoundTrace &trace) override;
+
+      void onGauge(const std::string &name, int64_t value) override;
+
+      void onCounter(const std::string &name, int64_t increment) override;
+
+     private:
+      logger::Logger log_;
+    };
+
+  }  // namespace metrics
+}  // namespace iroha
+
+#endif  // IROHA_LOG_METRICS_SINK_HPP
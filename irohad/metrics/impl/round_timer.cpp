@@ -0,0 +1,94 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "metrics/round_timer.hpp"
+
+namespace iroha {
+  namespace metrics {
+
+    RoundTimer::RoundTimer(std::shared_ptr<MetricsSink> sink,
+                           std::function<Clock::time_point()> clock)
+        : sink_(std::move(sink)), clock_(std::move(clock)) {}
+
+    void RoundTimer::mark(RoundStage stage,
+                          shared_model::interface::types::HeightType height) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (stage == RoundStage::kProposalReceived) {
+        if (current_round_ and current_round_->height == height) {
+          // proposal for the same round is received again
+          return;
+        }
+        if (current_round_) {
+          // previous round was not committed, report it as is
+          finishRound();
+        }
+        current_round_ = RoundTrace{height, {}};
+      } else if (not current_round_
+                 or (current_round_->height != height
+                     // commit of a newer block closes the current round
+                     and not(stage == RoundStage::kCommitApplied
+                             and height > current_round_->height))) {
+        return;
+      }
+      markLocked(stage);
+    }
+
+    void RoundTimer::mark(RoundStage stage) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (not current_round_) {
+        return;
+      }
+      markLocked(stage);
+    }
+
+    const LatencyHistogram &RoundTimer::stageLatency(RoundStage stage) const {
+      return stage_latency_[static_cast<size_t>(stage)];
+    }
+
+    const LatencyHistogram &RoundTimer::roundLatency() const {
+      return round_latency_;
+    }
+
+    void RoundTimer::markLocked(RoundStage stage) {
+      auto &reached_at = current_round_->stages[static_cast<size_t>(stage)];
+      if (not reached_at) {
+        reached_at = clock_();
+      }
+      if (stage == RoundStage::kCommitApplied) {
+        finishRound();
+      }
+    }
+
+    void RoundTimer::finishRound() {
+      const auto &stages = current_round_->stages;
+      boost::optional<Clock::time_point> previous;
+      for (size_t i = 0; i < kRoundStagesCount; ++i) {
+        if (not stages[i]) {
+          continue;
+        }
+        if (previous) {
+          stage_latency_[i].record(
+              std::chrono::duration_cast<LatencyHistogram::Duration>(
+                  *stages[i] - *previous));
+        }
+        previous = stages[i];
+      }
+
+      const auto &begin = current_round_->at(RoundStage::kProposalReceived);
+      const auto &end = current_round_->at(RoundStage::kCommitApplied);
+      if (begin and end) {
+        round_latency_.record(
+            std::chrono::duration_cast<LatencyHistogram::Duration>(*end
+                                                                   - *begin));
+      }
+
+      if (sink_) {
+        sink_->onRoundTrace(*current_round_);
+      }
+      current_round_ = boost::none;
+    }
+
+  }  // namespace metrics
+}  // namespace iroha
@@ -0,0 +1,73 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_LATENCY_HISTOGRAM_HPP
+#define IROHA_LATENCY_HISTOGRAM_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+
+namespace iroha {
+  namespace metrics {
+
+    /**
+     * Lock-free histogram of durations with exponential buckets:
+     * bucket i holds values in [2^(i-1), 2^i) microseconds, bucket 0 holds
+     * values below 1 microsecond, the last bucket holds everything above
+     */
+    class LatencyHistogram {
+     public:
+      using Duration = std::chrono::microseconds;
+
+      static constexpr size_t kBucketsCount = 32;
+
+      LatencyHistogram();
+
+      /**
+       * Add single observation
+       * @param value - observed duration
+       */
+      void record(Duration value);
+
+      /**
+       * @return total number of observations
+       */
+      uint64_t count() const;
+
+      /**
+       * @return sum of all observed durations
+       */
+      Duration sum() const;
+
+      /**
+       * @param index - bucket index, less than kBucketsCount
+       * @return number of observations in the bucket
+       */
+      uint64_t bucket(size_t index) const;
+
+      /**
+       * @param index - bucket index, less than kBucketsCount
+       * @return exclusive upper bound of the bucket
+       */
+      static Duration upperBound(size_t index);
+
+      /**
+       * Estimate percentile by the upper bound of the bucket it falls into
+       * @param percentile - value in range [0, 1]
+       * @return estimated duration, zero if histogram is empty
+       */
+      Duration percentile(double percentile) const;
+
+     private:
+      std::array<std::atomic<uint64_t>, kBucketsCount> buckets_;
+      std::atomic<uint64_t> count_;
+      std::atomic<uint64_t> sum_;
+    };
+
+  }  // namespace metrics
+}  // namespace iroha
+
+#endif  // IROHA_LATENCY_HISTOGRAM_HPP
@@ -0,0 +1,48 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_METRICS_SINK_HPP
+#define IROHA_METRICS_SINK_HPP
+
+#include <string>
+
+#include "metrics/round_trace.hpp"
+
+namespace iroha {
+  namespace metrics {
+
+    /**
+     * Destination of collected metrics, e.g. log or external monitoring
+     * system. Methods can be invoked from different threads.
+     */
+    class MetricsSink {
+     public:
+      /**
+       * Called once per round when the round is finished
+       * @param trace - timestamps of the round stages
+       */
+      virtual void onRoundTrace(const RoundTrace &trace) = 0;
+
+      /**
+       * Called when a value which can go up and down is changed
+       * @param name - name of the value
+       * @param value - current value
+       */
+      virtual void onGauge(const std::string &name, int64_t value) = 0;
+
+      /**
+       * Called when a value which only grows is increased
+       * @param name - name of the value
+       * @param increment - amount the value is increased by
+       */
+      virtual void onCounter(const std::string &name, int64_t increment) = 0;
+
+      virtual ~MetricsSink() = default;
+    };
+
+  }  // namespace metrics
+}  // namespace iroha
+
+#endif  // IROHA_METRICS_SINK_HPP
@@ -0,0 +1,99 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_ROUND_TIMER_HPP
+#define IROHA_ROUND_TIMER_HPP
+
+#include <functional>
+#include <memory>
+#include <mutex>
+
+#include "metrics/latency_histogram.hpp"
+#include "metrics/metrics_sink.hpp"
+#include "metrics/round_trace.hpp"
+
+namespace iroha {
+  namespace metrics {
+
+    /**
+     * Collects timestamps of consensus round stages reported by pipeline
+     * components. Round is opened by kProposalReceived and closed by
+     * kCommitApplied; at this point the latency of each stage relative to the
+     * previous reached one is added to the per-stage histogram and the trace
+     * is passed to the sink.
+     *
+     * Components hold the timer by shared_ptr which is null when metrics are
+     * disabled, so disabled instrumentation costs only a pointer check.
+     */
+    class RoundTimer {
+     public:
+      /**
+       * @param sink - receiver of finished round traces
+       * @param clock - source of time, steady clock by default
+       */
+      explicit RoundTimer(
+          std::shared_ptr<MetricsSink> sink,
+          std::function<Clock::time_point()> clock = Clock::now);
+
+      /**
+       * Report the stage of the round with the given height.
+       * kProposalReceived opens a new round; other stages are ignored if
+       * they do not belong to the current round
+       * @param stage - reached stage
+       * @param height - height of the round
+       */
+      void mark(RoundStage stage,
+                shared_model::interface::types::HeightType height);
+
+      /**
+       * Report the stage of the current round. Used by components which are
+       * not aware of the round height, e.g. YAC, which operates on hashes
+       * @param stage - reached stage
+       */
+      void mark(RoundStage stage);
+
+      /**
+       * @param stage - stage of the round
+       * @return histogram of time spent between previous stage and this one
+       */
+      const LatencyHistogram &stageLatency(RoundStage stage) const;
+
+      /**
+       * @return histogram of time between proposal arrival and commit
+       */
+      const LatencyHistogram &roundLatency() const;
+
+     private:
+      void markLocked(RoundStage stage);
+
+      void finishRound();
+
+      std::shared_ptr<MetricsSink> sink_;
+      std::function<Clock::time_point()> clock_;
+
+      std::mutex mutex_;
+      boost::optional<RoundTrace> current_round_;
+
+      std::array<LatencyHistogram, kRoundStagesCount> stage_latency_;
+      LatencyHistogram round_latency_;
+    };
+
+    /**
+     * Report the stage if timer is present
+     * @param timer - round timer, possibly null
+     * @param args - forwarded to RoundTimer::mark
+     */
+    template <typename... Args>
+    inline void markStage(const std::shared_ptr<RoundTimer> &timer,
+                          Args &&... args) {
+      if (timer) {
+        timer->mark(std::forward<Args>(args)...);
+      }
+    }
+
+  }  // namespace metrics
+}  // namespace iroha
+
+#endif  // IROHA_ROUND_TIMER_HPP
@@ -0,0 +1,75 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_ROUND_TRACE_HPP
+#define IROHA_ROUND_TRACE_HPP
+
+#include <array>
+#include <chrono>
+
+#include <boost/optional.hpp>
+
+#include "interfaces/common_objects/types.hpp"
+
+namespace iroha {
+  namespace metrics {
+
+    /**
+     * Stages of a single consensus round in the order they happen on a peer
+     */
+    enum class RoundStage : size_t {
+      kProposalReceived,
+      kValidationStarted,
+      kValidationFinished,
+      kBlockSigned,
+      kFirstVoteSent,
+      kSupermajorityReached,
+      kCommitApplied
+    };
+
+    /// number of values in RoundStage
+    constexpr size_t kRoundStagesCount =
+        static_cast<size_t>(RoundStage::kCommitApplied) + 1;
+
+    /**
+     * Human-readable stage name
+     * @param stage - stage of the round
+     * @return name of the stage
+     */
+    inline const char *stageName(RoundStage stage) {
+      static const char *kNames[kRoundStagesCount] = {"proposal_received",
+                                                      "validation_started",
+                                                      "validation_finished",
+                                                      "block_signed",
+                                                      "first_vote_sent",
+                                                      "supermajority_reached",
+                                                      "commit_applied"};
+      return kNames[static_cast<size_t>(stage)];
+    }
+
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * Timestamps of every stage observed during one round
+     */
+    struct RoundTrace {
+      /// height of the proposal which opened the round
+      shared_model::interface::types::HeightType height;
+
+      /// time when the stage was first reached, none if it was not reached
+      std::array<boost::optional<Clock::time_point>, kRoundStagesCount> stages;
+
+      /**
+       * @return time point of the given stage, if it was reached
+       */
+      const boost::optional<Clock::time_point> &at(RoundStage stage) const {
+        return stages[static_cast<size_t>(stage)];
+      }
+    };
+
+  }  // namespace metrics
+}  // namespace iroha
+
+#endif  // IROHA_ROUND_TRACE_HPP
@@ -36,6 +36,8 @@ namespace iroha {
         MST_EXPIRED,
         /// transaction is not in handler map
         NOT_RECEIVED,
+        /// transaction is rejected, because the peer is overloaded
+        OVERLOADED,
       };
 
       Status current_status{};
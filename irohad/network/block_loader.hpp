@@ -25,6 +25,10 @@
 #include "interfaces/common_objects/types.hpp"
 #include "interfaces/iroha_internal/block.hpp"
 
+namespace grpc {
+  class ClientContext;
+}
+
 namespace iroha {
   namespace network {
     /**
@@ -52,6 +56,19 @@ namespace iroha {
           const shared_model::crypto::PublicKey &peer_pubkey,
           const shared_model::interface::types::HashType &block_hash) = 0;
 
+      /**
+       * Retrieve block by its block_hash from given peer. The request is
+       * stopped, when it is cancelled through the context from another thread
+       * @param peer_pubkey - peer for requesting blocks
+       * @param block_hash - requested block hash
+       * @param context - context of the request
+       * @return block on success, nullopt on failure or cancellation
+       */
+      virtual boost::optional<std::shared_ptr<shared_model::interface::Block>>
+      retrieveBlock(const shared_model::crypto::PublicKey &peer_pubkey,
+                    const shared_model::interface::types::HashType &block_hash,
+                    grpc::ClientContext &context) = 0;
+
       virtual ~BlockLoader() = default;
     };
   }  // namespace network
@@ -20,7 +20,6 @@
 #include <grpc++/create_channel.h>
 
 #include "backend/protobuf/block.hpp"
-#include "builders/protobuf/transport_builder.hpp"
 #include "interfaces/common_objects/peer.hpp"
 #include "network/impl/grpc_channel_builder.hpp"
 #include "validators/default_validator.hpp"
@@ -84,32 +83,30 @@ rxcpp::observable<std::shared_ptr<Block>> BlockLoaderImpl::retrieveBlocks(
 
         proto::BlocksRequest request;
         grpc::ClientContext context;
-        protocol::Block block;
 
         // request next block to our top
         request.set_height(top_block->height() + 1);
 
         auto reader =
             this->getPeerStub(**peer).retrieveBlocks(&context, request);
-        while (reader->Read(&block)) {
-          shared_model::proto::TransportBuilder<shared_model::proto::Block,
-                                                Validator>(
-              Validator(TimerWrapper(block.payload().created_time())))
-              .build(block)
-              .match(
-                  // success case
-                  [&subscriber](iroha::expected::Value<shared_model::proto::Block>
-                          &result) {
-                    subscriber.on_next(
-                        std::move(std::make_shared<shared_model::proto::Block>(
-                            std::move(result.value))));
-                  },
-                  // fail case
-                  [this,
-                   &context](iroha::expected::Error<std::string> &error) {
-                    log_->error(error.error);
-                    context.TryCancel();
-                  });
+        while (true) {
+          // every block is parsed into an arena, which its model owns
+          auto arena = std::make_shared<google::protobuf::Arena>();
+          auto block = google::protobuf::Arena::CreateMessage<protocol::Block>(
+              arena.get());
+          if (not reader->Read(block)) {
+            break;
+          }
+          auto result = std::make_shared<shared_model::proto::Block>(
+              std::move(arena), block, std::vector<types::HashType>{});
+          auto answer =
+              Validator(TimerWrapper(result->createdTime())).validate(*result);
+          if (answer.hasErrors()) {
+            log_->error(answer.reason());
+            context.TryCancel();
+            continue;
+          }
+          subscriber.on_next(std::move(result));
         }
         reader->Finish();
         subscriber.on_completed();
@@ -118,6 +115,14 @@ rxcpp::observable<std::shared_ptr<Block>> BlockLoaderImpl::retrieveBlocks(
 
 boost::optional<std::shared_ptr<Block>> BlockLoaderImpl::retrieveBlock(
     const PublicKey &peer_pubkey, const types::HashType &block_hash) {
+  grpc::ClientContext context;
+  return retrieveBlock(peer_pubkey, block_hash, context);
+}
+
+boost::optional<std::shared_ptr<Block>> BlockLoaderImpl::retrieveBlock(
+    const PublicKey &peer_pubkey,
+    const types::HashType &block_hash,
+    grpc::ClientContext &context) {
   auto peer = findPeer(peer_pubkey);
   if (not peer) {
     log_->error(kPeerNotFound);
@@ -125,20 +130,22 @@ boost::optional<std::shared_ptr<Block>> BlockLoaderImpl::retrieveBlock(
   }
 
   proto::BlockRequest request;
-  grpc::ClientContext context;
-  protocol::Block block;
+  auto arena = std::make_shared<google::protobuf::Arena>();
+  auto block =
+      google::protobuf::Arena::CreateMessage<protocol::Block>(arena.get());
 
   // request block with specified hash
   request.set_hash(toBinaryString(block_hash));
 
-  auto status = getPeerStub(**peer).retrieveBlock(&context, request, &block);
+  auto status = getPeerStub(**peer).retrieveBlock(&context, request, block);
   if (not status.ok()) {
     log_->warn(status.error_message());
     return boost::none;
   }
 
-  // stateless validation of block
-  auto result = std::make_shared<shared_model::proto::Block>(std::move(block));
+  // stateless validation of block, which is parsed into the arena
+  auto result = std::make_shared<shared_model::proto::Block>(
+      std::move(arena), block, std::vector<types::HashType>{});
   auto answer = BlockValidatorInternal(TimerWrapper(result->createdTime()))
                     .validate(*result);
   if (answer.hasErrors()) {
@@ -171,6 +178,7 @@ BlockLoaderImpl::findPeer(const shared_model::crypto::PublicKey &pubkey) {
 
 proto::Loader::Stub &BlockLoaderImpl::getPeerStub(
     const shared_model::interface::Peer &peer) {
+  std::lock_guard<std::mutex> lock(peer_connections_mutex_);
   auto it = peer_connections_.find(peer.address());
   if (it == peer_connections_.end()) {
     it = peer_connections_
@@ -20,6 +20,7 @@
 
 #include "network/block_loader.hpp"
 
+#include <mutex>
 #include <unordered_map>
 
 #include "ametsuchi/block_query.hpp"
@@ -44,6 +45,11 @@ namespace iroha {
           const shared_model::crypto::PublicKey &peer_pubkey,
           const shared_model::interface::types::HashType &block_hash) override;
 
+      boost::optional<std::shared_ptr<shared_model::interface::Block>>
+      retrieveBlock(const shared_model::crypto::PublicKey &peer_pubkey,
+                    const shared_model::interface::types::HashType &block_hash,
+                    grpc::ClientContext &context) override;
+
      private:
       /**
        * Retrieve peers from database, and find the requested peer by pubkey
@@ -55,6 +61,7 @@ namespace iroha {
           const shared_model::crypto::PublicKey &pubkey);
       /**
        * Get or create a RPC stub for connecting to peer
+       * Thread-safe, since blocks can be requested from several peers at once
        * @param peer for connecting
        * @return RPC stub
        */
@@ -64,6 +71,7 @@ namespace iroha {
       std::unordered_map<shared_model::interface::types::AddressType,
                          std::unique_ptr<proto::Loader::Stub>>
           peer_connections_;
+      std::mutex peer_connections_mutex_;
       std::shared_ptr<ametsuchi::PeerQuery> peer_query_;
       std::shared_ptr<ametsuchi::BlockQuery> block_query_;
 
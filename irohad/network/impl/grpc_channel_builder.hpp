@@ -23,6 +23,24 @@
 namespace iroha {
   namespace network {
 
+    /// interval between pings which keep idle peer connections open
+    constexpr int kKeepAliveTimeMs = 30 * 1000;
+
+    /// time to wait for ping acknowledgement before closing the connection
+    constexpr int kKeepAliveTimeoutMs = 10 * 1000;
+
+    /**
+     * Channel arguments which allow to send and receive messages of INT_MAX
+     * bytes size
+     */
+    inline grpc::ChannelArguments defaultChannelArguments() {
+      // in order to bypass built-in limitation of gRPC message size
+      grpc::ChannelArguments args;
+      args.SetMaxSendMessageSize(INT_MAX);
+      args.SetMaxReceiveMessageSize(INT_MAX);
+      return args;
+    }
+
     /**
      * Creates client which is capable of sending and receiving
      * messages of INT_MAX bytes size
@@ -32,14 +50,30 @@ namespace iroha {
      */
     template <typename T>
     auto createClient(const grpc::string& address) {
-      // in order to bypass built-in limitation of gRPC message size
-      grpc::ChannelArguments args;
-      args.SetMaxSendMessageSize(INT_MAX);
-      args.SetMaxReceiveMessageSize(INT_MAX);
+      return T::NewStub(grpc::CreateCustomChannel(
+          address,
+          grpc::InsecureChannelCredentials(),
+          defaultChannelArguments()));
+    }
+
+    /**
+     * Creates client as createClient does, which additionally pings the peer
+     * when the connection is idle. Such client is meant to be cached and
+     * reused for many calls, so that they are not delayed by reconnection
+     * @tparam T type for gRPC stub, e.g. proto::Yac
+     * @param address ip address for connection, ipv4:port
+     * @return gRPC stub of parametrized type
+     */
+    template <typename T>
+    auto createKeepAliveClient(const grpc::string& address) {
+      auto args = defaultChannelArguments();
+      args.SetInt(GRPC_ARG_KEEPALIVE_TIME_MS, kKeepAliveTimeMs);
+      args.SetInt(GRPC_ARG_KEEPALIVE_TIMEOUT_MS, kKeepAliveTimeoutMs);
+      args.SetInt(GRPC_ARG_KEEPALIVE_PERMIT_WITHOUT_CALLS, 1);
+      args.SetInt(GRPC_ARG_HTTP2_MAX_PINGS_WITHOUT_DATA, 0);
 
-      return
-          T::NewStub(grpc::CreateCustomChannel(
-              address, grpc::InsecureChannelCredentials(), args));
+      return T::NewStub(grpc::CreateCustomChannel(
+          address, grpc::InsecureChannelCredentials(), args));
     }
   } // namespace network
 } // namespace iroha
@@ -0,0 +1,64 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_ORDERING_LOAD_HPP
+#define IROHA_ORDERING_LOAD_HPP
+
+#include <atomic>
+#include <chrono>
+#include <limits>
+
+namespace iroha {
+  namespace network {
+
+    /**
+     * Overload state of the ordering service as it is seen by the ordering
+     * gate. The state is reported by the ordering service periodically while
+     * its queue is over the high-water mark, so overload expires by itself
+     * when reports stop coming, e.g. if the ordering peer is down.
+     * Methods are lock-free and may be called from any thread.
+     */
+    class OrderingLoad {
+     public:
+      using Clock = std::chrono::steady_clock;
+
+      /**
+       * @param expiration - time overload lasts after it is reported, should
+       * span a few report intervals of the ordering service
+       */
+      explicit OrderingLoad(
+          std::chrono::milliseconds expiration = std::chrono::seconds(3))
+          : expiration_(expiration), overloaded_until_(kNotOverloaded) {}
+
+      /**
+       * Apply the state reported by the ordering service
+       * @param overloaded - whether the queue is over the high-water mark
+       */
+      void update(bool overloaded) {
+        overloaded_until_ = overloaded
+            ? (Clock::now() + expiration_).time_since_epoch().count()
+            : kNotOverloaded;
+      }
+
+      /**
+       * @return true if new transactions should be rejected
+       */
+      bool isOverloaded() const {
+        return Clock::now().time_since_epoch().count()
+            < overloaded_until_.load();
+      }
+
+     private:
+      static constexpr Clock::rep kNotOverloaded =
+          std::numeric_limits<Clock::rep>::min();
+
+      const std::chrono::milliseconds expiration_;
+      std::atomic<Clock::rep> overloaded_until_;
+    };
+
+  }  // namespace network
+}  // namespace iroha
+
+#endif  // IROHA_ORDERING_LOAD_HPP
@@ -63,6 +63,25 @@ namespace iroha {
           std::unique_ptr<shared_model::interface::Proposal> proposal,
           const std::vector<std::string> &peers) = 0;
 
+      /**
+       * Passes batch to ordering service of another peer
+       * @param batch : batch to be forwarded
+       * @param peer : address of the peer
+       */
+      virtual void forwardBatch(
+          const shared_model::interface::TransactionBatch &batch,
+          const std::string &peer) = 0;
+
+      /**
+       * Reports occupancy of the ordering service queue to ordering gates
+       * @param overloaded : whether the queue is over the high-water mark
+       * @param size : number of queued transactions
+       * @param peers : addresses of the gates
+       */
+      virtual void publishQueueState(bool overloaded,
+                                     size_t size,
+                                     const std::vector<std::string> &peers) = 0;
+
       virtual ~OrderingServiceTransport() = default;
     };
 
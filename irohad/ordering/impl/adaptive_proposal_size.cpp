@@ -0,0 +1,121 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ordering/impl/adaptive_proposal_size.hpp"
+
+#include <algorithm>
+
+namespace iroha {
+  namespace ordering {
+
+    /// weight of a new observation in the smoothed processing time
+    static constexpr double kProcessingGain = 1. / 8;
+    /// rounds which are not committed within this number are forgotten
+    static constexpr size_t kMaxPendingProposals = 16;
+
+    constexpr const char *AdaptiveProposalSize::kSizeGauge;
+    constexpr const char *AdaptiveProposalSize::kDelayGauge;
+    constexpr AdaptiveProposalSize::DelayType AdaptiveProposalSize::kMinDelay;
+
+    AdaptiveProposalSize::AdaptiveProposalSize(
+        size_t max_size,
+        DelayType max_delay,
+        DelayType target_latency,
+        std::shared_ptr<metrics::MetricsSink> sink)
+        : max_size_(std::max<size_t>(max_size, 1)),
+          max_delay_(std::max(max_delay, kMinDelay)),
+          target_latency_(target_latency),
+          sink_(std::move(sink)),
+          processing_(-1),
+          size_(max_size_),
+          delay_(max_delay_) {}
+
+    size_t AdaptiveProposalSize::size() const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return size_;
+    }
+
+    AdaptiveProposalSize::DelayType AdaptiveProposalSize::delay() const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return delay_;
+    }
+
+    void AdaptiveProposalSize::proposed(
+        shared_model::interface::types::HeightType height,
+        size_t transactions) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      proposals_[height] = transactions;
+      while (proposals_.size() > kMaxPendingProposals) {
+        proposals_.erase(proposals_.begin());
+      }
+    }
+
+    void AdaptiveProposalSize::onRoundTrace(const metrics::RoundTrace &trace) {
+      if (sink_) {
+        sink_->onRoundTrace(trace);
+      }
+
+      const auto &received = trace.at(metrics::RoundStage::kProposalReceived);
+      const auto &committed = trace.at(metrics::RoundStage::kCommitApplied);
+      if (not received or not committed) {
+        return;
+      }
+      auto processing = std::chrono::duration<double, std::milli>(
+                            *committed - *received)
+                            .count();
+
+      std::unique_lock<std::mutex> lock(mutex_);
+      auto proposal = proposals_.find(trace.height);
+      if (proposal == proposals_.end()) {
+        // the proposal was created by another ordering service
+        return;
+      }
+      auto transactions = proposal->second;
+      proposals_.erase(proposals_.begin(), std::next(proposal));
+
+      auto target = static_cast<double>(target_latency_.count());
+      if (processing > target) {
+        size_ = std::max<size_t>(
+            1,
+            static_cast<size_t>(std::min(size_, transactions) * target
+                                / processing));
+      } else if (transactions >= size_) {
+        size_ = std::min(max_size_, size_ + std::max<size_t>(1, size_ / 4));
+      }
+
+      processing_ = processing_ < 0
+          ? processing
+          : (1 - kProcessingGain) * processing_ + kProcessingGain * processing;
+      delay_ = std::min(
+          max_delay_,
+          std::max(kMinDelay,
+                   DelayType(static_cast<DelayType::rep>(target - processing_))));
+
+      auto size = size_;
+      auto delay = delay_;
+      lock.unlock();
+
+      if (sink_) {
+        sink_->onGauge(kSizeGauge, size);
+        sink_->onGauge(kDelayGauge, delay.count());
+      }
+    }
+
+    void AdaptiveProposalSize::onGauge(const std::string &name,
+                                       int64_t value) {
+      if (sink_) {
+        sink_->onGauge(name, value);
+      }
+    }
+
+    void AdaptiveProposalSize::onCounter(const std::string &name,
+                                         int64_t increment) {
+      if (sink_) {
+        sink_->onCounter(name, increment);
+      }
+    }
+
+  }  // namespace ordering
+}  // namespace iroha
@@ -0,0 +1,103 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_ADAPTIVE_PROPOSAL_SIZE_HPP
+#define IROHA_ADAPTIVE_PROPOSAL_SIZE_HPP
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+
+#include "metrics/metrics_sink.hpp"
+
+namespace iroha {
+  namespace ordering {
+
+    /**
+     * Chooses proposal size and proposal timeout which keep consensus round
+     * within the target latency. Round latency is the time a transaction
+     * waits for proposal plus the time the proposal takes from arrival to
+     * commit, the latter is observed from round traces of this peer.
+     *
+     * Timeout is the target latency minus smoothed processing time. Size
+     * shrinks in proportion when processing takes longer than the target and
+     * grows by a quarter after every full proposal processed in time.
+     * Both values never exceed the configured ones.
+     *
+     * Being a sink of round traces it can be put in front of another sink,
+     * which receives all traces and gauges passed through.
+     */
+    class AdaptiveProposalSize : public metrics::MetricsSink {
+     public:
+      using DelayType = std::chrono::milliseconds;
+
+      /// name of the gauge with the current proposal size
+      static constexpr const char *kSizeGauge = "ordering_proposal_size";
+      /// name of the gauge with the current proposal timeout
+      static constexpr const char *kDelayGauge = "ordering_proposal_delay_ms";
+
+      /// the lowest proposal timeout
+      static constexpr DelayType kMinDelay{10};
+
+      /**
+       * @param max_size - upper bound and initial value of proposal size
+       * @param max_delay - upper bound and initial value of proposal timeout
+       * @param target_latency - desired round latency
+       * @param sink - receiver of the current values and the passed through
+       * metrics, may be null
+       */
+      AdaptiveProposalSize(
+          size_t max_size,
+          DelayType max_delay,
+          DelayType target_latency,
+          std::shared_ptr<metrics::MetricsSink> sink = nullptr);
+
+      /**
+       * @return number of transactions for the next proposal
+       */
+      size_t size() const;
+
+      /**
+       * @return timeout for the next proposal
+       */
+      DelayType delay() const;
+
+      /**
+       * Remember the number of transactions in the created proposal
+       * @param height - height of the proposal
+       * @param transactions - number of transactions in it
+       */
+      void proposed(shared_model::interface::types::HeightType height,
+                    size_t transactions);
+
+      /**
+       * Adjust size and timeout by processing time of the finished round
+       */
+      void onRoundTrace(const metrics::RoundTrace &trace) override;
+
+      void onGauge(const std::string &name, int64_t value) override;
+
+      void onCounter(const std::string &name, int64_t increment) override;
+
+     private:
+      const size_t max_size_;
+      const DelayType max_delay_;
+      const DelayType target_latency_;
+      std::shared_ptr<metrics::MetricsSink> sink_;
+
+      mutable std::mutex mutex_;
+      /// number of transactions in proposals which are not committed yet
+      std::map<shared_model::interface::types::HeightType, size_t> proposals_;
+      /// smoothed processing time in milliseconds, negative until observed
+      double processing_;
+      size_t size_;
+      DelayType delay_;
+    };
+
+  }  // namespace ordering
+}  // namespace iroha
+
+#endif  // IROHA_ADAPTIVE_PROPOSAL_SIZE_HPP
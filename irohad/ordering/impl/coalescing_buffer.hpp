@@ -0,0 +1,144 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_COALESCING_BUFFER_HPP
+#define IROHA_COALESCING_BUFFER_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace iroha {
+  namespace ordering {
+
+    /**
+     * Buffer which collects items to send them in a single message. Items
+     * are flushed when their total size reaches the limit, or when given
+     * time passes since the first of them was added, whichever comes first.
+     * Items are never split, so the flushed size may exceed the limit.
+     *
+     * Timeouts are handled by a dedicated thread, remaining items are
+     * flushed on destruction. Thread-safe.
+     * @tparam T - type of items
+     */
+    template <typename T>
+    class CoalescingBuffer {
+     public:
+      using Flush = std::function<void(std::vector<T>)>;
+
+      /**
+       * @param max_size - total size of items which triggers flush
+       * @param max_delay - time an item may wait for flush
+       * @param flush - receiver of the collected items, called without the
+       * buffer lock, possibly from different threads
+       */
+      CoalescingBuffer(size_t max_size,
+                       std::chrono::microseconds max_delay,
+                       Flush flush)
+          : max_size_(max_size),
+            max_delay_(max_delay),
+            flush_(std::move(flush)),
+            thread_([this] { this->run(); }) {}
+
+      CoalescingBuffer(const CoalescingBuffer &) = delete;
+      CoalescingBuffer &operator=(const CoalescingBuffer &) = delete;
+
+      /**
+       * Add item to the buffer, flush the buffer if it is full
+       * @param item - item to add
+       * @param size - size of the item
+       */
+      void push(T item, size_t size) {
+        std::vector<T> ready;
+        {
+          std::lock_guard<std::mutex> lock(mutex_);
+          if (items_.empty()) {
+            deadline_ = Clock::now() + max_delay_;
+            cv_.notify_one();
+          }
+          items_.push_back(std::move(item));
+          size_ += size;
+          if (size_ < max_size_) {
+            return;
+          }
+          ready = take();
+        }
+        flush_(std::move(ready));
+      }
+
+      ~CoalescingBuffer() {
+        {
+          std::lock_guard<std::mutex> lock(mutex_);
+          stopped_ = true;
+        }
+        cv_.notify_one();
+        thread_.join();
+      }
+
+     private:
+      using Clock = std::chrono::steady_clock;
+
+      /**
+       * Take all items from the buffer, must be called under the lock
+       */
+      std::vector<T> take() {
+        std::vector<T> result;
+        result.swap(items_);
+        size_ = 0;
+        ++generation_;
+        return result;
+      }
+
+      /**
+       * Body of the thread which flushes the buffer on timeout
+       */
+      void run() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true) {
+          cv_.wait(lock, [this] { return stopped_ or not items_.empty(); });
+          if (items_.empty()) {
+            return;
+          }
+          // wait for the deadline of the first item, unless the items are
+          // flushed by size meanwhile
+          auto generation = generation_;
+          auto deadline = deadline_;
+          cv_.wait_until(lock, deadline, [this, generation] {
+            return stopped_ or generation_ != generation;
+          });
+          if (generation_ != generation) {
+            continue;
+          }
+          auto ready = take();
+          lock.unlock();
+          flush_(std::move(ready));
+          lock.lock();
+        }
+      }
+
+      const size_t max_size_;
+      const std::chrono::microseconds max_delay_;
+      Flush flush_;
+
+      std::mutex mutex_;
+      std::condition_variable cv_;
+      std::vector<T> items_;
+      size_t size_ = 0;
+      /// number of flushes, tells the thread that items it waits for are gone
+      size_t generation_ = 0;
+      Clock::time_point deadline_;
+      bool stopped_ = false;
+
+      /// is the last member, so that it starts when the rest is initialized
+      std::thread thread_;
+    };
+
+  }  // namespace ordering
+}  // namespace iroha
+
+#endif  // IROHA_COALESCING_BUFFER_HPP
@@ -0,0 +1,91 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ordering/impl/duplicate_batch_filter.hpp"
+
+namespace iroha {
+  namespace ordering {
+
+    constexpr const char *DuplicateBatchFilter::kRejectedCounter;
+
+    DuplicateBatchFilter::DuplicateBatchFilter(
+        std::chrono::milliseconds expiration,
+        std::shared_ptr<metrics::MetricsSink> sink,
+        std::function<Clock::time_point()> clock)
+        : expiration_(expiration),
+          sink_(std::move(sink)),
+          clock_(std::move(clock)) {}
+
+    bool DuplicateBatchFilter::insert(
+        const shared_model::interface::types::HashType &hash,
+        size_t signatures) {
+      std::unique_lock<std::mutex> lock(mutex_);
+      auto now = clock_();
+      expire(now);
+      auto it = entries_.find(hash);
+      if (it != entries_.end() and it->second.signatures >= signatures) {
+        lock.unlock();
+        ++rejected_;
+        if (sink_) {
+          sink_->onCounter(kRejectedCounter, 1);
+        }
+        return false;
+      }
+      touch(hash, signatures, now);
+      return true;
+    }
+
+    bool DuplicateBatchFilter::proposed(
+        const shared_model::interface::types::HashType &hash,
+        size_t signatures) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = entries_.find(hash);
+      if (it != entries_.end() and it->second.signatures > signatures) {
+        return false;
+      }
+      touch(hash, signatures, clock_());
+      return true;
+    }
+
+    void DuplicateBatchFilter::forget(
+        const shared_model::interface::types::HashType &hash) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      // entries of the timeline are skipped on expiration if the hash is
+      // absent
+      entries_.erase(hash);
+    }
+
+    size_t DuplicateBatchFilter::rejectedCount() const {
+      return rejected_.load();
+    }
+
+    size_t DuplicateBatchFilter::size() const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return entries_.size();
+    }
+
+    void DuplicateBatchFilter::touch(
+        const shared_model::interface::types::HashType &hash,
+        size_t signatures,
+        TimePoint now) {
+      entries_[hash] = Entry{now, signatures};
+      timeline_.emplace_back(now, hash);
+    }
+
+    void DuplicateBatchFilter::expire(TimePoint now) {
+      while (not timeline_.empty()
+             and now - timeline_.front().first >= expiration_) {
+        auto it = entries_.find(timeline_.front().second);
+        // the hash could have been seen after this entry
+        if (it != entries_.end()
+            and it->second.last_seen == timeline_.front().first) {
+          entries_.erase(it);
+        }
+        timeline_.pop_front();
+      }
+    }
+
+  }  // namespace ordering
+}  // namespace iroha
@@ -0,0 +1,138 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_DUPLICATE_BATCH_FILTER_HPP
+#define IROHA_DUPLICATE_BATCH_FILTER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "interfaces/common_objects/types.hpp"
+#include "metrics/metrics_sink.hpp"
+
+namespace iroha {
+  namespace ordering {
+
+    /**
+     * Set of hashes of batches which are queued or have been proposed
+     * recently. The same batch may come to the ordering service from several
+     * ordering gates or may be resubmitted by a client, the set allows to
+     * put it in proposal only once.
+     *
+     * Batches are identified by reduced hash, which does not cover
+     * signatures, so the number of signatures of the latest accepted copy is
+     * kept as well. A copy with more signatures, e.g. one which has collected
+     * them in multisignature processing, is not a duplicate: it supersedes
+     * the copy which is queued.
+     *
+     * Hash is forgotten when given time passes since it was seen last time,
+     * either received or proposed. Thread-safe.
+     */
+    class DuplicateBatchFilter {
+     public:
+      using Clock = std::chrono::steady_clock;
+
+      /// name of the counter of rejected duplicates
+      static constexpr const char *kRejectedCounter =
+          "ordering_duplicate_batches";
+
+      /**
+       * @param expiration - time to keep hash since it was seen last time
+       * @param sink - receiver of the number of rejected duplicates, may be
+       * null
+       * @param clock - source of the current time
+       */
+      DuplicateBatchFilter(
+          std::chrono::milliseconds expiration,
+          std::shared_ptr<metrics::MetricsSink> sink = nullptr,
+          std::function<Clock::time_point()> clock = Clock::now);
+
+      /**
+       * Remember hash of received batch
+       * @param hash - reduced hash of the batch
+       * @param signatures - number of signatures of the batch transactions
+       * @return true if the batch is new or has more signatures than the
+       * accepted copy, false if it is a duplicate
+       */
+      bool insert(const shared_model::interface::types::HashType &hash,
+                  size_t signatures);
+
+      /**
+       * Prolong keeping hash of the batch which is put in a proposal
+       * @param hash - reduced hash of the batch
+       * @param signatures - number of signatures of the batch transactions
+       * @return false if the batch is superseded by a copy with more
+       * signatures and should not be proposed
+       */
+      bool proposed(const shared_model::interface::types::HashType &hash,
+                    size_t signatures);
+
+      /**
+       * Forget hash of the batch which is passed to ordering service of
+       * another peer, so that it is accepted if it is passed back
+       * @param hash - reduced hash of the batch
+       */
+      void forget(const shared_model::interface::types::HashType &hash);
+
+      /**
+       * @return number of batches rejected as duplicates
+       */
+      size_t rejectedCount() const;
+
+      /**
+       * @return number of hashes kept
+       */
+      size_t size() const;
+
+     private:
+      using TimePoint = Clock::time_point;
+
+      /**
+       * Last time the hash was seen with the number of signatures of the
+       * accepted copy
+       */
+      struct Entry {
+        TimePoint last_seen;
+        size_t signatures;
+      };
+
+      /**
+       * Update last time the hash was seen
+       */
+      void touch(const shared_model::interface::types::HashType &hash,
+                 size_t signatures,
+                 TimePoint now);
+
+      /**
+       * Forget hashes which have not been seen for expiration time
+       */
+      void expire(TimePoint now);
+
+      const std::chrono::milliseconds expiration_;
+      std::shared_ptr<metrics::MetricsSink> sink_;
+      std::function<TimePoint()> clock_;
+
+      mutable std::mutex mutex_;
+      std::unordered_map<shared_model::interface::types::HashType,
+                         Entry,
+                         shared_model::interface::types::HashType::Hasher>
+          entries_;
+      /// times hashes were seen in order of occurrence, may contain outdated
+      /// entries for hashes which have been seen again later
+      std::deque<std::pair<TimePoint, shared_model::interface::types::HashType>>
+          timeline_;
+
+      std::atomic<size_t> rejected_{0};
+    };
+
+  }  // namespace ordering
+}  // namespace iroha
+
+#endif  // IROHA_DUPLICATE_BATCH_FILTER_HPP
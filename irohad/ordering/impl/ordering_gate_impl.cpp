@@ -20,6 +20,8 @@
 
 #include "ordering/impl/ordering_gate_impl.hpp"
 
+#include "backend/protobuf/proto_proposal_factory.hpp"
+#include "backend/protobuf/transaction.hpp"
 #include "interfaces/iroha_internal/block.hpp"
 #include "interfaces/iroha_internal/proposal.hpp"
 #include "interfaces/transaction.hpp"
@@ -36,11 +38,24 @@ namespace iroha {
     OrderingGateImpl::OrderingGateImpl(
         std::shared_ptr<iroha::network::OrderingGateTransport> transport,
         shared_model::interface::types::HeightType initial_height,
-        bool run_async)
+        bool run_async,
+        std::shared_ptr<metrics::RoundTimer> round_timer,
+        std::shared_ptr<OrderingPeerRotation> rotation,
+        std::chrono::milliseconds round_timeout,
+        shared_model::interface::types::TimestampType top_block_time)
         : transport_(std::move(transport)),
           last_block_height_(initial_height),
           log_(logger::log("OrderingGate")),
-          run_async_(run_async) {}
+          run_async_(run_async),
+          round_timer_(std::move(round_timer)),
+          rotation_(std::move(rotation)),
+          round_timeout_(round_timeout),
+          top_block_time_(top_block_time),
+          proposal_factory_(
+              std::make_unique<shared_model::proto::ProtoProposalFactory<
+                  shared_model::validation::DefaultProposalValidator>>()),
+          last_proposal_height_(initial_height),
+          round_height_(initial_height + 1) {}
 
     void OrderingGateImpl::propagateTransaction(
         std::shared_ptr<const shared_model::interface::Transaction> transaction)
@@ -75,11 +90,21 @@ namespace iroha {
       auto top_block_height =
           pcs.on_commit()
               .transform([](const Commit &commit) {
-                // find height of last commited block
-                return commit.as_blocking().last()->height();
+                // find last commited block
+                return commit.as_blocking().last();
               })
+              .tap([this](const auto &block) {
+                // transactions go to the ordering peer of the next round
+                if (rotation_) {
+                  rotation_->onCommit(block->height());
+                }
+                this->startRound(block->height() + 1, block->createdTime());
+              })
+              .transform([](const auto &block) { return block->height(); })
               .start_with(last_block_height_);
 
+      startRound(last_block_height_ + 1, top_block_time_);
+
       auto subscribe = [&](auto merge_strategy) {
         pcs_subscriber_ = merge_strategy(net_proposals_.get_observable())
                               .subscribe([this](const auto &t) {
@@ -102,6 +127,9 @@ namespace iroha {
     void OrderingGateImpl::onProposal(
         std::shared_ptr<shared_model::interface::Proposal> proposal) {
       log_->info("Received new proposal, height: {}", proposal->height());
+      metrics::markStage(round_timer_,
+                         metrics::RoundStage::kProposalReceived,
+                         proposal->height());
       proposal_queue_.push(std::move(proposal));
       std::lock_guard<std::mutex> lock(proposal_mutex_);
       net_proposals_.get_subscriber().on_next(0);
@@ -110,6 +138,7 @@ namespace iroha {
     void OrderingGateImpl::tryNextRound(
         shared_model::interface::types::HeightType last_block_height) {
       log_->debug("TryNextRound");
+      std::lock_guard<std::mutex> lock(round_mutex_);
       std::shared_ptr<shared_model::interface::Proposal> next_proposal;
       while (proposal_queue_.try_pop(next_proposal)) {
         // check for old proposal
@@ -123,13 +152,62 @@ namespace iroha {
           proposal_queue_.push(next_proposal);
           break;
         }
+        // another proposal of the height, e.g. an empty one after the round
+        // timeout, has been voted for already
+        if (next_proposal->height() <= last_proposal_height_) {
+          log_->warn("Proposal of height {} is passed already, discarding",
+                     next_proposal->height());
+          continue;
+        }
         log_->info("Pass the proposal to pipeline height {}",
                    next_proposal->height());
+        last_proposal_height_ = next_proposal->height();
         proposals_.get_subscriber().on_next(next_proposal);
       }
     }
 
+    void OrderingGateImpl::startRound(
+        shared_model::interface::types::HeightType height,
+        shared_model::interface::types::TimestampType top_block_time) {
+      if (round_timeout_.count() == 0) {
+        return;
+      }
+      // created time of the empty proposal is derived from the ledger, so
+      // that every peer makes the same empty block
+      auto created_time = top_block_time + round_timeout_.count();
+      round_timeout_subscription_.unsubscribe();
+      {
+        std::lock_guard<std::mutex> lock(round_mutex_);
+        round_height_ = height;
+      }
+      round_timeout_subscription_ =
+          rxcpp::observable<>::timer(round_timeout_,
+                                     rxcpp::observe_on_new_thread())
+              .subscribe([this, height, created_time](auto) {
+                this->onRoundTimeout(height, created_time);
+              });
+    }
+
+    void OrderingGateImpl::onRoundTimeout(
+        shared_model::interface::types::HeightType height,
+        shared_model::interface::types::TimestampType created_time) {
+      std::lock_guard<std::mutex> lock(round_mutex_);
+      if (height != round_height_ or height <= last_proposal_height_) {
+        return;
+      }
+      log_->warn("No proposal of height {} in the round timeout, pass empty",
+                 height);
+      std::shared_ptr<shared_model::interface::Proposal> proposal =
+          proposal_factory_->unsafeCreateProposal(
+              height,
+              created_time,
+              std::vector<shared_model::proto::Transaction>{});
+      last_proposal_height_ = height;
+      proposals_.get_subscriber().on_next(std::move(proposal));
+    }
+
     OrderingGateImpl::~OrderingGateImpl() {
+      round_timeout_subscription_.unsubscribe();
       pcs_subscriber_.unsubscribe();
     }
 
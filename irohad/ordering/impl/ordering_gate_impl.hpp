@@ -20,14 +20,18 @@
 
 #include "network/ordering_gate.hpp"
 
+#include <chrono>
 #include <mutex>
 
 #include <tbb/concurrent_priority_queue.h>
 
 #include "interfaces/common_objects/types.hpp"
+#include "interfaces/iroha_internal/unsafe_proposal_factory.hpp"
 #include "logger/logger.hpp"
+#include "metrics/round_timer.hpp"
 #include "network/impl/async_grpc_client.hpp"
 #include "network/ordering_gate_transport.hpp"
+#include "ordering/impl/ordering_peer_rotation.hpp"
 
 namespace shared_model {
   namespace interface {
@@ -62,11 +66,26 @@ namespace iroha {
        * @param initial_height - height of the last block stored on this peer
        * @param run_async - whether proposals should be handled
        * asynchronously (on separate thread). Default is true.
+       * @param round_timer - collector of round stage timings, null if
+       * metrics are disabled
+       * @param rotation - schedule of ordering peers, which is moved to the
+       * next round on commit, null if the ordering peer is fixed
+       * @param round_timeout - time after the last commit, in which a
+       * proposal of the next height is expected. If it passes, an empty
+       * proposal of that height is passed to the pipeline instead, so that a
+       * silent ordering peer is skipped once the peers commit its empty
+       * block. Zero disables the timeout
+       * @param top_block_time - created time of the block at initial_height
        */
       OrderingGateImpl(
           std::shared_ptr<iroha::network::OrderingGateTransport> transport,
           shared_model::interface::types::HeightType initial_height,
-          bool run_async = true);
+          bool run_async = true,
+          std::shared_ptr<metrics::RoundTimer> round_timer = nullptr,
+          std::shared_ptr<OrderingPeerRotation> rotation = nullptr,
+          std::chrono::milliseconds round_timeout =
+              std::chrono::milliseconds::zero(),
+          shared_model::interface::types::TimestampType top_block_time = 0);
 
       void propagateTransaction(
           std::shared_ptr<const shared_model::interface::Transaction>
@@ -97,6 +116,27 @@ namespace iroha {
       void tryNextRound(
           shared_model::interface::types::HeightType last_block_height);
 
+      /**
+       * Restart the round timeout for the proposal of given height
+       * @param height - height of the expected proposal
+       * @param top_block_time - created time of the block it follows
+       */
+      void startRound(shared_model::interface::types::HeightType height,
+                      shared_model::interface::types::TimestampType
+                          top_block_time);
+
+      /**
+       * Pass empty proposal of given height to the pipeline, unless a
+       * proposal of the height has been passed already or the round has
+       * moved on
+       * @param height - height of the expected proposal
+       * @param created_time - created time of the empty proposal, which is
+       * the same on every peer
+       */
+      void onRoundTimeout(
+          shared_model::interface::types::HeightType height,
+          shared_model::interface::types::TimestampType created_time);
+
       rxcpp::subjects::subject<
           std::shared_ptr<shared_model::interface::Proposal>>
           proposals_;
@@ -122,6 +162,24 @@ namespace iroha {
       logger::Logger log_;
 
       bool run_async_;
+
+      std::shared_ptr<metrics::RoundTimer> round_timer_;
+
+      std::shared_ptr<OrderingPeerRotation> rotation_;
+
+      std::chrono::milliseconds round_timeout_;
+      shared_model::interface::types::TimestampType top_block_time_;
+      std::unique_ptr<shared_model::interface::UnsafeProposalFactory>
+          proposal_factory_;
+
+      /// guards the proposals passed to the pipeline
+      std::mutex round_mutex_;
+      /// height of the last proposal passed to the pipeline, at most one
+      /// proposal of each height is passed
+      shared_model::interface::types::HeightType last_proposal_height_;
+      /// height of the proposal which is expected in the current round
+      shared_model::interface::types::HeightType round_height_;
+      rxcpp::composite_subscription round_timeout_subscription_;
     };
   }  // namespace ordering
 }  // namespace iroha
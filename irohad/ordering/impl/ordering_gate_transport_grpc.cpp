@@ -19,6 +19,7 @@
 #include "backend/protobuf/transaction.hpp"
 #include "builders/protobuf/proposal.hpp"
 #include "endpoint.pb.h"
+#include "interfaces/common_objects/peer.hpp"
 #include "interfaces/common_objects/types.hpp"
 #include "network/impl/grpc_channel_builder.hpp"
 
@@ -30,6 +31,12 @@ grpc::Status OrderingGateTransportGrpc::onProposal(
     ::google::protobuf::Empty *response) {
   log_->info("receive proposal");
 
+  if (not isFromOrderingPeer(*context, request->height())) {
+    log_->warn("Proposal of height {} is not created by its ordering peer",
+               request->height());
+    return grpc::Status::OK;
+  }
+
   auto proposal_res = factory_->createProposal(*request);
   proposal_res.match(
       [this](iroha::expected::Value<
@@ -50,26 +57,104 @@ grpc::Status OrderingGateTransportGrpc::onProposal(
   return grpc::Status::OK;
 }
 
+grpc::Status OrderingGateTransportGrpc::onQueueState(
+    ::grpc::ServerContext *context,
+    const proto::QueueState *request,
+    ::google::protobuf::Empty *response) {
+  log_->info("Ordering service queue size is {}, overloaded: {}",
+             request->size(),
+             request->overloaded());
+  if (load_) {
+    load_->update(request->overloaded());
+  }
+  return grpc::Status::OK;
+}
+
 OrderingGateTransportGrpc::OrderingGateTransportGrpc(
-    const std::string &server_address)
+    const std::string &server_address,
+    std::shared_ptr<OrderingPeerRotation> rotation,
+    size_t coalescing_size,
+    std::chrono::microseconds coalescing_delay,
+    std::shared_ptr<network::OrderingLoad> load)
     : network::AsyncGrpcClient<google::protobuf::Empty>(
           logger::log("OrderingGate")),
       client_(network::createClient<proto::OrderingServiceTransportGrpc>(
           server_address)),
+      rotation_(std::move(rotation)),
       factory_(std::make_unique<shared_model::proto::ProtoProposalFactory<
-                   shared_model::validation::DefaultProposalValidator>>()) {}
+                   shared_model::validation::DefaultProposalValidator>>()),
+      load_(std::move(load)) {
+  if (coalescing_size > 1 and coalescing_delay.count() > 0) {
+    coalescing_buffer_ =
+        std::make_unique<CoalescingBuffer<iroha::protocol::TxList>>(
+            coalescing_size, coalescing_delay, [this](auto batches) {
+              this->sendBatches(std::move(batches));
+            });
+  }
+}
+
+bool OrderingGateTransportGrpc::shedLoad() const {
+  if (load_ and load_->isOverloaded()) {
+    log_->warn("Ordering service is overloaded, dropping transactions");
+    return true;
+  }
+  return false;
+}
+
+bool OrderingGateTransportGrpc::isFromOrderingPeer(
+    const grpc::ServerContext &context,
+    shared_model::interface::types::HeightType height) const {
+  if (not rotation_) {
+    return true;
+  }
+  auto peer = rotation_->orderingPeer(height);
+  auto creator = context.client_metadata().find(kProposalCreatorKey);
+  return peer and creator != context.client_metadata().end()
+      and std::string(creator->second.data(), creator->second.size())
+      == (*peer)->pubkey().hex();
+}
+
+iroha::ordering::proto::OrderingServiceTransportGrpc::Stub &
+OrderingGateTransportGrpc::orderingClient() {
+  if (not rotation_) {
+    return *client_;
+  }
+  auto peer = rotation_->currentOrderingPeer();
+  if (not peer) {
+    return *client_;
+  }
+  std::lock_guard<std::mutex> lock(rotation_clients_mutex_);
+  // clients are never dropped, so the reference outlives the lock
+  auto &client = rotation_clients_[(*peer)->address()];
+  if (not client) {
+    client = network::createKeepAliveClient<proto::OrderingServiceTransportGrpc>(
+        (*peer)->address());
+  }
+  return *client;
+}
 
 void OrderingGateTransportGrpc::propagateTransaction(
     std::shared_ptr<const shared_model::interface::Transaction> transaction) {
   log_->info("Propagate tx (on transport)");
-  auto call = new AsyncClientCall;
+  if (shedLoad()) {
+    return;
+  }
 
   auto transaction_transport =
       static_cast<const shared_model::proto::Transaction &>(*transaction)
           .getTransport();
   log_->debug("Propagating: '{}'", transaction_transport.DebugString());
-  call->response_reader =
-      client_->AsynconTransaction(&call->context, transaction_transport, &cq_);
+  if (coalescing_buffer_) {
+    // single transaction is a batch of one
+    iroha::protocol::TxList batch_transport;
+    *batch_transport.add_transactions() = std::move(transaction_transport);
+    coalescing_buffer_->push(std::move(batch_transport), 1);
+    return;
+  }
+
+  auto call = new AsyncClientCall;
+  call->response_reader = orderingClient().AsynconTransaction(
+      &call->context, transaction_transport, &cq_);
 
   call->response_reader->Finish(&call->reply, &call->status, call);
 }
@@ -77,16 +162,39 @@ void OrderingGateTransportGrpc::propagateTransaction(
 void OrderingGateTransportGrpc::propagateBatch(
     const shared_model::interface::TransactionBatch &batch) {
   log_->info("Propagate transaction batch (on transport)");
-  auto call = new AsyncClientCall;
+  if (shedLoad()) {
+    return;
+  }
 
   iroha::protocol::TxList batch_transport;
   for (const auto tx : batch.transactions()) {
-    new (batch_transport.add_transactions()) iroha::protocol::Transaction(
+    *batch_transport.add_transactions() =
         std::static_pointer_cast<shared_model::proto::Transaction>(tx)
-            ->getTransport());
+            ->getTransport();
+  }
+  if (coalescing_buffer_) {
+    coalescing_buffer_->push(std::move(batch_transport),
+                             batch.transactions().size());
+    return;
   }
+
+  auto call = new AsyncClientCall;
+  call->response_reader =
+      orderingClient().AsynconBatch(&call->context, batch_transport, &cq_);
+
+  call->response_reader->Finish(&call->reply, &call->status, call);
+}
+
+void OrderingGateTransportGrpc::sendBatches(
+    std::vector<iroha::protocol::TxList> batches) {
+  log_->info("Send {} coalesced batches", batches.size());
+  proto::BatchList batches_transport;
+  for (auto &batch : batches) {
+    batches_transport.add_batches()->Swap(&batch);
+  }
+  auto call = new AsyncClientCall;
   call->response_reader =
-      client_->AsynconBatch(&call->context, batch_transport, &cq_);
+      orderingClient().AsynconBatches(&call->context, batches_transport, &cq_);
 
   call->response_reader->Finish(&call->reply, &call->status, call);
 }
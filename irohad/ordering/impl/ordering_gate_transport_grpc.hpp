@@ -17,6 +17,9 @@
 #ifndef IROHA_ORDERING_GATE_TRANSPORT_GRPC_H
 #define IROHA_ORDERING_GATE_TRANSPORT_GRPC_H
 
+#include <mutex>
+#include <unordered_map>
+
 #include <google/protobuf/empty.pb.h>
 
 #include "backend/protobuf/proto_proposal_factory.hpp"
@@ -24,7 +27,10 @@
 #include "logger/logger.hpp"
 #include "network/impl/async_grpc_client.hpp"
 #include "network/ordering_gate_transport.hpp"
+#include "network/ordering_load.hpp"
 #include "ordering.grpc.pb.h"
+#include "ordering/impl/coalescing_buffer.hpp"
+#include "ordering/impl/ordering_peer_rotation.hpp"
 #include "validators/default_validator.hpp"
 
 namespace shared_model {
@@ -40,12 +46,36 @@ namespace iroha {
           public proto::OrderingGateTransportGrpc::Service,
           private network::AsyncGrpcClient<google::protobuf::Empty> {
      public:
-      explicit OrderingGateTransportGrpc(const std::string &server_address);
+      /**
+       * @param server_address - address of the ordering service
+       * @param rotation - schedule of ordering peers, if it is set
+       * transactions are sent to the ordering peer of the current round
+       * instead of server_address, and only proposals created by the
+       * ordering peer of their height are accepted
+       * @param coalescing_size - number of transactions which are sent in a
+       * single message, every batch is sent immediately if it is 1
+       * @param coalescing_delay - time a transaction may wait for others to
+       * be sent together
+       * @param load - overload state of the ordering service, which is
+       * updated by its reports, transactions are dropped while it is
+       * overloaded. Reports are ignored if it is null
+       */
+      explicit OrderingGateTransportGrpc(
+          const std::string &server_address,
+          std::shared_ptr<OrderingPeerRotation> rotation = nullptr,
+          size_t coalescing_size = 1,
+          std::chrono::microseconds coalescing_delay =
+              std::chrono::microseconds::zero(),
+          std::shared_ptr<network::OrderingLoad> load = nullptr);
 
       grpc::Status onProposal(::grpc::ServerContext *context,
                               const protocol::Proposal *request,
                               ::google::protobuf::Empty *response) override;
 
+      grpc::Status onQueueState(::grpc::ServerContext *context,
+                                const proto::QueueState *request,
+                                ::google::protobuf::Empty *response) override;
+
       void propagateTransaction(
           std::shared_ptr<const shared_model::interface::Transaction>
               transaction) override;
@@ -57,11 +87,51 @@ namespace iroha {
                          subscriber) override;
 
      private:
+      /**
+       * @return true if transactions should not be sent to the ordering
+       * service, because it is overloaded
+       */
+      bool shedLoad() const;
+
+      /**
+       * @param context - context of the call which has delivered the
+       * proposal
+       * @param height - height of the proposal
+       * @return true if the proposal is created by the ordering peer of its
+       * height according to the rotation, or there is no rotation
+       */
+      bool isFromOrderingPeer(
+          const grpc::ServerContext &context,
+          shared_model::interface::types::HeightType height) const;
+
+      /**
+       * @return client of the ordering service which receives transactions
+       * in the current round
+       */
+      proto::OrderingServiceTransportGrpc::Stub &orderingClient();
+
+      /**
+       * Send batches collected by the coalescing buffer in a single message
+       */
+      void sendBatches(std::vector<protocol::TxList> batches);
+
       std::weak_ptr<iroha::network::OrderingGateNotification> subscriber_;
       std::unique_ptr<proto::OrderingServiceTransportGrpc::Stub> client_;
+      std::shared_ptr<OrderingPeerRotation> rotation_;
+      /// clients of the rotating ordering peers by address
+      std::unordered_map<
+          std::string,
+          std::unique_ptr<proto::OrderingServiceTransportGrpc::Stub>>
+          rotation_clients_;
+      std::mutex rotation_clients_mutex_;
       std::unique_ptr<shared_model::proto::ProtoProposalFactory<
           shared_model::validation::DefaultProposalValidator>>
           factory_;
+      std::shared_ptr<network::OrderingLoad> load_;
+
+      /// is the last member, so that remaining batches are flushed while the
+      /// clients are alive
+      std::unique_ptr<CoalescingBuffer<protocol::TxList>> coalescing_buffer_;
     };
 
   }  // namespace ordering
@@ -0,0 +1,77 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ordering/impl/ordering_peer_rotation.hpp"
+
+#include <algorithm>
+
+#include "interfaces/common_objects/peer.hpp"
+
+namespace iroha {
+  namespace ordering {
+
+    OrderingPeerRotation::OrderingPeerRotation(
+        std::shared_ptr<ametsuchi::PeerQuery> wsv,
+        shared_model::interface::types::PubkeyType self_key,
+        shared_model::interface::types::HeightType top_height)
+        : wsv_(std::move(wsv)),
+          self_key_(std::move(self_key)),
+          top_height_(top_height),
+          log_(logger::log("OrderingPeerRotation")) {
+      updatePeers();
+    }
+
+    void OrderingPeerRotation::onCommit(
+        shared_model::interface::types::HeightType height) {
+      // the block could have changed the peers, fetch them before the
+      // height is updated
+      updatePeers();
+      std::lock_guard<std::mutex> lock(mutex_);
+      top_height_ = std::max(top_height_, height);
+    }
+
+    shared_model::interface::types::HeightType
+    OrderingPeerRotation::topHeight() const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return top_height_;
+    }
+
+    boost::optional<OrderingPeerRotation::PeerPtr>
+    OrderingPeerRotation::orderingPeer(
+        shared_model::interface::types::HeightType height) const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (peers_.empty()) {
+        return boost::none;
+      }
+      return peers_.at(height % peers_.size());
+    }
+
+    boost::optional<OrderingPeerRotation::PeerPtr>
+    OrderingPeerRotation::currentOrderingPeer() const {
+      return orderingPeer(topHeight() + 1);
+    }
+
+    bool OrderingPeerRotation::isOrderingPeer(
+        shared_model::interface::types::HeightType height) const {
+      auto peer = orderingPeer(height);
+      return peer and (*peer)->pubkey() == self_key_;
+    }
+
+    void OrderingPeerRotation::updatePeers() {
+      auto peers = wsv_->getLedgerPeers();
+      if (not peers or peers->empty()) {
+        log_->error("Cannot get the peer list, keeping the previous one");
+        return;
+      }
+      // the order of peers in the ledger is not defined
+      std::sort(peers->begin(), peers->end(), [](const auto &a, const auto &b) {
+        return a->pubkey().blob() < b->pubkey().blob();
+      });
+      std::lock_guard<std::mutex> lock(mutex_);
+      peers_ = std::move(*peers);
+    }
+
+  }  // namespace ordering
+}  // namespace iroha
@@ -0,0 +1,107 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_ORDERING_PEER_ROTATION_HPP
+#define IROHA_ORDERING_PEER_ROTATION_HPP
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "ametsuchi/peer_query.hpp"
+#include "interfaces/common_objects/types.hpp"
+#include "logger/logger.hpp"
+
+namespace shared_model {
+  namespace interface {
+    class Peer;
+  }  // namespace interface
+}  // namespace shared_model
+
+namespace iroha {
+  namespace ordering {
+
+    /// key of gRPC metadata, which carries public key of the peer which has
+    /// created the proposal, in hex
+    constexpr const char *kProposalCreatorKey = "proposal-creator";
+
+    /**
+     * Schedule of ordering peers, when the proposal creator changes every
+     * round. Proposal of height h is created by the peer with index h mod n
+     * in the list of n ledger peers sorted by public key, so that all peers
+     * agree on the schedule. If the ordering peer is silent, the peers commit
+     * an empty block of its height after the round timeout of the ordering
+     * gate, and the turn goes to the peer of the next height.
+     *
+     * Height of the ledger and the list of peers are updated on commit.
+     * Thread-safe.
+     */
+    class OrderingPeerRotation {
+     public:
+      using PeerPtr = std::shared_ptr<shared_model::interface::Peer>;
+
+      /**
+       * @param wsv - source of the ledger peers
+       * @param self_key - public key of this peer
+       * @param top_height - height of the last block stored on this peer
+       */
+      OrderingPeerRotation(
+          std::shared_ptr<ametsuchi::PeerQuery> wsv,
+          shared_model::interface::types::PubkeyType self_key,
+          shared_model::interface::types::HeightType top_height);
+
+      /**
+       * Move to the next round after a block is committed
+       * @param height - height of the committed block
+       */
+      void onCommit(shared_model::interface::types::HeightType height);
+
+      /**
+       * @return height of the last committed block
+       */
+      shared_model::interface::types::HeightType topHeight() const;
+
+      /**
+       * @param height - height of the proposal
+       * @return peer which creates proposal of given height, none if there
+       * are no peers in the ledger
+       */
+      boost::optional<PeerPtr> orderingPeer(
+          shared_model::interface::types::HeightType height) const;
+
+      /**
+       * @return peer which creates proposal for the next block
+       */
+      boost::optional<PeerPtr> currentOrderingPeer() const;
+
+      /**
+       * @param height - height of the proposal
+       * @return true if this peer creates proposal of given height
+       */
+      bool isOrderingPeer(
+          shared_model::interface::types::HeightType height) const;
+
+     private:
+      /**
+       * Fetch list of peers from the ledger, keeps the previous one on error
+       */
+      void updatePeers();
+
+      std::shared_ptr<ametsuchi::PeerQuery> wsv_;
+      const shared_model::interface::types::PubkeyType self_key_;
+
+      mutable std::mutex mutex_;
+      std::vector<PeerPtr> peers_;
+      shared_model::interface::types::HeightType top_height_;
+
+      logger::Logger log_;
+    };
+
+  }  // namespace ordering
+}  // namespace iroha
+
+#endif  // IROHA_ORDERING_PEER_ROTATION_HPP
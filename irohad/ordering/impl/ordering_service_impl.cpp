@@ -7,8 +7,10 @@
 
 #include <algorithm>
 #include <iterator>
+#include <numeric>
 
 #include <boost/range/adaptor/indirected.hpp>
+#include <boost/range/size.hpp>
 
 #include "ametsuchi/ordering_service_persistent_state.hpp"
 #include "ametsuchi/peer_query.hpp"
@@ -17,6 +19,27 @@
 
 namespace iroha {
   namespace ordering {
+    namespace {
+      /**
+       * @return total number of signatures of the batch transactions
+       */
+      size_t signaturesCount(
+          const shared_model::interface::TransactionBatch &batch) {
+        return std::accumulate(batch.transactions().begin(),
+                               batch.transactions().end(),
+                               size_t{0},
+                               [](size_t sum, const auto &tx) {
+                                 return sum + boost::size(tx->signatures());
+                               });
+      }
+    }  // namespace
+
+    constexpr const char *OrderingServiceImpl::kDroppedCounter;
+    constexpr size_t OrderingServiceImpl::kDefaultQueueCapacity;
+    constexpr size_t OrderingServiceImpl::kQueueCapacityInProposals;
+    constexpr std::chrono::milliseconds
+        OrderingServiceImpl::kQueueStateInterval;
+
     OrderingServiceImpl::OrderingServiceImpl(
         std::shared_ptr<ametsuchi::PeerQuery> wsv,
         size_t max_size,
@@ -25,76 +48,267 @@ namespace iroha {
         std::shared_ptr<ametsuchi::OrderingServicePersistentState>
             persistent_state,
         std::unique_ptr<shared_model::interface::ProposalFactory> factory,
-        bool is_async)
+        bool is_async,
+        std::shared_ptr<DuplicateBatchFilter> duplicate_filter,
+        size_t max_bytes,
+        std::shared_ptr<AdaptiveProposalSize> adaptive_size,
+        std::shared_ptr<OrderingPeerRotation> rotation,
+        boost::optional<size_t> high_water_mark,
+        std::shared_ptr<metrics::MetricsSink> sink)
         : wsv_(wsv),
+          // every batch has at least one transaction, so the queue never
+          // fills up before the high-water mark is reached
+          queue_(queueLimit(max_size, high_water_mark)),
           max_size_(max_size),
+          max_bytes_(max_bytes),
+          high_water_mark_(queueLimit(max_size, high_water_mark)),
+          overloaded_(false),
+          last_state_report_(0),
           current_size_(0),
+          current_bytes_(0),
           transport_(transport),
           persistent_state_(persistent_state),
           factory_(std::move(factory)),
+          duplicate_filter_(std::move(duplicate_filter)),
+          sink_(std::move(sink)),
+          adaptive_size_(std::move(adaptive_size)),
+          rotation_(std::move(rotation)),
           log_(logger::log("OrderingServiceImpl")) {
-      // restore state of ordering service from persistent storage
-      proposal_height_ = persistent_state_->loadProposalHeight().value();
-
-      rxcpp::observable<ProposalEvent> timer =
-          proposal_timeout.map([](auto) { return ProposalEvent::kTimerEvent; });
-
-      auto subscribe = [&](auto merge_strategy) {
-        handle_ = merge_strategy(rxcpp::observable<>::from(
-                                     timer, transactions_.get_observable()))
-                      .subscribe([this](auto &&v) {
-                        auto check_queue = [&] {
-                          switch (v) {
-                            case ProposalEvent::kTimerEvent:
-                              return not queue_.empty();
-                            case ProposalEvent::kBatchEvent:
-                              return current_size_.load() >= max_size_;
-                            default:
-                              BOOST_ASSERT_MSG(false, "Unknown value");
-                          }
-                        };
-                        if (check_queue()) {
-                          this->generateProposal();
-                        }
-                      });
-      };
+      // restore state of ordering service from persistent storage, unless
+      // proposal height follows the ledger
+      proposal_height_ = rotation_
+          ? rotation_->topHeight() + 1
+          : persistent_state_->loadProposalHeight().value();
 
       if (is_async) {
-        subscribe([](auto observable) {
-          return observable.merge(rxcpp::synchronize_new_thread());
-        });
-      } else {
-        subscribe([](auto observable) { return observable.merge(); });
+        cutter_ = std::thread([this] { this->cutProposals(); });
       }
+
+      handle_ = proposal_timeout.subscribe([this](auto) { this->onTimer(); });
+    }
+
+    size_t OrderingServiceImpl::queueLimit(
+        size_t max_size, boost::optional<size_t> high_water_mark) {
+      return high_water_mark.value_or(std::max(
+          kDefaultQueueCapacity, max_size * kQueueCapacityInProposals));
     }
 
     void OrderingServiceImpl::onBatch(
         shared_model::interface::TransactionBatch &&batch) {
-      std::shared_lock<std::shared_timed_mutex> batch_prop_lock(
-          batch_prop_mutex_);
+      if (duplicate_filter_
+          and not duplicate_filter_->insert(batch.reducedHash(),
+                                            signaturesCount(batch))) {
+        log_->debug("Dropping duplicate batch {}", batch.reducedHash().hex());
+        return;
+      }
 
-      current_size_.fetch_add(batch.transactions().size());
-      queue_.push(std::make_unique<shared_model::interface::TransactionBatch>(
-          std::move(batch)));
-      log_->info("Queue size is {}", current_size_.load());
+      QueuedBatch queued;
+      queued.bytes = std::accumulate(
+          batch.transactions().begin(),
+          batch.transactions().end(),
+          size_t{0},
+          [](size_t sum, const auto &tx) { return sum + tx->blob().size(); });
+      queued.batch =
+          std::make_unique<shared_model::interface::TransactionBatch>(
+              std::move(batch));
 
-      batch_prop_lock.unlock();
+      // size is increased before the batch is pushed, so that it never
+      // becomes less than the number of transactions which can be popped
+      auto batch_size = queued.batch->transactions().size();
+      auto batch_bytes = queued.bytes;
+      auto size = current_size_.fetch_add(batch_size) + batch_size;
+      auto bytes = current_bytes_.fetch_add(batch_bytes) + batch_bytes;
+      if (size > high_water_mark_ or not queue_.tryPush(std::move(queued))) {
+        current_size_ -= batch_size;
+        current_bytes_ -= batch_bytes;
+        log_->error("Queue is full, dropping batch");
+        if (sink_) {
+          sink_->onCounter(kDroppedCounter, 1);
+        }
+        // the batch may be sent again after the queue is drained
+        if (duplicate_filter_) {
+          duplicate_filter_->forget(queued.batch->reducedHash());
+        }
+        updateQueueState(size);
+        return;
+      }
+      log_->info("Queue size is {}", size);
+      updateQueueState(size);
 
-      std::lock_guard<std::mutex> event_lock(event_mutex_);
-      transactions_.get_subscriber().on_next(ProposalEvent::kBatchEvent);
+      if (not isFull(size, bytes)) {
+        return;
+      }
+      if (cutter_.joinable()) {
+        // only the batch which fills the proposal wakes the thread up, it
+        // cuts proposals until the queue is not full by itself
+        if (not isFull(size - batch_size, bytes - batch_bytes)) {
+          std::lock_guard<std::mutex> lock(wake_mutex_);
+          wake_cv_.notify_one();
+        }
+      } else {
+        generateProposal();
+      }
+    }
+
+    size_t OrderingServiceImpl::maxSize() const {
+      return adaptive_size_ ? adaptive_size_->size() : max_size_;
+    }
+
+    bool OrderingServiceImpl::isFull(size_t size, size_t bytes) const {
+      return size >= maxSize() or bytes >= max_bytes_;
+    }
+
+    bool OrderingServiceImpl::isRoundOpen() const {
+      if (not rotation_) {
+        return true;
+      }
+      return rotation_->topHeight() + 1 >= proposal_height_;
+    }
+
+    void OrderingServiceImpl::updateQueueState(size_t size) {
+      auto overloaded = overloaded_.load();
+      auto now = std::chrono::steady_clock::now().time_since_epoch().count();
+      if (overloaded ? size <= high_water_mark_ / 2
+                     : size >= high_water_mark_) {
+        // only the thread which changes the state reports it
+        if (overloaded_.compare_exchange_strong(overloaded, not overloaded)) {
+          last_state_report_ = now;
+          publishQueueState(not overloaded, size);
+        }
+        return;
+      }
+      auto last_report = last_state_report_.load();
+      auto interval =
+          std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+              kQueueStateInterval)
+              .count();
+      if (overloaded and now - last_report >= interval
+          and last_state_report_.compare_exchange_strong(last_report, now)) {
+        publishQueueState(true, size);
+      }
+    }
+
+    void OrderingServiceImpl::publishQueueState(bool overloaded, size_t size) {
+      if (cutter_.joinable()) {
+        // only the latest state matters, an unsent one is replaced
+        std::lock_guard<std::mutex> lock(wake_mutex_);
+        queue_state_ = QueueState{overloaded, size};
+        wake_cv_.notify_one();
+        return;
+      }
+      sendQueueState(overloaded, size);
+    }
+
+    void OrderingServiceImpl::sendQueueState(bool overloaded, size_t size) {
+      if (overloaded) {
+        log_->warn("Queue is overloaded with {} transactions", size);
+      } else {
+        log_->info("Queue is no longer overloaded, {} transactions", size);
+      }
+      auto peers = wsv_->getLedgerPeers();
+      if (not peers) {
+        log_->error("Cannot get the peer list");
+        return;
+      }
+      std::vector<std::string> addresses;
+      std::transform(peers->begin(),
+                     peers->end(),
+                     std::back_inserter(addresses),
+                     [](auto &p) { return p->address(); });
+      transport_->publishQueueState(overloaded, size, addresses);
+    }
+
+    void OrderingServiceImpl::onTimer() {
+      if (cutter_.joinable()) {
+        std::lock_guard<std::mutex> lock(wake_mutex_);
+        timer_expired_ = true;
+        wake_cv_.notify_one();
+      } else if (current_size_.load() > 0) {
+        generateProposal();
+      }
+    }
+
+    void OrderingServiceImpl::cutProposals() {
+      std::unique_lock<std::mutex> lock(wake_mutex_);
+      while (true) {
+        wake_cv_.wait(lock, [this] {
+          return stopped_ or timer_expired_ or queue_state_
+              or (isFull(current_size_.load(), current_bytes_.load())
+                  and isRoundOpen());
+        });
+        if (stopped_) {
+          return;
+        }
+        auto timer_expired = timer_expired_;
+        timer_expired_ = false;
+        auto queue_state = queue_state_;
+        queue_state_ = boost::none;
+        lock.unlock();
+
+        if (queue_state) {
+          sendQueueState(queue_state->overloaded, queue_state->size);
+        }
+
+        auto size = current_size_.load();
+        if ((isFull(size, current_bytes_.load()) and isRoundOpen())
+            or (timer_expired and size > 0)) {
+          generateProposal();
+        }
+
+        lock.lock();
+      }
     }
 
     void OrderingServiceImpl::generateProposal() {
-      std::lock_guard<std::shared_timed_mutex> lock(batch_prop_mutex_);
+      std::lock_guard<std::mutex> lock(proposal_mutex_);
+      if (rotation_) {
+        auto height = rotation_->topHeight() + 1;
+        if (not rotation_->isOrderingPeer(height)) {
+          forwardBatches(height);
+          return;
+        }
+        if (height < proposal_height_) {
+          log_->debug("Proposal of height {} is already created", height);
+          return;
+        }
+        proposal_height_ = height;
+      }
       log_->info("Start proposal generation");
+      auto max_size = maxSize();
       std::vector<std::shared_ptr<shared_model::interface::Transaction>> txs;
-      for (std::unique_ptr<shared_model::interface::TransactionBatch> batch;
-           txs.size() < max_size_ and queue_.try_pop(batch);) {
+      size_t bytes = 0;
+      // the batch which does not fit the byte budget is kept for the next
+      // proposal, unless it is the first one
+      while (txs.size() < max_size
+             and (pending_.batch or queue_.tryPop(pending_))) {
+        if (not txs.empty() and bytes + pending_.bytes > max_bytes_) {
+          break;
+        }
+        auto queued = std::move(pending_);
+        auto &batch = queued.batch;
         auto batch_size = batch->transactions().size();
+        if (duplicate_filter_
+            and not duplicate_filter_->proposed(batch->reducedHash(),
+                                                signaturesCount(*batch))) {
+          // a copy with more signatures has been queued after this one
+          current_size_ -= batch_size;
+          current_bytes_ -= queued.bytes;
+          continue;
+        }
         txs.insert(std::end(txs),
             std::make_move_iterator(std::begin(batch->transactions())),
             std::make_move_iterator(std::end(batch->transactions())));
+        bytes += queued.bytes;
         current_size_ -= batch_size;
+        current_bytes_ -= queued.bytes;
+      }
+      if (txs.empty()) {
+        // batches are still being pushed by other threads
+        return;
+      }
+      updateQueueState(current_size_.load());
+      if (adaptive_size_) {
+        adaptive_size_->proposed(proposal_height_, txs.size());
       }
 
       auto tx_range = txs | boost::adaptors::indirected;
@@ -105,8 +319,10 @@ namespace iroha {
           [this](expected::Value<
                  std::unique_ptr<shared_model::interface::Proposal>> &v) {
             // Save proposal height to the persistent storage.
-            // In case of restart it reloads state.
-            if (persistent_state_->saveProposalHeight(proposal_height_)) {
+            // In case of restart it reloads state. Height of rotating
+            // ordering peers is restored from the ledger instead.
+            if (rotation_
+                or persistent_state_->saveProposalHeight(proposal_height_)) {
               publishProposal(std::move(v.value));
             } else {
               // TODO(@l4l) 23/03/18: publish proposal independent of psql
@@ -120,6 +336,27 @@ namespace iroha {
           });
     }
 
+    void OrderingServiceImpl::forwardBatches(
+        shared_model::interface::types::HeightType height) {
+      auto peer = rotation_->orderingPeer(height);
+      if (not peer) {
+        log_->error("No ordering peer for height {}", height);
+        return;
+      }
+      const auto &address = (*peer)->address();
+      while (pending_.batch or queue_.tryPop(pending_)) {
+        auto queued = std::move(pending_);
+        current_size_ -= queued.batch->transactions().size();
+        current_bytes_ -= queued.bytes;
+        // the batch may come back if peers disagree on the current round
+        if (duplicate_filter_) {
+          duplicate_filter_->forget(queued.batch->reducedHash());
+        }
+        transport_->forwardBatch(*queued.batch, address);
+      }
+      updateQueueState(current_size_.load());
+    }
+
     void OrderingServiceImpl::publishProposal(
         std::unique_ptr<shared_model::interface::Proposal> proposal) {
       auto peers = wsv_->getLedgerPeers();
@@ -137,6 +374,14 @@ namespace iroha {
 
     OrderingServiceImpl::~OrderingServiceImpl() {
       handle_.unsubscribe();
+      if (cutter_.joinable()) {
+        {
+          std::lock_guard<std::mutex> lock(wake_mutex_);
+          stopped_ = true;
+        }
+        wake_cv_.notify_one();
+        cutter_.join();
+      }
     }
   }  // namespace ordering
 }  // namespace iroha
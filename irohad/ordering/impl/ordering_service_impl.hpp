@@ -6,14 +6,21 @@
 #ifndef IROHA_ORDERING_SERVICE_IMPL_HPP
 #define IROHA_ORDERING_SERVICE_IMPL_HPP
 
+#include <chrono>
+#include <condition_variable>
+#include <limits>
 #include <memory>
-#include <shared_mutex>
+#include <thread>
 
-#include <tbb/concurrent_queue.h>
+#include <boost/optional.hpp>
 #include <rxcpp/rx.hpp>
 
+#include "common/mpsc_ring_buffer.hpp"
 #include "logger/logger.hpp"
 #include "network/ordering_service.hpp"
+#include "ordering/impl/adaptive_proposal_size.hpp"
+#include "ordering/impl/duplicate_batch_filter.hpp"
+#include "ordering/impl/ordering_peer_rotation.hpp"
 #include "ordering.grpc.pb.h"
 #include "interfaces/iroha_internal/proposal_factory.hpp"
 
@@ -29,12 +36,18 @@ namespace iroha {
     /**
      * OrderingService implementation with gRPC synchronous server
      * Allows receiving transactions concurrently from multiple peers by using
-     * concurrent queue
-     * Sends proposal by given timer interval and proposal size
+     * lock-free bounded queue
+     * Sends proposal by given timer interval and proposal size: proposals are
+     * cut by a dedicated thread, which wakes up when the queue reaches
+     * proposal size or the timer fires
      */
     class OrderingServiceImpl : public network::OrderingService {
      public:
       using TimeoutType = long;
+
+      /// name of the counter of batches rejected because of the full queue
+      static constexpr const char *kDroppedCounter = "ordering_dropped_batches";
+
       /**
        * Constructor
        * @param wsv interface for fetching peers from world state view
@@ -43,7 +56,23 @@ namespace iroha {
        * @param transport receive transactions and publish proposals
        * @param persistent_state storage for auxiliary information
        * @param factory is used to generate proposals
-       * @param is_async whether proposals are generated in a separate thread
+       * @param is_async whether proposals are generated in a separate thread,
+       * otherwise they are generated in the thread of the triggering event
+       * @param duplicate_filter - set of batches which are queued or
+       * proposed recently, duplicates are not filtered if it is null
+       * @param max_bytes - limit of proposal size in bytes, a batch exceeding
+       * it alone makes a proposal by itself
+       * @param adaptive_size - source of proposal size which replaces
+       * max_size, may be null
+       * @param rotation - schedule of ordering peers, if it is set proposals
+       * are created only in rounds of this peer with heights following the
+       * ledger, batches received in other rounds are forwarded to the current
+       * ordering peer
+       * @param high_water_mark - number of queued transactions, over which
+       * new batches are rejected and ordering gates are told to stop sending
+       * them, kDefaultQueueCapacity or kQueueCapacityInProposals maximum
+       * size proposals, whichever is larger, by default
+       * @param sink - receiver of the number of rejected batches, may be null
        */
       OrderingServiceImpl(
           std::shared_ptr<ametsuchi::PeerQuery> wsv,
@@ -53,11 +82,19 @@ namespace iroha {
           std::shared_ptr<ametsuchi::OrderingServicePersistentState>
               persistent_state,
           std::unique_ptr<shared_model::interface::ProposalFactory> factory,
-          bool is_async = true);
+          bool is_async = true,
+          std::shared_ptr<DuplicateBatchFilter> duplicate_filter = nullptr,
+          size_t max_bytes = std::numeric_limits<size_t>::max(),
+          std::shared_ptr<AdaptiveProposalSize> adaptive_size = nullptr,
+          std::shared_ptr<OrderingPeerRotation> rotation = nullptr,
+          boost::optional<size_t> high_water_mark = boost::none,
+          std::shared_ptr<metrics::MetricsSink> sink = nullptr);
 
       /**
        * Process transaction(s) received from network
-       * Enqueues transactions and publishes corresponding event
+       * Enqueues transactions and publishes corresponding event, batches which
+       * are already queued or proposed are dropped, as well as ones which
+       * would raise the queue over the high-water mark
        * @param batch, in which transactions are packed
        */
       void onBatch(shared_model::interface::TransactionBatch &&batch) override;
@@ -73,10 +110,23 @@ namespace iroha {
           std::unique_ptr<shared_model::interface::Proposal> proposal) override;
 
      private:
+      /// number of transactions the queue is able to hold by default, the
+      /// cells are allocated beforehand, so it is not unlimited
+      static constexpr size_t kDefaultQueueCapacity = 1 << 18;
+      /// number of maximum size proposals which the queue is able to hold at
+      /// least by default
+      static constexpr size_t kQueueCapacityInProposals = 16;
+
       /**
-       * Events for queue check strategy
+       * @param max_size - limit of proposal size
+       * @param high_water_mark - configured limit of the queue, if any
+       * @return number of transactions over which batches are rejected
        */
-      enum class ProposalEvent { kBatchEvent, kTimerEvent };
+      static size_t queueLimit(size_t max_size,
+                               boost::optional<size_t> high_water_mark);
+
+      /// interval of queue state reports while the queue is overloaded
+      static constexpr std::chrono::milliseconds kQueueStateInterval{1000};
 
       /**
        * Collect transactions from queue
@@ -84,11 +134,74 @@ namespace iroha {
        */
       void generateProposal() override;
 
+      /**
+       * @return current max number of txs in proposal
+       */
+      size_t maxSize() const;
+
+      /**
+       * @return true if a queue with given number of transactions and bytes
+       * has enough of them for a proposal
+       */
+      bool isFull(size_t size, size_t bytes) const;
+
+      /**
+       * @return false if proposal of the current round has been created
+       * already, so there is no use in cutting proposals until commit
+       */
+      bool isRoundOpen() const;
+
+      /**
+       * Pass all queued batches to ordering service of the peer which
+       * creates proposal of given height
+       */
+      void forwardBatches(shared_model::interface::types::HeightType height);
+
+      /**
+       * Track whether the queue is overloaded and report changes to ordering
+       * gates. Overload begins at the high-water mark and ends when the queue
+       * shrinks to half of it, it is reported again every kQueueStateInterval
+       * while it lasts
+       * @param size - current number of queued transactions
+       */
+      void updateQueueState(size_t size);
+
+      /**
+       * Send queue state to ordering gates of all peers. It is passed to the
+       * proposal cutting thread if there is one, so that the thread which
+       * receives batches does not wait for the ledger and the network
+       */
+      void publishQueueState(bool overloaded, size_t size);
+
+      /**
+       * Send queue state to ordering gates of all peers in the calling thread
+       */
+      void sendQueueState(bool overloaded, size_t size);
+
+      /**
+       * Process proposal timer event
+       */
+      void onTimer();
+
+      /**
+       * Body of the proposal cutting thread
+       */
+      void cutProposals();
+
       std::shared_ptr<ametsuchi::PeerQuery> wsv_;
 
-      tbb::concurrent_queue<
-          std::unique_ptr<shared_model::interface::TransactionBatch>>
-          queue_;
+      /**
+       * Batch with its size in bytes
+       */
+      struct QueuedBatch {
+        std::unique_ptr<shared_model::interface::TransactionBatch> batch;
+        size_t bytes = 0;
+      };
+
+      MpscRingBuffer<QueuedBatch> queue_;
+
+      /// batch popped from the queue, which did not fit the previous proposal
+      QueuedBatch pending_;
 
       /**
        * max number of txs in proposal
@@ -96,10 +209,32 @@ namespace iroha {
       const size_t max_size_;
 
       /**
-       * current number of transactions in a queue
+       * max number of bytes in proposal
+       */
+      const size_t max_bytes_;
+
+      /**
+       * number of queued transactions, over which batches are rejected
+       */
+      const size_t high_water_mark_;
+
+      /// whether gates were told that the queue is overloaded
+      std::atomic_bool overloaded_;
+
+      /// steady clock time of the last queue state report
+      std::atomic<std::chrono::steady_clock::rep> last_state_report_;
+
+      /**
+       * current number of transactions in a queue, includes ones which are
+       * being pushed at the moment
        */
       std::atomic_ulong current_size_;
 
+      /**
+       * current number of bytes of transactions in a queue
+       */
+      std::atomic_ulong current_bytes_;
+
       std::shared_ptr<network::OrderingServiceTransport> transport_;
 
       /**
@@ -116,22 +251,40 @@ namespace iroha {
        */
       size_t proposal_height_;
 
-      /// Observable for transaction events from the network
-      rxcpp::subjects::subject<ProposalEvent> transactions_;
-
-      /// Internal event observable handle
+      /// Timer subscription handle
       rxcpp::composite_subscription handle_;
 
       /**
        * Variables for concurrency
        */
-      /// mutex for both batch and proposal generation
-      std::shared_timed_mutex batch_prop_mutex_;
-      /// mutex for events activating
-      std::mutex event_mutex_;
+      /// mutex for proposal generation, queue allows only one consumer
+      std::mutex proposal_mutex_;
+      /// mutex for the cutting thread wake up conditions
+      std::mutex wake_mutex_;
+      std::condition_variable wake_cv_;
+      bool timer_expired_ = false;
+      bool stopped_ = false;
+
+      /**
+       * Queue state, which is reported to ordering gates
+       */
+      struct QueueState {
+        bool overloaded;
+        size_t size;
+      };
+      /// the latest queue state, which is not sent yet by the cutting thread
+      boost::optional<QueueState> queue_state_;
+      std::thread cutter_;
 
       std::unique_ptr<shared_model::interface::ProposalFactory> factory_;
 
+      std::shared_ptr<DuplicateBatchFilter> duplicate_filter_;
+      std::shared_ptr<metrics::MetricsSink> sink_;
+
+      std::shared_ptr<AdaptiveProposalSize> adaptive_size_;
+
+      std::shared_ptr<OrderingPeerRotation> rotation_;
+
       logger::Logger log_;
     };
   }  // namespace ordering
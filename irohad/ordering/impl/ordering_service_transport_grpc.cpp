@@ -16,10 +16,13 @@
  */
 #include "ordering/impl/ordering_service_transport_grpc.hpp"
 
+#include <algorithm>
+
 #include "backend/protobuf/transaction.hpp"
 #include "builders/protobuf/proposal.hpp"
 #include "interfaces/common_objects/transaction_sequence_common.hpp"
 #include "network/impl/grpc_channel_builder.hpp"
+#include "ordering/impl/ordering_peer_rotation.hpp"
 #include "validators/default_validator.hpp"
 
 using namespace iroha::ordering;
@@ -37,21 +40,7 @@ grpc::Status OrderingServiceTransportGrpc::onTransaction(
   if (subscriber_.expired()) {
     log_->error("No subscriber");
   } else {
-    auto batch_result =
-        shared_model::interface::TransactionBatch::createTransactionBatch<
-            shared_model::validation::DefaultTransactionValidator>(
-            std::make_shared<shared_model::proto::Transaction>(
-                iroha::protocol::Transaction(*request)));
-    batch_result.match(
-        [this](iroha::expected::Value<shared_model::interface::TransactionBatch>
-                   &batch) {
-          subscriber_.lock()->onBatch(std::move(batch.value));
-        },
-        [this](const iroha::expected::Error<std::string> &error) {
-          log_->error(
-              "Could not create batch from received single transaction: {}",
-              error.error);
-        });
+    processTransaction(*request);
   }
 
   return ::grpc::Status::OK;
@@ -65,54 +54,102 @@ grpc::Status OrderingServiceTransportGrpc::onBatch(
   if (subscriber_.expired()) {
     log_->error("No subscriber");
   } else {
-    auto txs =
-        std::vector<std::shared_ptr<shared_model::interface::Transaction>>(
-            request->transactions_size());
-    std::transform(
-        std::begin(request->transactions()),
-        std::end(request->transactions()),
-        std::begin(txs),
-        [](const auto &tx) {
-          return std::make_shared<shared_model::proto::Transaction>(tx);
-        });
-
-    auto batch_result =
-        shared_model::interface::TransactionBatch::createTransactionBatch(
-            txs,
-            shared_model::validation::SignedTransactionsCollectionValidator<
-                shared_model::validation::DefaultTransactionValidator,
-                shared_model::validation::BatchOrderValidator>());
-    batch_result.match(
-        [this](iroha::expected::Value<shared_model::interface::TransactionBatch>
-                   &batch) {
-          subscriber_.lock()->onBatch(std::move(batch.value));
-        },
-        [this](const iroha::expected::Error<std::string> &error) {
-          log_->error(
-              "Could not create batch from received transaction list: {}",
-              error.error);
-        });
+    processBatch(*request);
+  }
+  return ::grpc::Status::OK;
+}
+
+grpc::Status OrderingServiceTransportGrpc::onBatches(
+    ::grpc::ServerContext *context,
+    const proto::BatchList *request,
+    ::google::protobuf::Empty *response) {
+  log_->info("OrderingServiceTransportGrpc::onBatches, {} batches",
+             request->batches_size());
+  if (subscriber_.expired()) {
+    log_->error("No subscriber");
+  } else {
+    // batches are independent, an invalid one does not affect the rest
+    for (const auto &batch : request->batches()) {
+      processBatch(batch);
+    }
   }
   return ::grpc::Status::OK;
 }
 
+void OrderingServiceTransportGrpc::processTransaction(
+    const protocol::Transaction &transaction_transport) {
+  auto batch_result =
+      shared_model::interface::TransactionBatch::createTransactionBatch<
+          shared_model::validation::DefaultTransactionValidator>(
+          std::make_shared<shared_model::proto::Transaction>(
+              iroha::protocol::Transaction(transaction_transport)));
+  batch_result.match(
+      [this](iroha::expected::Value<shared_model::interface::TransactionBatch>
+                 &batch) {
+        if (auto subscriber = subscriber_.lock()) {
+          subscriber->onBatch(std::move(batch.value));
+        }
+      },
+      [this](const iroha::expected::Error<std::string> &error) {
+        log_->error(
+            "Could not create batch from received single transaction: {}",
+            error.error);
+      });
+}
+
+void OrderingServiceTransportGrpc::processBatch(
+    const protocol::TxList &batch_transport) {
+  // ordering gate sends single transactions as lists of one, when it
+  // coalesces them with batches
+  if (batch_transport.transactions_size() == 1
+      and not batch_transport.transactions(0).payload().has_batch()) {
+    processTransaction(batch_transport.transactions(0));
+    return;
+  }
+  auto txs = std::vector<std::shared_ptr<shared_model::interface::Transaction>>(
+      batch_transport.transactions_size());
+  std::transform(
+      std::begin(batch_transport.transactions()),
+      std::end(batch_transport.transactions()),
+      std::begin(txs),
+      [](const auto &tx) {
+        return std::make_shared<shared_model::proto::Transaction>(tx);
+      });
+
+  auto batch_result =
+      shared_model::interface::TransactionBatch::createTransactionBatch(
+          txs,
+          shared_model::validation::SignedTransactionsCollectionValidator<
+              shared_model::validation::DefaultTransactionValidator,
+              shared_model::validation::BatchOrderValidator>());
+  batch_result.match(
+      [this](iroha::expected::Value<shared_model::interface::TransactionBatch>
+                 &batch) {
+        if (auto subscriber = subscriber_.lock()) {
+          subscriber->onBatch(std::move(batch.value));
+        }
+      },
+      [this](const iroha::expected::Error<std::string> &error) {
+        log_->error("Could not create batch from received transaction list: {}",
+                    error.error);
+      });
+}
+
 void OrderingServiceTransportGrpc::publishProposal(
     std::unique_ptr<shared_model::interface::Proposal> proposal,
     const std::vector<std::string> &peers) {
   log_->info("OrderingServiceTransportGrpc::publishProposal");
-  std::unordered_map<std::string,
-                     std::unique_ptr<proto::OrderingGateTransportGrpc::Stub>>
-      peers_map;
-  for (const auto &peer : peers) {
-    peers_map[peer] =
-        network::createClient<proto::OrderingGateTransportGrpc>(peer);
-  }
+  auto proto = static_cast<shared_model::proto::Proposal *>(proposal.get());
+  log_->debug("Publishing proposal: '{}'",
+              proto->getTransport().DebugString());
 
-  for (const auto &peer : peers_map) {
+  std::lock_guard<std::mutex> lock(peer_stubs_mutex_);
+  updatePeerStubs(peers);
+  for (const auto &peer : peer_stubs_) {
     auto call = new AsyncClientCall;
-    auto proto = static_cast<shared_model::proto::Proposal *>(proposal.get());
-    log_->debug("Publishing proposal: '{}'",
-                proto->getTransport().DebugString());
+    if (creator_key_) {
+      call->context.AddMetadata(kProposalCreatorKey, *creator_key_);
+    }
     call->response_reader = peer.second->AsynconProposal(
         &call->context, proto->getTransport(), &cq_);
 
@@ -120,6 +157,73 @@ void OrderingServiceTransportGrpc::publishProposal(
   }
 }
 
-OrderingServiceTransportGrpc::OrderingServiceTransportGrpc()
+void OrderingServiceTransportGrpc::forwardBatch(
+    const shared_model::interface::TransactionBatch &batch,
+    const std::string &peer) {
+  log_->info("Forward batch to {}", peer);
+  iroha::protocol::TxList batch_transport;
+  for (const auto &tx : batch.transactions()) {
+    *batch_transport.add_transactions() =
+        std::static_pointer_cast<shared_model::proto::Transaction>(tx)
+            ->getTransport();
+  }
+
+  std::lock_guard<std::mutex> lock(peer_stubs_mutex_);
+  auto &stub = service_stubs_[peer];
+  if (not stub) {
+    stub = network::createKeepAliveClient<proto::OrderingServiceTransportGrpc>(
+        peer);
+  }
+  auto call = new AsyncClientCall;
+  call->response_reader =
+      stub->AsynconBatch(&call->context, batch_transport, &cq_);
+
+  call->response_reader->Finish(&call->reply, &call->status, call);
+}
+
+void OrderingServiceTransportGrpc::publishQueueState(
+    bool overloaded, size_t size, const std::vector<std::string> &peers) {
+  log_->info("Publish queue state, overloaded: {}, size: {}", overloaded, size);
+  proto::QueueState state;
+  state.set_overloaded(overloaded);
+  state.set_size(size);
+
+  std::lock_guard<std::mutex> lock(peer_stubs_mutex_);
+  updatePeerStubs(peers);
+  for (const auto &peer : peer_stubs_) {
+    auto call = new AsyncClientCall;
+    call->response_reader =
+        peer.second->AsynconQueueState(&call->context, state, &cq_);
+
+    call->response_reader->Finish(&call->reply, &call->status, call);
+  }
+}
+
+void OrderingServiceTransportGrpc::updatePeerStubs(
+    const std::vector<std::string> &peers) {
+  for (auto it = peer_stubs_.begin(); it != peer_stubs_.end();) {
+    if (std::find(peers.begin(), peers.end(), it->first) == peers.end()) {
+      log_->info("Dropping connection to {}", it->first);
+      it = peer_stubs_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+
+  for (const auto &peer : peers) {
+    auto &stub = peer_stubs_[peer];
+    if (not stub) {
+      stub =
+          network::createKeepAliveClient<proto::OrderingGateTransportGrpc>(peer);
+    }
+  }
+}
+
+OrderingServiceTransportGrpc::OrderingServiceTransportGrpc(
+    boost::optional<shared_model::interface::types::PubkeyType> creator_key)
     : network::AsyncGrpcClient<google::protobuf::Empty>(
-          logger::log("OrderingServiceTransportGrpc")) {}
+          logger::log("OrderingServiceTransportGrpc")) {
+  if (creator_key) {
+    creator_key_ = creator_key->hex();
+  }
+}
@@ -17,8 +17,13 @@
 #ifndef IROHA_ORDERING_SERVICE_TRANSPORT_GRPC_HPP
 #define IROHA_ORDERING_SERVICE_TRANSPORT_GRPC_HPP
 
+#include <mutex>
+#include <unordered_map>
+
 #include <google/protobuf/empty.pb.h>
+#include <boost/optional.hpp>
 
+#include "interfaces/common_objects/types.hpp"
 #include "logger/logger.hpp"
 #include "network/impl/async_grpc_client.hpp"
 #include "network/ordering_service_transport.hpp"
@@ -33,7 +38,14 @@ namespace iroha {
           public proto::OrderingServiceTransportGrpc::Service,
           network::AsyncGrpcClient<google::protobuf::Empty> {
      public:
-      OrderingServiceTransportGrpc();
+      /**
+       * @param creator_key - public key of this peer, which is attached to
+       * published proposals, so that the ordering gates can check that the
+       * proposal is created by the ordering peer of its height
+       */
+      explicit OrderingServiceTransportGrpc(
+          boost::optional<shared_model::interface::types::PubkeyType>
+              creator_key = boost::none);
       void subscribe(
           std::shared_ptr<iroha::network::OrderingServiceNotification>
               subscriber) override;
@@ -42,6 +54,13 @@ namespace iroha {
           std::unique_ptr<shared_model::interface::Proposal> proposal,
           const std::vector<std::string> &peers) override;
 
+      void forwardBatch(const shared_model::interface::TransactionBatch &batch,
+                        const std::string &peer) override;
+
+      void publishQueueState(bool overloaded,
+                             size_t size,
+                             const std::vector<std::string> &peers) override;
+
       grpc::Status onTransaction(::grpc::ServerContext *context,
                                  const protocol::Transaction *request,
                                  ::google::protobuf::Empty *response) override;
@@ -50,10 +69,51 @@ namespace iroha {
                            const protocol::TxList *request,
                            ::google::protobuf::Empty *response) override;
 
+      grpc::Status onBatches(::grpc::ServerContext *context,
+                             const proto::BatchList *request,
+                             ::google::protobuf::Empty *response) override;
+
       ~OrderingServiceTransportGrpc() = default;
 
      private:
+      /**
+       * Validate received transaction, which does not belong to a batch, and
+       * pass it to the subscriber as a batch of one
+       * @param transaction_transport - the transaction
+       */
+      void processTransaction(
+          const protocol::Transaction &transaction_transport);
+
+      /**
+       * Validate received transactions and pass them to the subscriber as a
+       * batch
+       * @param batch_transport - transactions of the batch
+       */
+      void processBatch(const protocol::TxList &batch_transport);
+
+      /**
+       * Synchronize cached clients with the list of proposal recipients:
+       * create clients for new peers and drop ones of peers which are absent
+       * @param peers - addresses of the recipients
+       */
+      void updatePeerStubs(const std::vector<std::string> &peers);
+
       std::weak_ptr<iroha::network::OrderingServiceNotification> subscriber_;
+
+      /// clients of the ordering gates, reused between proposals
+      std::unordered_map<
+          std::string,
+          std::unique_ptr<proto::OrderingGateTransportGrpc::Stub>>
+          peer_stubs_;
+      /// clients of the ordering services of other peers, which batches are
+      /// forwarded to
+      std::unordered_map<
+          std::string,
+          std::unique_ptr<proto::OrderingServiceTransportGrpc::Stub>>
+          service_stubs_;
+      std::mutex peer_stubs_mutex_;
+      /// public key of this peer in hex, if it is attached to proposals
+      boost::optional<std::string> creator_key_;
     };
 
   }  // namespace ordering
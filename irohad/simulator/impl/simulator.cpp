@@ -17,10 +17,9 @@
 
 #include "simulator/impl/simulator.hpp"
 
-#include <boost/range/adaptor/transformed.hpp>
-
+#include "ametsuchi/temporary_wsv.hpp"
+#include "backend/protobuf/block.hpp"
 #include "backend/protobuf/empty_block.hpp"
-#include "builders/protobuf/block.hpp"
 #include "builders/protobuf/empty_block.hpp"
 #include "interfaces/iroha_internal/block.hpp"
 #include "interfaces/iroha_internal/proposal.hpp"
@@ -28,17 +27,61 @@
 namespace iroha {
   namespace simulator {
 
+    namespace {
+      /**
+       * Make unsigned block of the verified proposal without validation.
+       * Transports of transactions are shared with the proposal, when it is
+       * allocated in an arena, and their hashes are carried over. The shared
+       * transports are read only, so both of them stay the same
+       * @param proposal - verified proposal with transactions
+       * @param prev_hash - hash of the top block
+       * @return block
+       */
+      std::shared_ptr<shared_model::proto::Block> makeBlock(
+          const shared_model::interface::Proposal &proposal,
+          const shared_model::interface::types::HashType &prev_hash) {
+        const auto &transactions = proposal.transactions();
+        auto arena = shared_model::proto::transactionsArena(transactions);
+        auto block =
+            google::protobuf::Arena::CreateMessage<iroha::protocol::Block>(
+                arena.get());
+        auto payload = block->mutable_payload();
+        payload->set_height(proposal.height());
+        payload->set_prev_block_hash(
+            shared_model::crypto::toBinaryString(prev_hash));
+        payload->set_created_time(proposal.createdTime());
+
+        std::vector<shared_model::interface::types::HashType> tx_hashes;
+        tx_hashes.reserve(transactions.size());
+        for (const auto &tx : transactions) {
+          shared_model::proto::addTransaction(
+              *payload->mutable_transactions(),
+              arena,
+              static_cast<const shared_model::proto::Transaction &>(tx));
+          tx_hashes.push_back(tx.hash());
+        }
+        payload->set_tx_number(payload->transactions_size());
+
+        return std::make_shared<shared_model::proto::Block>(
+            std::move(arena), block, std::move(tx_hashes));
+      }
+    }  // namespace
+
     Simulator::Simulator(
         std::shared_ptr<network::OrderingGate> ordering_gate,
         std::shared_ptr<validation::StatefulValidator> statefulValidator,
         std::shared_ptr<ametsuchi::TemporaryFactory> factory,
         std::shared_ptr<ametsuchi::BlockQuery> blockQuery,
         std::shared_ptr<shared_model::crypto::CryptoModelSigner<>>
-            crypto_signer)
+            crypto_signer,
+        std::shared_ptr<metrics::RoundTimer> round_timer,
+        bool prepare_blocks)
         : validator_(std::move(statefulValidator)),
           ametsuchi_factory_(std::move(factory)),
           block_queries_(std::move(blockQuery)),
-          crypto_signer_(std::move(crypto_signer)) {
+          crypto_signer_(std::move(crypto_signer)),
+          round_timer_(std::move(round_timer)),
+          prepare_blocks_(prepare_blocks) {
       log_ = logger::log("Simulator");
       ordering_gate->on_proposal().subscribe(
           proposal_subscription_,
@@ -95,11 +138,23 @@ namespace iroha {
       temporaryStorageResult.match(
           [&](expected::Value<std::unique_ptr<ametsuchi::TemporaryWsv>>
                   &temporaryStorage) {
+            metrics::markStage(round_timer_,
+                               metrics::RoundStage::kValidationStarted,
+                               proposal.height());
             auto validated_proposal_and_errors =
                 std::make_shared<iroha::validation::VerifiedProposalAndErrors>(
                     validator_->validate(proposal, *temporaryStorage.value));
+            metrics::markStage(round_timer_,
+                               metrics::RoundStage::kValidationFinished,
+                               proposal.height());
+            // verified proposal is processed synchronously, the block created
+            // from it takes the state
+            if (prepare_blocks_) {
+              validated_wsv_ = std::move(temporaryStorage.value);
+            }
             notifier_.get_subscriber().on_next(
                 std::move(validated_proposal_and_errors));
+            validated_wsv_.reset();
           },
           [&](expected::Error<std::string> &error) {
             log_->error(error.error);
@@ -113,19 +168,15 @@ namespace iroha {
         const shared_model::interface::Proposal &proposal) {
       log_->info("process verified proposal");
 
-      // TODO: Alexey Chernyshov IR-1011 2018-03-08 rework BlockBuilder logic,
-      // so that this cast will not be needed
-      auto proto_txs =
-          proposal.transactions() | boost::adaptors::transformed([](auto &tx) {
-            return static_cast<const shared_model::proto::Transaction &>(tx);
-          });
-
       auto sign_and_send = [this](const auto &any_block) {
         crypto_signer_->sign(*any_block);
+        metrics::markStage(round_timer_,
+                           metrics::RoundStage::kBlockSigned,
+                           any_block->height());
         block_notifier_.get_subscriber().on_next(any_block);
       };
 
-      if (proto_txs.empty()) {
+      if (proposal.transactions().empty()) {
         auto empty_block = std::make_shared<shared_model::proto::EmptyBlock>(
             shared_model::proto::UnsignedEmptyBlockBuilder()
                 .height(proposal.height())
@@ -136,14 +187,20 @@ namespace iroha {
         sign_and_send(empty_block);
         return;
       }
-      auto block = std::make_shared<shared_model::proto::Block>(
-          shared_model::proto::UnsignedBlockBuilder()
-              .height(block_queries_->getTopBlockHeight() + 1)
-              .prevHash(last_block->hash())
-              .transactions(proto_txs)
-              .createdTime(proposal.createdTime())
-              .build());
+      auto block = makeBlock(proposal, last_block->hash());
+      auto answer = block_validator_.validate(*block);
+      if (answer.hasErrors()) {
+        log_->error("Block of height {} is invalid: {}",
+                    block->height(),
+                    answer.reason());
+        validated_wsv_.reset();
+        return;
+      }
 
+      if (validated_wsv_) {
+        ametsuchi_factory_->prepareBlock(
+            std::move(validated_wsv_), block->hash(), last_block->hash());
+      }
       sign_and_send(block);
     }
 
@@ -23,23 +23,32 @@
 #include "ametsuchi/temporary_factory.hpp"
 #include "cryptography/crypto_provider/crypto_model_signer.hpp"
 #include "logger/logger.hpp"
+#include "metrics/round_timer.hpp"
 #include "network/ordering_gate.hpp"
 #include "simulator/block_creator.hpp"
 #include "simulator/verified_proposal_creator.hpp"
 #include "validation/stateful_validator.hpp"
+#include "validators/default_validator.hpp"
 
 namespace iroha {
   namespace simulator {
 
     class Simulator : public VerifiedProposalCreator, public BlockCreator {
      public:
+      /**
+       * @param prepare_blocks - whether the state of stateful validation is
+       * kept to commit the created block from it, otherwise it is rolled back
+       * and the block is executed again on commit
+       */
       Simulator(
           std::shared_ptr<network::OrderingGate> ordering_gate,
           std::shared_ptr<validation::StatefulValidator> statefulValidator,
           std::shared_ptr<ametsuchi::TemporaryFactory> factory,
           std::shared_ptr<ametsuchi::BlockQuery> blockQuery,
           std::shared_ptr<shared_model::crypto::CryptoModelSigner<>>
-              crypto_signer);
+              crypto_signer,
+          std::shared_ptr<metrics::RoundTimer> round_timer = nullptr,
+          bool prepare_blocks = false);
 
       Simulator(const Simulator &) = delete;
       Simulator &operator=(const Simulator &) = delete;
@@ -74,6 +83,13 @@ namespace iroha {
       std::shared_ptr<ametsuchi::TemporaryFactory> ametsuchi_factory_;
       std::shared_ptr<ametsuchi::BlockQuery> block_queries_;
       std::shared_ptr<shared_model::crypto::CryptoModelSigner<>> crypto_signer_;
+      std::shared_ptr<metrics::RoundTimer> round_timer_;
+      const bool prepare_blocks_;
+      /// stateless checks of the block assembled from the verified proposal
+      shared_model::validation::DefaultUnsignedBlockValidator block_validator_;
+
+      /// state after stateful validation of the proposal being processed
+      std::unique_ptr<ametsuchi::TemporaryWsv> validated_wsv_;
 
       logger::Logger log_;
 
@@ -30,10 +30,12 @@ namespace iroha {
         std::shared_ptr<network::ConsensusGate> consensus_gate,
         std::shared_ptr<validation::ChainValidator> validator,
         std::shared_ptr<ametsuchi::MutableFactory> mutableFactory,
-        std::shared_ptr<network::BlockLoader> blockLoader)
+        std::shared_ptr<network::BlockLoader> blockLoader,
+        std::shared_ptr<metrics::RoundTimer> round_timer)
         : validator_(std::move(validator)),
           mutableFactory_(std::move(mutableFactory)),
-          blockLoader_(std::move(blockLoader)) {
+          blockLoader_(std::move(blockLoader)),
+          round_timer_(std::move(round_timer)) {
       log_ = logger::log("synchronizer");
       consensus_gate->on_commit().subscribe(
           subscription_,
@@ -80,6 +82,9 @@ namespace iroha {
         // Block can be applied to current storage
         // Commit to main Ametsuchi
         mutableFactory_->commit(std::move(storage));
+        metrics::markStage(round_timer_,
+                           metrics::RoundStage::kCommitApplied,
+                           commit_message->height());
 
         auto single_commit = rxcpp::observable<>::just(commit_message);
 
@@ -115,6 +120,9 @@ namespace iroha {
               and is_chain_end_expected) {
             // Peer send valid chain
             mutableFactory_->commit(std::move(storage));
+            metrics::markStage(round_timer_,
+                               metrics::RoundStage::kCommitApplied,
+                               blocks.back()->height());
             notifier_.get_subscriber().on_next(chain);
             // You are synchronized
             return;
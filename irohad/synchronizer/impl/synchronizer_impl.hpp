@@ -19,6 +19,7 @@
 
 #include "ametsuchi/mutable_factory.hpp"
 #include "logger/logger.hpp"
+#include "metrics/round_timer.hpp"
 #include "network/block_loader.hpp"
 #include "network/consensus_gate.hpp"
 #include "synchronizer/synchronizer.hpp"
@@ -32,7 +33,8 @@ namespace iroha {
           std::shared_ptr<network::ConsensusGate> consensus_gate,
           std::shared_ptr<validation::ChainValidator> validator,
           std::shared_ptr<ametsuchi::MutableFactory> mutableFactory,
-          std::shared_ptr<network::BlockLoader> blockLoader);
+          std::shared_ptr<network::BlockLoader> blockLoader,
+          std::shared_ptr<metrics::RoundTimer> round_timer = nullptr);
 
       ~SynchronizerImpl();
 
@@ -45,6 +47,7 @@ namespace iroha {
       std::shared_ptr<validation::ChainValidator> validator_;
       std::shared_ptr<ametsuchi::MutableFactory> mutableFactory_;
       std::shared_ptr<network::BlockLoader> blockLoader_;
+      std::shared_ptr<metrics::RoundTimer> round_timer_;
 
       // internal
       rxcpp::subjects::subject<Commit> notifier_;
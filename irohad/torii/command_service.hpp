@@ -16,6 +16,7 @@
 #include "endpoint.grpc.pb.h"
 #include "endpoint.pb.h"
 #include "logger/logger.hpp"
+#include "network/ordering_load.hpp"
 #include "torii/processor/transaction_processor.hpp"
 #include "torii/status_bus.hpp"
 
@@ -32,13 +33,17 @@ namespace torii {
      * @param status_bus is a common notifier for tx statuses
      * @param initial_timeout - streaming timeout when tx is not received
      * @param nonfinal_timeout - streaming timeout when tx is being processed
+     * @param ordering_load - overload state of the ordering service, new
+     * transactions get OVERLOADED status while it is overloaded, all
+     * transactions are accepted if it is null
      */
     CommandService(
         std::shared_ptr<iroha::torii::TransactionProcessor> tx_processor,
         std::shared_ptr<iroha::ametsuchi::Storage> storage,
         std::shared_ptr<iroha::torii::StatusBus> status_bus,
         std::chrono::milliseconds initial_timeout,
-        std::chrono::milliseconds nonfinal_timeout);
+        std::chrono::milliseconds nonfinal_timeout,
+        std::shared_ptr<iroha::network::OrderingLoad> ordering_load = nullptr);
 
     /**
      * Disable copying in any way to prevent potential issues with common
@@ -132,6 +137,19 @@ namespace torii {
                                   *response_writer) override;
 
    private:
+    /**
+     * @return true if new transactions should be rejected with OVERLOADED
+     * status
+     */
+    bool isOverloaded() const;
+
+    /**
+     * @return true if the transaction has been received already, so it is
+     * not processed again. Transactions rejected because of overload may be
+     * sent again
+     */
+    bool isReceived(const shared_model::crypto::Hash &hash) const;
+
     /**
      * Execute events scheduled in run loop until it is not empty and the
      * subscriber is active
@@ -162,6 +180,7 @@ namespace torii {
     std::chrono::milliseconds initial_timeout_;
     std::chrono::milliseconds nonfinal_timeout_;
     std::shared_ptr<CacheType> cache_;
+    std::shared_ptr<iroha::network::OrderingLoad> ordering_load_;
 
     logger::Logger log_;
   };
@@ -38,26 +38,33 @@ namespace torii {
       std::shared_ptr<iroha::ametsuchi::Storage> storage,
       std::shared_ptr<iroha::torii::StatusBus> status_bus,
       std::chrono::milliseconds initial_timeout,
-      std::chrono::milliseconds nonfinal_timeout)
+      std::chrono::milliseconds nonfinal_timeout,
+      std::shared_ptr<iroha::network::OrderingLoad> ordering_load)
       : tx_processor_(tx_processor),
         storage_(storage),
         status_bus_(status_bus),
         initial_timeout_(initial_timeout),
         nonfinal_timeout_(nonfinal_timeout),
         cache_(std::make_shared<CacheType>()),
+        ordering_load_(std::move(ordering_load)),
         log_(logger::log("CommandService")) {
     // Notifier for all clients
     status_bus_->statuses().subscribe([this](auto iroha_response) {
       // find response for this tx in cache; if status of received response
-      // isn't "greater" than cached one, dismiss received one
+      // isn't "greater" than cached one, dismiss received one. Overloaded
+      // transactions may be sent again, so any status replaces this one,
+      // while it never replaces a known status
       auto proto_response =
           std::static_pointer_cast<shared_model::proto::TransactionResponse>(
               iroha_response);
       auto tx_hash = proto_response->transactionHash();
       auto cached_tx_state = cache_->findItem(tx_hash);
+      auto status = proto_response->getTransport().tx_status();
       if (cached_tx_state
-          and proto_response->getTransport().tx_status()
-              <= cached_tx_state->tx_status()) {
+          and (status == iroha::protocol::TxStatus::OVERLOADED
+               or (cached_tx_state->tx_status()
+                       != iroha::protocol::TxStatus::OVERLOADED
+                   and status <= cached_tx_state->tx_status()))) {
         return;
       }
       cache_->addItem(tx_hash, proto_response->getTransport());
@@ -75,6 +82,17 @@ namespace torii {
     }
   }  // namespace
 
+  bool CommandService::isOverloaded() const {
+    return ordering_load_ and ordering_load_->isOverloaded();
+  }
+
+  bool CommandService::isReceived(
+      const shared_model::crypto::Hash &hash) const {
+    auto cached = cache_->findItem(hash);
+    return cached
+        and cached->tx_status() != iroha::protocol::TxStatus::OVERLOADED;
+  }
+
   void CommandService::Torii(const iroha::protocol::Transaction &request) {
     shared_model::proto::TransportBuilder<
         shared_model::proto::Transaction,
@@ -86,12 +104,27 @@ namespace torii {
                 iroha::expected::Value<shared_model::proto::Transaction>
                     &iroha_tx) {
               auto tx_hash = iroha_tx.value.hash();
-              if (cache_->findItem(tx_hash) and iroha_tx.value.quorum() < 2) {
+              auto received = this->isReceived(tx_hash);
+              if (received and iroha_tx.value.quorum() < 2) {
                 log_->warn("Found transaction {} in cache, ignoring",
                            tx_hash.hex());
                 return;
               }
 
+              if (this->isOverloaded()) {
+                log_->warn("Rejecting tx {}, ordering service is overloaded",
+                           tx_hash.hex());
+                // transaction which is known already keeps its status
+                if (not received) {
+                  this->pushStatus(
+                      "Torii",
+                      tx_hash,
+                      makeResponse(tx_hash,
+                                   iroha::protocol::TxStatus::OVERLOADED));
+                }
+                return;
+              }
+
               // Send transaction to iroha
               tx_processor_->transactionHandle(
                   std::make_shared<shared_model::proto::Transaction>(
@@ -138,9 +171,27 @@ namespace torii {
                     shared_model::interface::TransactionSequence>
                     &tx_sequence) {
               auto txs = tx_sequence.value.transactions();
+              // the whole sequence is rejected, so that its batches are not
+              // split, transactions which are known already keep their status
+              if (this->isOverloaded()) {
+                log_->warn("Rejecting {} txs, ordering service is overloaded",
+                           txs.size());
+                std::for_each(txs.begin(), txs.end(), [this](auto &tx) {
+                  auto tx_hash = tx->hash();
+                  if (this->isReceived(tx_hash)) {
+                    return;
+                  }
+                  this->pushStatus(
+                      "ToriiList",
+                      tx_hash,
+                      makeResponse(tx_hash,
+                                   iroha::protocol::TxStatus::OVERLOADED));
+                });
+                return;
+              }
               std::for_each(txs.begin(), txs.end(), [this](auto &tx) {
                 auto tx_hash = tx->hash();
-                if (cache_->findItem(tx_hash) and tx->quorum() < 2) {
+                if (this->isReceived(tx_hash) and tx->quorum() < 2) {
                   log_->warn("Found transaction {} in cache, ignoring",
                              tx_hash.hex());
                   return;
@@ -252,7 +303,8 @@ namespace torii {
                     shared_model::interface::StatelessFailedTxResponse,
                     shared_model::interface::StatefulFailedTxResponse,
                     shared_model::interface::CommittedTxResponse,
-                    shared_model::interface::MstExpiredResponse>::value;
+                    shared_model::interface::MstExpiredResponse,
+                    shared_model::interface::OverloadedTxResponse>::value;
 
   rxcpp::observable<
       std::shared_ptr<shared_model::interface::TransactionResponse>>
@@ -0,0 +1,194 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "validation/impl/conflict_groups.hpp"
+
+#include <numeric>
+#include <unordered_map>
+
+#include <boost/variant/apply_visitor.hpp>
+#include <boost/variant/static_visitor.hpp>
+
+#include "interfaces/commands/command.hpp"
+#include "interfaces/common_objects/peer.hpp"
+#include "interfaces/transaction.hpp"
+
+namespace {
+  /**
+   * Collects keys accessed by commands. Permissions of an account are checked
+   * through its roles and grantable permissions, which are covered by the key
+   * of the account, and permissions of a role never change after creation
+   */
+  class StateKeysVisitor : public boost::static_visitor<> {
+   public:
+    explicit StateKeysVisitor(std::vector<std::string> &keys) : keys_(keys) {}
+
+    void operator()(
+        const shared_model::interface::AddAssetQuantity &command) const {
+      asset(command.assetId());
+    }
+
+    void operator()(const shared_model::interface::AddPeer &command) const {
+      // signatories are not removed while they are used by peers
+      key(command.peer().pubkey().hex());
+      keys_.push_back("peer:" + command.peer().address());
+    }
+
+    void operator()(
+        const shared_model::interface::AddSignatory &command) const {
+      account(command.accountId());
+      key(command.pubkey().hex());
+    }
+
+    void operator()(const shared_model::interface::AppendRole &command) const {
+      account(command.accountId());
+      role(command.roleName());
+    }
+
+    void operator()(
+        const shared_model::interface::CreateAccount &command) const {
+      account(command.accountName() + "@" + command.domainId());
+      domain(command.domainId());
+      key(command.pubkey().hex());
+    }
+
+    void operator()(const shared_model::interface::CreateAsset &command) const {
+      asset(command.assetName() + "#" + command.domainId());
+      domain(command.domainId());
+    }
+
+    void operator()(
+        const shared_model::interface::CreateDomain &command) const {
+      domain(command.domainId());
+      role(command.userDefaultRole());
+    }
+
+    void operator()(const shared_model::interface::CreateRole &command) const {
+      role(command.roleName());
+    }
+
+    void operator()(const shared_model::interface::DetachRole &command) const {
+      account(command.accountId());
+      role(command.roleName());
+    }
+
+    void operator()(
+        const shared_model::interface::GrantPermission &command) const {
+      account(command.accountId());
+    }
+
+    void operator()(
+        const shared_model::interface::RemoveSignatory &command) const {
+      account(command.accountId());
+      key(command.pubkey().hex());
+    }
+
+    void operator()(
+        const shared_model::interface::RevokePermission &command) const {
+      account(command.accountId());
+    }
+
+    void operator()(
+        const shared_model::interface::SetAccountDetail &command) const {
+      account(command.accountId());
+    }
+
+    void operator()(const shared_model::interface::SetQuorum &command) const {
+      account(command.accountId());
+    }
+
+    void operator()(
+        const shared_model::interface::SubtractAssetQuantity &command) const {
+      asset(command.assetId());
+    }
+
+    void operator()(
+        const shared_model::interface::TransferAsset &command) const {
+      account(command.srcAccountId());
+      account(command.destAccountId());
+      asset(command.assetId());
+    }
+
+    void account(const std::string &id) const {
+      keys_.push_back("account:" + id);
+    }
+
+   private:
+    void asset(const std::string &id) const {
+      keys_.push_back("asset:" + id);
+    }
+
+    void domain(const std::string &id) const {
+      keys_.push_back("domain:" + id);
+    }
+
+    void role(const std::string &id) const {
+      keys_.push_back("role:" + id);
+    }
+
+    void key(const std::string &hex) const {
+      keys_.push_back("key:" + hex);
+    }
+
+    std::vector<std::string> &keys_;
+  };
+}  // namespace
+
+namespace iroha {
+  namespace validation {
+
+    std::vector<std::string> accessedStateKeys(
+        const shared_model::interface::Transaction &tx) {
+      std::vector<std::string> keys;
+      StateKeysVisitor visitor(keys);
+      // creator's account, signatories, quorum and permissions are read for
+      // every transaction, and the creator's assets are changed by asset
+      // quantity commands
+      visitor.account(tx.creatorAccountId());
+      for (const auto &command : tx.commands()) {
+        boost::apply_visitor(visitor, command.get());
+      }
+      return keys;
+    }
+
+    std::vector<std::vector<size_t>> conflictGroups(
+        const std::vector<std::vector<std::string>> &unit_keys) {
+      // disjoint sets of units, the root of a set is its first unit
+      std::vector<size_t> parent(unit_keys.size());
+      std::iota(parent.begin(), parent.end(), 0);
+      auto find = [&parent](size_t unit) {
+        while (parent[unit] != unit) {
+          unit = parent[unit] = parent[parent[unit]];
+        }
+        return unit;
+      };
+
+      std::unordered_map<std::string, size_t> key_owners;
+      for (size_t unit = 0; unit < unit_keys.size(); ++unit) {
+        for (const auto &key : unit_keys[unit]) {
+          auto owner = key_owners.emplace(key, unit);
+          if (not owner.second) {
+            auto first = find(owner.first->second), second = find(unit);
+            if (first != second) {
+              parent[std::max(first, second)] = std::min(first, second);
+            }
+          }
+        }
+      }
+
+      std::vector<std::vector<size_t>> groups;
+      std::unordered_map<size_t, size_t> group_of_root;
+      for (size_t unit = 0; unit < unit_keys.size(); ++unit) {
+        auto group = group_of_root.emplace(find(unit), groups.size());
+        if (group.second) {
+          groups.emplace_back();
+        }
+        groups[group.first->second].push_back(unit);
+      }
+      return groups;
+    }
+
+  }  // namespace validation
+}  // namespace iroha
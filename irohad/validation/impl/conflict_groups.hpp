@@ -0,0 +1,45 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_CONFLICT_GROUPS_HPP
+#define IROHA_CONFLICT_GROUPS_HPP
+
+#include <string>
+#include <vector>
+
+namespace shared_model {
+  namespace interface {
+    class Transaction;
+  }  // namespace interface
+}  // namespace shared_model
+
+namespace iroha {
+  namespace validation {
+
+    /**
+     * Keys of the ledger state, which validation and execution of the
+     * transaction may read or modify: accounts, assets, domains, roles and
+     * public keys. Validation of transactions without common keys does not
+     * depend on their relative order
+     * @param tx - transaction
+     * @return keys accessed by the transaction, may contain duplicates
+     */
+    std::vector<std::string> accessedStateKeys(
+        const shared_model::interface::Transaction &tx);
+
+    /**
+     * Split validation units into groups, so that units of different groups
+     * have no common keys
+     * @param unit_keys - keys accessed by every unit
+     * @return indexes of units of every group in ascending order, groups are
+     * ordered by their first unit
+     */
+    std::vector<std::vector<size_t>> conflictGroups(
+        const std::vector<std::vector<std::string>> &unit_keys);
+
+  }  // namespace validation
+}  // namespace iroha
+
+#endif  // IROHA_CONFLICT_GROUPS_HPP
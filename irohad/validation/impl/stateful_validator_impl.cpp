@@ -17,11 +17,14 @@
 
 #include "validation/impl/stateful_validator_impl.hpp"
 
+#include <atomic>
 #include <boost/format.hpp>
 #include <string>
 
 #include "backend/protobuf/transaction.hpp"
 #include "common/result.hpp"
+#include "common/thread_pool.hpp"
+#include "validation/impl/conflict_groups.hpp"
 #include "validation/utils.hpp"
 
 namespace iroha {
@@ -145,97 +148,253 @@ namespace iroha {
                  });
     };
 
+    /**
+     * Transactions, which are validated together: a single transaction or an
+     * atomic batch
+     */
+    struct ValidationUnit {
+      /// index of the first transaction in the proposal
+      size_t begin;
+      /// index past the last transaction
+      size_t end;
+      bool atomic;
+    };
+
+    /**
+     * Result of unit validation
+     */
+    struct UnitResult {
+      bool valid = false;
+      validation::TransactionsErrors errors;
+    };
+
+    /**
+     * Split transactions into validation units
+     * @param txs to be split
+     * @param units to put units of transactions to in their order
+     * @return index of the first transaction of an atomic batch, which end is
+     * not found, boost::none if all batches are complete
+     */
+    static boost::optional<size_t> splitIntoUnits(
+        const shared_model::interface::types::TransactionsCollectionType &txs,
+        std::vector<ValidationUnit> &units) {
+      auto txs_begin = std::begin(txs);
+      auto txs_end = std::end(txs);
+      for (size_t i = 0; i < txs.size(); ++i) {
+        auto current_tx_it = txs_begin + i;
+        if (not current_tx_it->batchMeta()
+            or current_tx_it->batchMeta()->get()->type()
+                != shared_model::interface::types::BatchType::ATOMIC) {
+          // if transaction does not belong to atomic batch
+          units.push_back({i, i + 1, false});
+          continue;
+        }
+        // find the batch end in proposal's transactions
+        auto batch_end_hash =
+            current_tx_it->batchMeta()->get()->reducedHashes().back();
+        auto batch_end_it =
+            std::find_if(current_tx_it, txs_end, [&batch_end_hash](auto &tx) {
+              return tx.reducedHash() == batch_end_hash;
+            });
+        if (batch_end_it == txs_end) {
+          return i;
+        }
+        auto batch_end = i + std::distance(current_tx_it, batch_end_it) + 1;
+        units.push_back({i, batch_end, true});
+        // move directly to transaction after batch
+        i = batch_end - 1;
+      }
+      return boost::none;
+    }
+
+    /**
+     * Validate transactions of the unit; all transactions of an atomic batch
+     * are applied only if all of them are valid
+     * @param txs of the proposal
+     * @param unit to be validated
+     * @param temporary_wsv to apply transactions on
+     * @return validity of the unit and errors of its transactions
+     */
+    static UnitResult validateUnit(
+        const shared_model::interface::types::TransactionsCollectionType &txs,
+        const ValidationUnit &unit,
+        ametsuchi::TemporaryWsv &temporary_wsv) {
+      UnitResult result;
+      auto unit_begin = std::begin(txs) + unit.begin;
+      if (not unit.atomic) {
+        result.valid =
+            checkTransactions(temporary_wsv, result.errors, *unit_begin);
+        return result;
+      }
+
+      // check all batch's transactions for validness
+      auto savepoint =
+          temporary_wsv.createSavepoint("batch_" + unit_begin->hash().hex());
+      result.valid = std::all_of(
+          unit_begin,
+          std::begin(txs) + unit.end,
+          [&temporary_wsv, &result](auto &tx) {
+            return checkTransactions(temporary_wsv, result.errors, tx);
+          });
+      if (result.valid) {
+        // batch is successful, release savepoint
+        savepoint->release();
+      }
+      return result;
+    }
+
+    /**
+     * Validate groups of units, which do not conflict with each other, in
+     * parallel. Every worker validates whole groups one after another on its
+     * own temporary wsv, so units of a group are validated in their order
+     * @param txs of the proposal
+     * @param units of the proposal
+     * @param unit_results to write results of the units to
+     * @param temporary_wsv to be used by the first worker
+     * @param temporary_factory to create temporary wsv for other workers
+     * @param workers - maximal number of workers, which are run by the shared
+     * thread pool along with the calling thread
+     * @param log to write errors to console
+     */
+    static void validateConcurrently(
+        const shared_model::interface::types::TransactionsCollectionType &txs,
+        const std::vector<ValidationUnit> &units,
+        std::vector<UnitResult> &unit_results,
+        ametsuchi::TemporaryWsv &temporary_wsv,
+        ametsuchi::TemporaryFactory &temporary_factory,
+        size_t workers,
+        const logger::Logger &log) {
+      std::vector<std::vector<std::string>> unit_keys;
+      unit_keys.reserve(units.size());
+      for (const auto &unit : units) {
+        unit_keys.emplace_back();
+        for (auto i = unit.begin; i < unit.end; ++i) {
+          auto keys = accessedStateKeys(*(std::begin(txs) + i));
+          std::move(
+              keys.begin(), keys.end(), std::back_inserter(unit_keys.back()));
+        }
+      }
+      auto groups = conflictGroups(unit_keys);
+      // larger groups are taken first to balance the workers
+      std::stable_sort(
+          groups.begin(), groups.end(), [](const auto &lhs, const auto &rhs) {
+            return lhs.size() > rhs.size();
+          });
+      log->info("validating {} independent groups of transactions",
+                groups.size());
+
+      std::atomic<size_t> next_group{0};
+      auto work = [&](ametsuchi::TemporaryWsv &wsv) {
+        for (auto group = next_group++; group < groups.size();
+             group = next_group++) {
+          for (auto unit : groups[group]) {
+            unit_results[unit] = validateUnit(txs, units[unit], wsv);
+          }
+        }
+      };
+
+      // the shared pool runs the workers, the first one uses the given wsv
+      // and others create their own, while there are groups left for them
+      workers = std::min(workers, groups.size());
+      ThreadPool::shared().parallelFor(workers, [&](size_t worker) {
+        try {
+          if (worker == 0) {
+            work(temporary_wsv);
+            return;
+          }
+          if (next_group >= groups.size()) {
+            return;
+          }
+          temporary_factory.createTemporaryWsv().match(
+              [&](expected::Value<std::unique_ptr<ametsuchi::TemporaryWsv>>
+                      &wsv) { work(*wsv.value); },
+              [&](expected::Error<std::string> &error) {
+                // remaining groups are validated by other workers
+                log->warn("could not create temporary wsv: {}", error.error);
+              });
+        } catch (...) {
+          // let other workers stop after their current groups
+          next_group = groups.size();
+          throw;
+        }
+      });
+    }
+
     /**
      * Validate all transactions supplied; includes special rules, such as batch
      * validation etc
      * @param txs to be validated
-     * @param temporary_wsv to apply transactions on
+     * @param unit_validator - function, which validates units of transactions
+     * and puts their results in the same order
      * @param transactions_errors_log to write errors to
      * @param log to write errors to console
      * @return vector of proto transactions, which passed stateful validation
      */
     static std::vector<shared_model::proto::Transaction> validateTransactions(
         const shared_model::interface::types::TransactionsCollectionType &txs,
-        ametsuchi::TemporaryWsv &temporary_wsv,
+        const std::function<void(const std::vector<ValidationUnit> &,
+                                 std::vector<UnitResult> &)> &unit_validator,
         validation::TransactionsErrors &transactions_errors_log,
         const logger::Logger &log) {
+      std::vector<ValidationUnit> units;
+      auto incomplete_batch = splitIntoUnits(txs, units);
+      std::vector<UnitResult> unit_results(units.size());
+      unit_validator(units, unit_results);
+
+      // transactions reference transports of the proposal, which are not
+      // copied
       std::vector<shared_model::proto::Transaction> valid_proto_txs{};
+      valid_proto_txs.reserve(txs.size());
       // TODO: kamilsa IR-1010 20.02.2018 rework validation logic, so that
       // casts to proto are not needed and stateful validator does not know
       // about the transport
-      auto txs_begin = std::begin(txs);
-      auto txs_end = std::end(txs);
-      for (size_t i = 0; i < txs.size(); ++i) {
-        auto current_tx_it = txs_begin + i;
-        if (not current_tx_it->batchMeta()
-            or current_tx_it->batchMeta()->get()->type()
-                != shared_model::interface::types::BatchType::ATOMIC) {
-          // if transaction does not belong to atomic batch
-          if (checkTransactions(
-                  temporary_wsv, transactions_errors_log, *current_tx_it)) {
-            // and it is valid
-            valid_proto_txs.push_back(
-                static_cast<const shared_model::proto::Transaction &>(
-                    *current_tx_it));
-          }
-        } else {
-          // find the batch end in proposal's transactions
-          auto batch_end_hash =
-              current_tx_it->batchMeta()->get()->reducedHashes().back();
-          auto batch_end_it =
-              std::find_if(current_tx_it, txs_end, [&batch_end_hash](auto &tx) {
-                return tx.reducedHash() == batch_end_hash;
+      for (size_t i = 0; i < units.size(); ++i) {
+        auto &result = unit_results[i];
+        std::move(result.errors.begin(),
+                  result.errors.end(),
+                  std::back_inserter(transactions_errors_log));
+        if (result.valid) {
+          std::transform(
+              std::begin(txs) + units[i].begin,
+              std::begin(txs) + units[i].end,
+              std::back_inserter(valid_proto_txs),
+              [](const auto &tx) {
+                return static_cast<const shared_model::proto::Transaction &>(
+                    tx);
               });
-          if (batch_end_it == txs_end) {
-            // exceptional case, such batch should not have passed stateless
-            // validation, so fail the whole proposal
-            auto batch_error_msg =
-                (boost::format("batch is formed incorrectly: could not "
-                               "find end of batch; "
-                               "first transaction is %s, supposed last "
-                               "transaction is %s")
-                 % current_tx_it->hash().hex() % batch_end_hash.hex())
-                    .str();
-            transactions_errors_log.emplace_back(std::make_pair(
-                validation::CommandError{
-                    "batch stateful validation", batch_error_msg, true},
-                current_tx_it->hash()));
-            log->error(std::move(batch_error_msg));
-            return std::vector<shared_model::proto::Transaction>{};
-          }
-
-          // check all batch's transactions for validness
-          auto savepoint = temporary_wsv.createSavepoint(
-              "batch_" + current_tx_it->hash().hex());
-          if (std::all_of(current_tx_it,
-                          batch_end_it + 1,
-                          [&temporary_wsv, &transactions_errors_log](auto &tx) {
-                            return checkTransactions(
-                                temporary_wsv, transactions_errors_log, tx);
-                          })) {
-            // batch is successful; add it to the list of valid_txs and
-            // release savepoint
-            std::transform(
-                current_tx_it,
-                batch_end_it + 1,
-                std::back_inserter(valid_proto_txs),
-                [](const auto &tx) {
-                  return static_cast<const shared_model::proto::Transaction &>(
-                      tx);
-                });
-            savepoint->release();
-          }
-
-          // move directly to transaction after batch
-          i += std::distance(current_tx_it, batch_end_it);
         }
       }
+
+      if (incomplete_batch) {
+        // exceptional case, such batch should not have passed stateless
+        // validation, so fail the whole proposal
+        auto current_tx_it = std::begin(txs) + *incomplete_batch;
+        auto batch_error_msg =
+            (boost::format("batch is formed incorrectly: could not "
+                           "find end of batch; "
+                           "first transaction is %s, supposed last "
+                           "transaction is %s")
+             % current_tx_it->hash().hex()
+             % current_tx_it->batchMeta()->get()->reducedHashes().back().hex())
+                .str();
+        transactions_errors_log.emplace_back(std::make_pair(
+            validation::CommandError{
+                "batch stateful validation", batch_error_msg, true},
+            current_tx_it->hash()));
+        log->error(std::move(batch_error_msg));
+        return std::vector<shared_model::proto::Transaction>{};
+      }
       return valid_proto_txs;
     }
 
     StatefulValidatorImpl::StatefulValidatorImpl(
-        std::unique_ptr<shared_model::interface::UnsafeProposalFactory> factory)
-        : factory_(std::move(factory)), log_(logger::log("SFV")) {}
+        std::unique_ptr<shared_model::interface::UnsafeProposalFactory> factory,
+        std::shared_ptr<ametsuchi::TemporaryFactory> temporary_factory,
+        size_t validation_threads)
+        : factory_(std::move(factory)),
+          log_(logger::log("SFV")),
+          temporary_factory_(std::move(temporary_factory)),
+          validation_threads_(validation_threads) {}
 
     validation::VerifiedProposalAndErrors StatefulValidatorImpl::validate(
         const shared_model::interface::Proposal &proposal,
@@ -244,8 +403,27 @@ namespace iroha {
                  proposal.transactions().size());
 
       auto transactions_errors_log = validation::TransactionsErrors{};
+      const auto &txs = proposal.transactions();
       auto valid_proto_txs = validateTransactions(
-          proposal.transactions(), temporaryWsv, transactions_errors_log, log_);
+          txs,
+          [&](const auto &units, auto &unit_results) {
+            if (temporary_factory_ and validation_threads_ > 1
+                and units.size() > 1) {
+              validateConcurrently(txs,
+                                   units,
+                                   unit_results,
+                                   temporaryWsv,
+                                   *temporary_factory_,
+                                   validation_threads_,
+                                   log_);
+              return;
+            }
+            for (size_t i = 0; i < units.size(); ++i) {
+              unit_results[i] = validateUnit(txs, units[i], temporaryWsv);
+            }
+          },
+          transactions_errors_log,
+          log_);
 
       // Since proposal came from ordering gate it was already validated.
       // All transactions has been validated as well
@@ -17,6 +17,7 @@
 #ifndef IROHA_STATEFUL_VALIDATIOR_IMPL_HPP
 #define IROHA_STATEFUL_VALIDATIOR_IMPL_HPP
 
+#include "ametsuchi/temporary_factory.hpp"
 #include "interfaces/iroha_internal/unsafe_proposal_factory.hpp"
 #include "validation/stateful_validator.hpp"
 
@@ -30,9 +31,23 @@ namespace iroha {
      */
     class StatefulValidatorImpl : public StatefulValidator {
      public:
+      /**
+       * @param factory - factory of verified proposals
+       * @param temporary_factory - factory of temporary wsv for parallel
+       * validation
+       * @param validation_threads - number of workers validating transactions,
+       * which access disjoint accounts, assets and roles, in parallel on
+       * separate temporary wsv. The workers are run by the shared thread
+       * pool, so no more of them run at once than there are cores. Given
+       * temporary wsv has only changes of the transactions validated by the
+       * first worker in that case
+       */
       explicit StatefulValidatorImpl(
           std::unique_ptr<shared_model::interface::UnsafeProposalFactory>
-              factory);
+              factory,
+          std::shared_ptr<ametsuchi::TemporaryFactory> temporary_factory =
+              nullptr,
+          size_t validation_threads = 1);
 
       VerifiedProposalAndErrors validate(
           const shared_model::interface::Proposal &proposal,
@@ -40,6 +55,10 @@ namespace iroha {
 
       std::unique_ptr<shared_model::interface::UnsafeProposalFactory> factory_;
       logger::Logger log_;
+
+     private:
+      std::shared_ptr<ametsuchi::TemporaryFactory> temporary_factory_;
+      size_t validation_threads_;
     };
 
   }  // namespace validation
@@ -0,0 +1,129 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_MPSC_RING_BUFFER_HPP
+#define IROHA_MPSC_RING_BUFFER_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace iroha {
+
+  /**
+   * Bounded lock-free queue for multiple producers and a single consumer.
+   *
+   * Every cell carries a sequence number which tells whether it is free for
+   * the producer at given position or filled for the consumer, so producers
+   * only compete for the position counter (D. Vyukov's bounded queue).
+   * @tparam T - type of elements, must be default constructible and move
+   * assignable
+   */
+  template <typename T>
+  class MpscRingBuffer {
+   public:
+    /**
+     * @param capacity - minimal number of elements the queue can hold, it is
+     * rounded up to a power of two
+     */
+    explicit MpscRingBuffer(size_t capacity)
+        : capacity_(roundUp(capacity)),
+          mask_(capacity_ - 1),
+          cells_(new Cell[capacity_]),
+          enqueue_pos_(0),
+          dequeue_pos_(0) {
+      for (size_t i = 0; i < capacity_; ++i) {
+        cells_[i].sequence.store(i, std::memory_order_relaxed);
+      }
+    }
+
+    MpscRingBuffer(const MpscRingBuffer &) = delete;
+    MpscRingBuffer &operator=(const MpscRingBuffer &) = delete;
+
+    /**
+     * Put element to the queue, may be called from any thread
+     * @param value - element to put, it is left untouched if the queue is
+     * full
+     * @return false if the queue is full
+     */
+    bool tryPush(T &&value) {
+      auto pos = enqueue_pos_.load(std::memory_order_relaxed);
+      Cell *cell;
+      while (true) {
+        cell = &cells_[pos & mask_];
+        auto sequence = cell->sequence.load(std::memory_order_acquire);
+        auto diff =
+            static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+        if (diff == 0) {
+          if (enqueue_pos_.compare_exchange_weak(
+                  pos, pos + 1, std::memory_order_relaxed)) {
+            break;
+          }
+        } else if (diff < 0) {
+          return false;
+        } else {
+          pos = enqueue_pos_.load(std::memory_order_relaxed);
+        }
+      }
+      cell->value = std::move(value);
+      cell->sequence.store(pos + 1, std::memory_order_release);
+      return true;
+    }
+
+    /**
+     * Take the oldest element from the queue, must be called by one thread
+     * at a time
+     * @param value - receiver of the element
+     * @return false if the queue is empty or the oldest element is not
+     * completely pushed yet
+     */
+    bool tryPop(T &value) {
+      auto &cell = cells_[dequeue_pos_ & mask_];
+      auto sequence = cell.sequence.load(std::memory_order_acquire);
+      if (static_cast<intptr_t>(sequence)
+              - static_cast<intptr_t>(dequeue_pos_ + 1)
+          < 0) {
+        return false;
+      }
+      value = std::move(cell.value);
+      cell.value = T();
+      cell.sequence.store(dequeue_pos_ + capacity_, std::memory_order_release);
+      ++dequeue_pos_;
+      return true;
+    }
+
+    size_t capacity() const {
+      return capacity_;
+    }
+
+   private:
+    struct Cell {
+      std::atomic<size_t> sequence;
+      T value;
+    };
+
+    static size_t roundUp(size_t capacity) {
+      size_t result = 2;
+      while (result < capacity) {
+        result <<= 1;
+      }
+      return result;
+    }
+
+    const size_t capacity_;
+    const size_t mask_;
+    std::unique_ptr<Cell[]> cells_;
+
+    // positions are modified by different threads, keep them in separate
+    // cache lines
+    char padding_before_[64];
+    std::atomic<size_t> enqueue_pos_;
+    char padding_between_[64];
+    size_t dequeue_pos_;
+  };
+
+}  // namespace iroha
+
+#endif  // IROHA_MPSC_RING_BUFFER_HPP
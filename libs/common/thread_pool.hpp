@@ -0,0 +1,161 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_THREAD_POOL_HPP
+#define IROHA_THREAD_POOL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace iroha {
+
+  /**
+   * Fixed set of threads, which split loops over indices with the calling
+   * thread
+   */
+  class ThreadPool {
+   public:
+    /**
+     * @param workers - number of threads of the pool
+     */
+    explicit ThreadPool(size_t workers) {
+      for (size_t i = 0; i < workers; ++i) {
+        threads_.emplace_back([this] { run(); });
+      }
+    }
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    ~ThreadPool() {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopped_ = true;
+      }
+      tasks_cv_.notify_all();
+      for (auto &thread : threads_) {
+        thread.join();
+      }
+    }
+
+    /**
+     * Call function for every index from 0 to count, the calling thread
+     * takes part in the loop. Order of calls is not specified
+     * @param count - number of indices
+     * @param function - called once for each index, must be thread safe
+     * @throws the first exception thrown by function, after the loop is
+     * stopped
+     */
+    void parallelFor(size_t count,
+                     const std::function<void(size_t)> &function) {
+      auto loop = std::make_shared<Loop>(count, function);
+      auto helpers = std::min(threads_.size(), count > 0 ? count - 1 : 0);
+      if (helpers > 0) {
+        {
+          std::lock_guard<std::mutex> lock(mutex_);
+          for (size_t i = 0; i < helpers; ++i) {
+            tasks_.push([loop] { loop->help(); });
+          }
+        }
+        tasks_cv_.notify_all();
+      }
+
+      loop->work();
+      // helpers, which have not started yet, will find no indices left, so
+      // only the running ones are waited for
+      std::unique_lock<std::mutex> lock(loop->mutex);
+      loop->done.wait(lock, [&loop] { return loop->running == 0; });
+      if (loop->failure) {
+        std::rethrow_exception(loop->failure);
+      }
+    }
+
+    /**
+     * @return pool with a thread per core, which is shared by the process
+     */
+    static ThreadPool &shared() {
+      static ThreadPool pool(
+          std::max(std::thread::hardware_concurrency(), 2u) - 1);
+      return pool;
+    }
+
+   private:
+    struct Loop {
+      Loop(size_t count, const std::function<void(size_t)> &function)
+          : count(count), function(function) {}
+
+      void help() {
+        {
+          std::lock_guard<std::mutex> lock(mutex);
+          if (next >= count) {
+            return;
+          }
+          ++running;
+        }
+        work();
+        std::lock_guard<std::mutex> lock(mutex);
+        if (--running == 0) {
+          done.notify_one();
+        }
+      }
+
+      void work() {
+        for (auto i = next++; i < count; i = next++) {
+          try {
+            function(i);
+          } catch (...) {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (not failure) {
+              failure = std::current_exception();
+            }
+            next = count;
+          }
+        }
+      }
+
+      const size_t count;
+      const std::function<void(size_t)> &function;
+      std::atomic<size_t> next{0};
+      size_t running{0};
+      std::exception_ptr failure;
+      std::mutex mutex;
+      std::condition_variable done;
+    };
+
+    void run() {
+      while (true) {
+        std::function<void()> task;
+        {
+          std::unique_lock<std::mutex> lock(mutex_);
+          tasks_cv_.wait(lock,
+                         [this] { return stopped_ or not tasks_.empty(); });
+          if (tasks_.empty()) {
+            return;
+          }
+          task = std::move(tasks_.front());
+          tasks_.pop();
+        }
+        task();
+      }
+    }
+
+    std::vector<std::thread> threads_;
+    std::queue<std::function<void()>> tasks_;
+    bool stopped_{false};
+    std::mutex mutex_;
+    std::condition_variable tasks_cv_;
+  };
+
+}  // namespace iroha
+
+#endif  // IROHA_THREAD_POOL_HPP
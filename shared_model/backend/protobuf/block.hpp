@@ -37,6 +37,16 @@ namespace shared_model {
      public:
       using NonCopyableProto::NonCopyableProto;
 
+      /**
+       * @param arena - arena of the transport
+       * @param block - transport of the block allocated in the arena
+       * @param tx_hashes - hashes of its transactions in the same order,
+       * which are known from the transactions the block is made of
+       */
+      Block(std::shared_ptr<google::protobuf::Arena> arena,
+            TransportType *block,
+            std::vector<interface::types::HashType> tx_hashes);
+
       Block(Block &&o) noexcept;
       Block &operator=(Block &&o) noexcept;
 
@@ -65,23 +75,24 @@ namespace shared_model {
       template <typename T>
       using Lazy = detail::LazyInitializer<T>;
 
-      iroha::protocol::Block::Payload &payload_{*proto_.mutable_payload()};
+      iroha::protocol::Block::Payload *payload_{proto_->mutable_payload()};
+
+      std::vector<interface::types::HashType> tx_hashes_;
 
       Lazy<std::vector<proto::Transaction>> transactions_{[this] {
-        return std::vector<proto::Transaction>(
-            payload_.mutable_transactions()->begin(),
-            payload_.mutable_transactions()->end());
+        return makeTransactions(
+            *payload_->mutable_transactions(), arena_, tx_hashes_);
       }};
 
       Lazy<interface::types::BlobType> blob_{
-          [this] { return makeBlob(proto_); }};
+          [this] { return makeBlob(*proto_); }};
 
       Lazy<interface::types::HashType> prev_hash_{[this] {
-        return interface::types::HashType(proto_.payload().prev_block_hash());
+        return interface::types::HashType(payload_->prev_block_hash());
       }};
 
       Lazy<SignatureSetType<proto::Signature>> signatures_{[this] {
-        auto signatures = proto_.signatures()
+        auto signatures = proto_->signatures()
             | boost::adaptors::transformed([](const auto &x) {
                             return proto::Signature(x);
                           });
@@ -90,7 +101,7 @@ namespace shared_model {
       }};
 
       Lazy<interface::types::BlobType> payload_blob_{
-          [this] { return makeBlob(payload_); }};
+          [this] { return makeBlob(*payload_); }};
     };
   }  // namespace proto
 }  // namespace shared_model
@@ -6,6 +6,10 @@
 #ifndef IROHA_NONCOPYABLE_PROTO_HPP
 #define IROHA_NONCOPYABLE_PROTO_HPP
 
+#include <memory>
+
+#include <google/protobuf/arena.h>
+
 /**
  * Generic class for handling proto objects which are not intended to be copied.
  * @tparam Iface is interface to inherit from
@@ -18,24 +22,53 @@ class NonCopyableProto : public Iface {
   using TransportType = Proto;
 
   /*
-   * Construct object from transport. Transport can be moved or copied.
+   * Construct object from copy of transport. The copy is allocated in an
+   * arena of the object, so that its fields are allocated and freed at once.
    */
-  template <typename Transport>
-  NonCopyableProto(Transport &&ref) : proto_(std::forward<Transport>(ref)){}
+  NonCopyableProto(const Proto &ref)
+      : arena_(std::make_shared<google::protobuf::Arena>()),
+        proto_(arena_,
+               google::protobuf::Arena::CreateMessage<Proto>(arena_.get())) {
+    proto_->CopyFrom(ref);
+  }
+
+  /*
+   * Construct object from moved transport, which stays on the heap.
+   */
+  NonCopyableProto(Proto &&ref)
+      : proto_(std::make_shared<Proto>(std::move(ref))) {}
+
+  /*
+   * Construct object from transport allocated in the arena. The object shares
+   * ownership of the arena.
+   */
+  NonCopyableProto(std::shared_ptr<google::protobuf::Arena> arena, Proto *ref)
+      : arena_(std::move(arena)), proto_(arena_, ref) {}
+
+  NonCopyableProto(NonCopyableProto &&o) noexcept = default;
+  NonCopyableProto &operator=(NonCopyableProto &&o) noexcept = default;
 
   NonCopyableProto(const NonCopyableProto &o) = delete;
   NonCopyableProto &operator=(const NonCopyableProto &o) = delete;
 
   const Proto &getTransport() const {
-    return proto_;
+    return *proto_;
+  }
+
+  /**
+   * @return arena of the transport, nullptr if it is allocated on the heap
+   */
+  const std::shared_ptr<google::protobuf::Arena> &getArena() const {
+    return arena_;
   }
 
  protected:
   typename Iface::ModelType *clone() const override final {
-    return new Impl(proto_);
+    return new Impl(*proto_);
   }
 
-  Proto proto_;
+  std::shared_ptr<google::protobuf::Arena> arena_;
+  std::shared_ptr<Proto> proto_;
 };
 
 #endif  // IROHA_NONCOPYABLE_PROTO_HPP
@@ -7,11 +7,19 @@
 
 namespace shared_model {
   namespace proto {
-    Block::Block(Block &&o) noexcept : NonCopyableProto(std::move(o.proto_)) {}
+    Block::Block(std::shared_ptr<google::protobuf::Arena> arena,
+                 TransportType *block,
+                 std::vector<interface::types::HashType> tx_hashes)
+        : NonCopyableProto(std::move(arena), block),
+          tx_hashes_(std::move(tx_hashes)) {}
+
+    Block::Block(Block &&o) noexcept
+        : NonCopyableProto(std::move(o)), tx_hashes_(std::move(o.tx_hashes_)) {}
 
     Block &Block::operator=(Block &&o) noexcept {
-      proto_ = std::move(o.proto_);
-      payload_ = *proto_.mutable_payload();
+      NonCopyableProto::operator=(std::move(o));
+      tx_hashes_ = std::move(o.tx_hashes_);
+      payload_ = proto_->mutable_payload();
 
       transactions_.invalidate();
       blob_.invalidate();
@@ -27,7 +35,7 @@ namespace shared_model {
     }
 
     interface::types::HeightType Block::height() const {
-      return payload_.height();
+      return payload_->height();
     }
 
     const interface::types::HashType &Block::prevHash() const {
@@ -57,7 +65,7 @@ namespace shared_model {
         return false;
       }
 
-      auto sig = proto_.add_signatures();
+      auto sig = proto_->add_signatures();
       sig->set_signature(crypto::toBinaryString(signed_blob));
       sig->set_pubkey(crypto::toBinaryString(public_key));
 
@@ -66,11 +74,11 @@ namespace shared_model {
     }
 
     interface::types::TimestampType Block::createdTime() const {
-      return payload_.created_time();
+      return payload_->created_time();
     }
 
     interface::types::TransactionsNumberType Block::txsNumber() const {
-      return payload_.tx_number();
+      return payload_->tx_number();
     }
 
     const interface::types::BlobType &Block::payload() const {
@@ -9,11 +9,18 @@ namespace shared_model {
   namespace proto {
     using namespace interface::types;
 
+    Proposal::Proposal(std::shared_ptr<google::protobuf::Arena> arena,
+                       TransportType *proposal,
+                       std::vector<interface::types::HashType> tx_hashes)
+        : NonCopyableProto(std::move(arena), proposal),
+          tx_hashes_(std::move(tx_hashes)) {}
+
     Proposal::Proposal(Proposal &&o) noexcept
-        : NonCopyableProto(std::move(o.proto_)) {}
+        : NonCopyableProto(std::move(o)), tx_hashes_(std::move(o.tx_hashes_)) {}
 
     Proposal &Proposal::operator=(Proposal &&o) noexcept {
-      proto_ = std::move(o.proto_);
+      NonCopyableProto::operator=(std::move(o));
+      tx_hashes_ = std::move(o.tx_hashes_);
       transactions_.invalidate();
 
       return *this;
@@ -24,11 +31,11 @@ namespace shared_model {
     }
 
     TimestampType Proposal::createdTime() const {
-      return proto_.created_time();
+      return proto_->created_time();
     }
 
     HeightType Proposal::height() const {
-      return proto_.height();
+      return proto_->height();
     }
 
   }  // namespace proto
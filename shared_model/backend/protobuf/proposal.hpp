@@ -23,6 +23,16 @@ namespace shared_model {
      public:
       using NonCopyableProto::NonCopyableProto;
 
+      /**
+       * @param arena - arena of the transport
+       * @param proposal - transport of the proposal allocated in the arena
+       * @param tx_hashes - hashes of its transactions in the same order,
+       * which are known from the transactions the proposal is made of
+       */
+      Proposal(std::shared_ptr<google::protobuf::Arena> arena,
+               TransportType *proposal,
+               std::vector<interface::types::HashType> tx_hashes);
+
       Proposal(Proposal &&o) noexcept;
       Proposal &operator=(Proposal &&o) noexcept;
 
@@ -37,10 +47,11 @@ namespace shared_model {
       template <typename T>
       using Lazy = detail::LazyInitializer<T>;
 
+      std::vector<interface::types::HashType> tx_hashes_;
+
       const Lazy<std::vector<proto::Transaction>> transactions_{[this] {
-        return std::vector<proto::Transaction>(
-            proto_.mutable_transactions()->begin(),
-            proto_.mutable_transactions()->end());
+        return makeTransactions(
+            *proto_->mutable_transactions(), arena_, tx_hashes_);
       }};
     };
   }  // namespace proto
@@ -22,7 +22,7 @@ namespace shared_model {
           interface::types::TimestampType created_time,
           const interface::types::TransactionsCollectionType &transactions)
           override {
-        return createProposal(
+        return validate(
             createProtoProposal(height, created_time, transactions));
       }
 
@@ -31,8 +31,7 @@ namespace shared_model {
           interface::types::TimestampType created_time,
           const interface::types::TransactionsCollectionType &transactions)
           override {
-        return std::make_unique<Proposal>(
-            createProtoProposal(height, created_time, transactions));
+        return createProtoProposal(height, created_time, transactions);
       }
 
       /**
@@ -44,22 +43,41 @@ namespace shared_model {
       }
 
      private:
-      iroha::protocol::Proposal createProtoProposal(
+      std::unique_ptr<Proposal> createProtoProposal(
           interface::types::HeightType height,
           interface::types::TimestampType created_time,
           const interface::types::TransactionsCollectionType &transactions) {
-        iroha::protocol::Proposal proposal;
+        // transactions of a proposal, which is made of another one, share
+        // the arena of the latter and are not copied
+        auto arena = transactionsArena(transactions);
+        auto proposal =
+            google::protobuf::Arena::CreateMessage<iroha::protocol::Proposal>(
+                arena.get());
 
-        proposal.set_height(height);
-        proposal.set_created_time(created_time);
+        proposal->set_height(height);
+        proposal->set_created_time(created_time);
 
         for (const auto &tx : transactions) {
-          *proposal.add_transactions() =
-              static_cast<const shared_model::proto::Transaction &>(tx)
-                  .getTransport();
+          addTransaction(*proposal->mutable_transactions(),
+                         arena,
+                         static_cast<const Transaction &>(tx));
         }
 
-        return proposal;
+        return std::make_unique<Proposal>(
+            std::move(arena), proposal, transactionHashes(transactions));
+      }
+
+      /**
+       * Hashes of transactions are passed to the proposal, so that they are
+       * not computed again from its transport
+       */
+      std::vector<interface::types::HashType> transactionHashes(
+          const interface::types::TransactionsCollectionType &transactions) {
+        std::vector<interface::types::HashType> hashes;
+        for (const auto &tx : transactions) {
+          hashes.push_back(tx.hash());
+        }
+        return hashes;
       }
 
       FactoryResult<std::unique_ptr<interface::Proposal>> validate(
@@ -21,6 +21,7 @@
 #include "interfaces/transaction.hpp"
 
 #include <boost/range/adaptor/transformed.hpp>
+#include <google/protobuf/arena.h>
 
 #include "backend/protobuf/commands/proto_command.hpp"
 #include "backend/protobuf/common_objects/signature.hpp"
@@ -37,10 +38,60 @@ namespace shared_model {
       explicit Transaction(TransactionType &&transaction)
           : CopyableProto(std::forward<TransactionType>(transaction)) {}
 
-      Transaction(const Transaction &o) : Transaction(o.proto_) {}
+      /**
+       * @param transaction - transport of the transaction
+       * @param hash - hash of its payload, which is known already
+       */
+      template <typename TransactionType>
+      Transaction(TransactionType &&transaction,
+                  const interface::types::HashType &hash)
+          : Transaction(std::forward<TransactionType>(transaction)) {
+        setHash(hash);
+      }
+
+      /**
+       * @param transaction - transport of the transaction in a proposal or a
+       * block, which is referenced by the object. The transport may be shared
+       * by several proposals and blocks, so the object does not change it:
+       * signatures can be added only to a clone
+       * @param arena - arena of the transport, which is kept alive by the
+       * object, nullptr if the transport is on the heap
+       * @param hash - hash of its payload, if it is known already
+       */
+      Transaction(iroha::protocol::Transaction &transaction,
+                  std::shared_ptr<google::protobuf::Arena> arena,
+                  const boost::optional<interface::types::HashType> &hash)
+          : Transaction(transaction) {
+        arena_ = std::move(arena);
+        shared_ = true;
+        if (hash) {
+          setHash(*hash);
+        }
+      }
+
+      Transaction(const Transaction &o) : Transaction(o.proto_) {
+        arena_ = o.arena_;
+        shared_ = o.shared_;
+        if (o.knownHash()) {
+          setHash(*o.knownHash());
+        }
+      }
 
       Transaction(Transaction &&o) noexcept
-          : Transaction(std::move(o.proto_)) {}
+          : Transaction(std::move(o.proto_)) {
+        arena_ = std::move(o.arena_);
+        shared_ = o.shared_;
+        if (o.knownHash()) {
+          setHash(*o.knownHash());
+        }
+      }
+
+      /**
+       * @return arena of the transport, nullptr if it is not in an arena
+       */
+      const std::shared_ptr<google::protobuf::Arena> &getArena() const {
+        return arena_;
+      }
 
       const interface::types::AccountIdType &creatorAccountId() const override {
         return reduced_payload_.creator_account_id();
@@ -68,6 +119,10 @@ namespace shared_model {
 
       bool addSignature(const crypto::Signed &signed_blob,
                         const crypto::PublicKey &public_key) override {
+        // transport of a proposal or a block is read only
+        if (shared_) {
+          return false;
+        }
         // if already has such signature
         if (std::find_if(signatures_->begin(),
                          signatures_->end(),
@@ -104,10 +159,15 @@ namespace shared_model {
       template <typename T>
       using Lazy = detail::LazyInitializer<T>;
 
+      std::shared_ptr<google::protobuf::Arena> arena_;
+
+      // true if the transport belongs to a proposal or a block
+      bool shared_{false};
+
       const iroha::protocol::Transaction::Payload &payload_{proto_->payload()};
 
       const iroha::protocol::Transaction::Payload::ReducedPayload
-          reduced_payload_{proto_->payload().reduced_payload()};
+          &reduced_payload_{proto_->payload().reduced_payload()};
 
       const Lazy<std::vector<proto::Command>> commands_{[this] {
         return std::vector<proto::Command>(reduced_payload_.commands().begin(),
@@ -142,6 +202,76 @@ namespace shared_model {
                                                   signatures.end());
       }};
     };
+
+    /**
+     * Wrap transports of transactions of a proposal or a block
+     * @param transactions - transports, which are referenced by the result
+     * @param arena - arena of the transports, nullptr if they are on the heap
+     * @param hashes - known hashes of the transactions in the same order,
+     * ignored if their number does not match
+     * @return transactions
+     */
+    template <typename Transports>
+    std::vector<Transaction> makeTransactions(
+        Transports &transactions,
+        const std::shared_ptr<google::protobuf::Arena> &arena,
+        const std::vector<interface::types::HashType> &hashes) {
+      std::vector<Transaction> result;
+      result.reserve(transactions.size());
+      auto hashes_known =
+          hashes.size() == static_cast<size_t>(transactions.size());
+      for (auto &tx : transactions) {
+        result.emplace_back(
+            tx,
+            arena,
+            hashes_known ? boost::make_optional(hashes[result.size()])
+                         : boost::none);
+      }
+      return result;
+    }
+
+    /**
+     * @param transactions - transactions of a new proposal or block
+     * @return arena of the transactions, if all of them share the same one,
+     * otherwise a new arena
+     */
+    template <typename Transactions>
+    std::shared_ptr<google::protobuf::Arena> transactionsArena(
+        const Transactions &transactions) {
+      std::shared_ptr<google::protobuf::Arena> arena;
+      for (const auto &tx : transactions) {
+        const auto &tx_arena =
+            static_cast<const Transaction &>(tx).getArena();
+        if (not tx_arena or (arena and arena != tx_arena)) {
+          return std::make_shared<google::protobuf::Arena>();
+        }
+        arena = tx_arena;
+      }
+      return arena ? arena : std::make_shared<google::protobuf::Arena>();
+    }
+
+    /**
+     * Add transport of the transaction to transactions of a proposal or a
+     * block. The transport is shared without copying, when it is in the same
+     * arena as the message, since the arena outlives both of them. Shared
+     * transports are not changed, as transactions referencing them do not
+     * accept signatures
+     * @param transactions - transactions of the message
+     * @param arena - arena of the message
+     * @param tx - transaction to add
+     */
+    inline void addTransaction(
+        google::protobuf::RepeatedPtrField<iroha::protocol::Transaction>
+            &transactions,
+        const std::shared_ptr<google::protobuf::Arena> &arena,
+        const Transaction &tx) {
+      if (arena and tx.getArena() == arena) {
+        transactions.UnsafeArenaAddAllocated(
+            const_cast<iroha::protocol::Transaction *>(&tx.getTransport()));
+      } else {
+        transactions.Add()->CopyFrom(tx.getTransport());
+      }
+    }
   }  // namespace proto
 }  // namespace shared_model
 
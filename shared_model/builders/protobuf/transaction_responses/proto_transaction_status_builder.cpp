@@ -81,6 +81,12 @@ namespace shared_model {
       return copy;
     }
 
+    TransactionStatusBuilder TransactionStatusBuilder::overloaded() {
+      TransactionStatusBuilder copy(*this);
+      copy.tx_response_.set_tx_status(iroha::protocol::TxStatus::OVERLOADED);
+      return copy;
+    }
+
     TransactionStatusBuilder TransactionStatusBuilder::txHash(
         const crypto::Hash &hash) {
       TransactionStatusBuilder copy(*this);
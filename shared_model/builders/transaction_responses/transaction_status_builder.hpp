@@ -79,6 +79,12 @@ namespace shared_model {
         return copy;
       }
 
+      TransactionStatusBuilder overloaded() {
+        TransactionStatusBuilder copy(*this);
+        copy.builder_ = this->builder_.overloaded();
+        return copy;
+      }
+
       TransactionStatusBuilder txHash(const crypto::Hash &hash) {
         TransactionStatusBuilder copy(*this);
         copy.builder_ = this->builder_.txHash(hash);
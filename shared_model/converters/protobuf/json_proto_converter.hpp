@@ -75,6 +75,30 @@ namespace shared_model {
         return boost::none;
       }
 
+      /**
+       * Converts json into shared model object, which transport is parsed
+       * into a new arena owned by the object
+       * @tparam T type of shared model object, constructed from the arena,
+       * its transport and known hashes of its transactions
+       * @param json is the json string containing protobuf object
+       * @return optional of shared model object, containing the
+       * object if conversion was successful and none otherwise
+       */
+      template <typename T>
+      boost::optional<std::shared_ptr<T>> jsonToArenaModel(
+          const std::string &json) {
+        auto arena = std::make_shared<google::protobuf::Arena>();
+        auto transport = google::protobuf::Arena::CreateMessage<
+            typename T::TransportType>(arena.get());
+        if (not google::protobuf::util::JsonStringToMessage(json, transport)
+                    .ok()) {
+          return boost::none;
+        }
+        return std::make_shared<T>(std::move(arena),
+                                   transport,
+                                   std::vector<interface::types::HashType>{});
+      }
+
     }  // namespace protobuf
   }    // namespace converters
 }  // namespace shared_model
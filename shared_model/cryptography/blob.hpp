@@ -18,6 +18,7 @@
 #ifndef IROHA_SHARED_MODEL_BLOB_HPP
 #define IROHA_SHARED_MODEL_BLOB_HPP
 
+#include <atomic>
 #include <string>
 #include <vector>
 
@@ -53,6 +54,16 @@ namespace shared_model {
 
       explicit Blob(Bytes &&blob) noexcept;
 
+      Blob(const Blob &other);
+
+      Blob(Blob &&other) noexcept;
+
+      Blob &operator=(const Blob &other);
+
+      Blob &operator=(Blob &&other) noexcept;
+
+      ~Blob() override;
+
       /**
        * Creates new Blob object from provided hex string
        * @param hex - string in hex format to create Blob from
@@ -85,9 +96,10 @@ namespace shared_model {
       Blob *clone() const override;
 
      private:
-      // TODO: 17/11/2017 luckychess use improved Lazy with references support
       Bytes blob_;
-      std::string hex_;
+      // few blobs are ever printed, so hex is computed on the first request,
+      // the pointer is published atomically, as blobs are read by many threads
+      mutable std::atomic<std::string *> hex_{nullptr};
     };
 
   }  // namespace crypto
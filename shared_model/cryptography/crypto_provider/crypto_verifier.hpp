@@ -48,6 +48,21 @@ namespace shared_model {
         return Algorithm::verify(signedData, source, pubKey);
       }
 
+      /**
+       * Verify signature attached to data, which is not stored in a blob
+       * @param signedData - cryptographic signature
+       * @param source - pointer to data that was signed
+       * @param size - size of data that was signed
+       * @param pubKey - public key of signatory
+       * @return true if signature correct
+       */
+      static bool verify(const Signed &signedData,
+                         const uint8_t *source,
+                         size_t size,
+                         const PublicKey &pubKey) {
+        return Algorithm::verify(signedData, source, size, pubKey);
+      }
+
       /// close constructor for forbidding instantiation
       CryptoVerifier() = delete;
     };
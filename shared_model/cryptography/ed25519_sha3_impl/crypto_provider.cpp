@@ -34,6 +34,13 @@ namespace shared_model {
       return Verifier::verify(signedData, orig, publicKey);
     }
 
+    bool CryptoProviderEd25519Sha3::verify(const Signed &signedData,
+                                           const uint8_t *source,
+                                           size_t size,
+                                           const PublicKey &publicKey) {
+      return Verifier::verify(signedData, source, size, publicKey);
+    }
+
     Seed CryptoProviderEd25519Sha3::generateSeed() {
       return Seed(iroha::create_seed().to_string());
     }
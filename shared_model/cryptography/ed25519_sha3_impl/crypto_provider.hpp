@@ -47,6 +47,11 @@ namespace shared_model {
       static bool verify(const Signed &signedData,
                          const Blob &orig,
                          const PublicKey &publicKey);
+
+      static bool verify(const Signed &signedData,
+                         const uint8_t *source,
+                         size_t size,
+                         const PublicKey &publicKey);
       /**
        * Generates new seed
        * @return Seed generated
@@ -29,12 +29,19 @@ namespace iroha {
              size_t msgsize,
              const pubkey_t &pub,
              const privkey_t &priv) {
+    return sign(msg, msgsize, pub.data(), priv.data());
+  }
+
+  sig_t sign(const uint8_t *msg,
+             size_t msgsize,
+             const uint8_t *pub,
+             const uint8_t *priv) {
     sig_t sig;
     ed25519_sign(reinterpret_cast<signature_t *>(sig.data()),
                  msg,
                  msgsize,
-                 reinterpret_cast<const public_key_t *>(pub.data()),
-                 reinterpret_cast<const private_key_t *>(priv.data()));
+                 reinterpret_cast<const public_key_t *>(pub),
+                 reinterpret_cast<const private_key_t *>(priv));
     return sig;
   }
 
@@ -52,11 +59,18 @@ namespace iroha {
               size_t msgsize,
               const pubkey_t &pub,
               const sig_t &sig) {
+    return verify(msg, msgsize, pub.data(), sig.data());
+  }
+
+  bool verify(const uint8_t *msg,
+              size_t msgsize,
+              const uint8_t *pub,
+              const uint8_t *sig) {
     return 1
-        == ed25519_verify(reinterpret_cast<const signature_t *>(sig.data()),
+        == ed25519_verify(reinterpret_cast<const signature_t *>(sig),
                           msg,
                           msgsize,
-                          reinterpret_cast<const public_key_t *>(pub.data()));
+                          reinterpret_cast<const public_key_t *>(pub));
   }
 
   bool verify(const std::string &msg, const pubkey_t &pub, const sig_t &sig) {
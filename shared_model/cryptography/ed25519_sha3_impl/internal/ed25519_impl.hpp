@@ -40,6 +40,19 @@ namespace iroha {
              const pubkey_t &pub,
              const privkey_t &priv);
 
+  /**
+   * Sign message with ed25519 crypto algorithm, keys are not copied
+   * @param msg
+   * @param msgsize
+   * @param pub - public key of pubkey_t::size() bytes
+   * @param priv - private key of privkey_t::size() bytes
+   * @return
+   */
+  sig_t sign(const uint8_t *msg,
+             size_t msgsize,
+             const uint8_t *pub,
+             const uint8_t *priv);
+
   /**
    * Verify signature of ed25519 crypto algorithm
    * @param msg
@@ -55,6 +68,20 @@ namespace iroha {
 
   bool verify(const std::string &msg, const pubkey_t &pub, const sig_t &sig);
 
+  /**
+   * Verify signature of ed25519 crypto algorithm, key and signature are not
+   * copied
+   * @param msg
+   * @param msgsize
+   * @param pub - public key of pubkey_t::size() bytes
+   * @param sig - signature of sig_t::size() bytes
+   * @return true if signature is valid, false otherwise
+   */
+  bool verify(const uint8_t *msg,
+              size_t msgsize,
+              const uint8_t *pub,
+              const uint8_t *sig);
+
   /**
    * Generate random seed reading from /dev/urandom
    */
@@ -23,13 +23,18 @@
 namespace shared_model {
   namespace crypto {
     Signed Signer::sign(const Blob &blob, const Keypair &keypair) {
-      return Signed(
-          iroha::sign(
-              iroha::sha3_256(crypto::toBinaryString(blob)).to_string(),
-              iroha::pubkey_t::from_string(toBinaryString(keypair.publicKey())),
-              iroha::privkey_t::from_string(
-                  toBinaryString(keypair.privateKey())))
-              .to_string());
+      const auto &public_key = keypair.publicKey();
+      const auto &private_key = keypair.privateKey();
+      if (public_key.size() != iroha::pubkey_t::size()
+          or private_key.size() != iroha::privkey_t::size()) {
+        throw iroha::BadFormatException("Signer: keypair has incorrect length");
+      }
+      auto hash = iroha::sha3_256(blob.blob().data(), blob.size());
+      auto signature = iroha::sign(hash.data(),
+                                   hash.size(),
+                                   public_key.blob().data(),
+                                   private_key.blob().data());
+      return Signed(Blob::Bytes(signature.begin(), signature.end()));
     }
   }  // namespace crypto
 }  // namespace shared_model
@@ -24,10 +24,22 @@ namespace shared_model {
     bool Verifier::verify(const Signed &signedData,
                           const Blob &orig,
                           const PublicKey &publicKey) {
-      return iroha::verify(
-          iroha::sha3_256(crypto::toBinaryString(orig)).to_string(),
-          iroha::pubkey_t::from_string(toBinaryString(publicKey)),
-          iroha::sig_t::from_string(toBinaryString(signedData)));
+      return verify(signedData, orig.blob().data(), orig.size(), publicKey);
+    }
+
+    bool Verifier::verify(const Signed &signedData,
+                          const uint8_t *source,
+                          size_t size,
+                          const PublicKey &publicKey) {
+      if (signedData.size() != iroha::sig_t::size()
+          or publicKey.size() != iroha::pubkey_t::size()) {
+        return false;
+      }
+      auto hash = iroha::sha3_256(source, size);
+      return iroha::verify(hash.data(),
+                           hash.size(),
+                           publicKey.blob().data(),
+                           signedData.blob().data());
     }
   }  // namespace crypto
 }  // namespace shared_model
@@ -31,6 +31,17 @@ namespace shared_model {
       static bool verify(const Signed &signedData,
                          const Blob &orig,
                          const PublicKey &publicKey);
+
+      /**
+       * Verify signature of data, which is not stored in a blob
+       * @param source - pointer to signed data
+       * @param size - size of signed data
+       * @return false if signature or public key has wrong size
+       */
+      static bool verify(const Signed &signedData,
+                         const uint8_t *source,
+                         size_t size,
+                         const PublicKey &publicKey);
     };
 
   }  // namespace crypto
@@ -31,8 +31,31 @@ namespace shared_model {
 
     Blob::Blob(const Bytes &blob) : Blob(Bytes(blob)) {}
 
-    Blob::Blob(Bytes &&blob) noexcept : blob_(std::move(blob)) {
-      hex_ = iroha::bytestringToHexstring(toBinaryString(*this));
+    Blob::Blob(Bytes &&blob) noexcept : blob_(std::move(blob)) {}
+
+    Blob::Blob(const Blob &other) : blob_(other.blob_) {}
+
+    Blob::Blob(Blob &&other) noexcept
+        : blob_(std::move(other.blob_)), hex_(other.hex_.exchange(nullptr)) {}
+
+    Blob &Blob::operator=(const Blob &other) {
+      if (this != &other) {
+        blob_ = other.blob_;
+        delete hex_.exchange(nullptr);
+      }
+      return *this;
+    }
+
+    Blob &Blob::operator=(Blob &&other) noexcept {
+      if (this != &other) {
+        blob_ = std::move(other.blob_);
+        delete hex_.exchange(other.hex_.exchange(nullptr));
+      }
+      return *this;
+    }
+
+    Blob::~Blob() {
+      delete hex_.load();
     }
 
     Blob *Blob::clone() const {
@@ -55,7 +78,18 @@ namespace shared_model {
     }
 
     const std::string &Blob::hex() const {
-      return hex_;
+      if (auto hex = hex_.load(std::memory_order_acquire)) {
+        return *hex;
+      }
+      auto hex = new std::string(
+          iroha::bytestringToHexstring(toBinaryString(*this)));
+      std::string *expected = nullptr;
+      if (not hex_.compare_exchange_strong(expected, hex)) {
+        // another thread has computed it first
+        delete hex;
+        return *expected;
+      }
+      return *hex;
     }
 
     size_t Blob::size() const {
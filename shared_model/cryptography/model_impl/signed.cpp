@@ -32,5 +32,7 @@ namespace shared_model {
     Signed::Signed(const std::string &blob) : Blob(blob) {}
 
     Signed::Signed(const Bytes &blob) : Blob(blob) {}
+
+    Signed::Signed(Bytes &&blob) noexcept : Blob(std::move(blob)) {}
   }  // namespace crypto
 }  // namespace shared_model
@@ -105,6 +105,22 @@ namespace shared_model {
       }
 
      protected:
+      /**
+       * Set hash of the object, when it is already known, e.g. from the
+       * object it was made of, so that the payload is not serialized again
+       * @param hash - hash of the payload
+       */
+      void setHash(const types::HashType &hash) {
+        hash_ = hash;
+      }
+
+      /**
+       * @return hash of the object, if it was computed or set already
+       */
+      const boost::optional<types::HashType> &knownHash() const {
+        return hash_;
+      }
+
       /**
        * Type of set of signatures
        *
@@ -0,0 +1,27 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_OVERLOADED_TX_RESPONSE_HPP
+#define IROHA_OVERLOADED_TX_RESPONSE_HPP
+
+#include "interfaces/transaction_responses/abstract_tx_response.hpp"
+
+namespace shared_model {
+  namespace interface {
+    /**
+     * Transaction is rejected, because the peer is overloaded, it may be
+     * sent again later
+     */
+    class OverloadedTxResponse
+        : public AbstractTxResponse<OverloadedTxResponse> {
+     private:
+      std::string className() const override {
+        return "OverloadedTxResponse";
+      }
+    };
+
+  }  // namespace interface
+}  // namespace shared_model
+#endif  // IROHA_OVERLOADED_TX_RESPONSE_HPP
@@ -0,0 +1,152 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "validators/field_matchers.hpp"
+
+#include <algorithm>
+
+namespace shared_model {
+  namespace validation {
+    namespace matchers {
+
+      namespace {
+        using Iterator = std::string::const_iterator;
+
+        bool isDigit(char c) {
+          return c >= '0' and c <= '9';
+        }
+
+        bool isLower(char c) {
+          return c >= 'a' and c <= 'z';
+        }
+
+        bool isAlpha(char c) {
+          return isLower(c) or (c >= 'A' and c <= 'Z');
+        }
+
+        bool isAlnum(char c) {
+          return isAlpha(c) or isDigit(c);
+        }
+
+        /// [a-z_0-9]{1,32}
+        bool isName(Iterator begin, Iterator end) {
+          auto size = end - begin;
+          return size >= 1 and size <= 32
+              and std::all_of(begin, end, [](char c) {
+                    return isLower(c) or isDigit(c) or c == '_';
+                  });
+        }
+
+        /// [a-zA-Z]([a-zA-Z0-9\-]{0,61}[a-zA-Z0-9])?
+        bool isLabel(Iterator begin, Iterator end) {
+          auto size = end - begin;
+          return size >= 1 and size <= 63 and isAlpha(*begin)
+              and isAlnum(*(end - 1))
+              and std::all_of(begin, end, [](char c) {
+                    return isAlnum(c) or c == '-';
+                  });
+        }
+
+        /// (label\.)*label, labels do not contain dots
+        bool isDomain(Iterator begin, Iterator end) {
+          while (true) {
+            auto dot = std::find(begin, end, '.');
+            if (not isLabel(begin, dot)) {
+              return false;
+            }
+            if (dot == end) {
+              return true;
+            }
+            begin = dot + 1;
+          }
+        }
+
+        /**
+         * Decimal number without leading zeros
+         * @param max_digits - maximal number of digits
+         * @param max_value - maximal value of the number
+         */
+        bool isNumber(Iterator begin,
+                      Iterator end,
+                      long max_digits,
+                      unsigned long max_value) {
+          auto size = end - begin;
+          if (size < 1 or size > max_digits or (size > 1 and *begin == '0')) {
+            return false;
+          }
+          unsigned long value = 0;
+          for (auto it = begin; it != end; ++it) {
+            if (not isDigit(*it)) {
+              return false;
+            }
+            value = value * 10 + (*it - '0');
+          }
+          return value <= max_value;
+        }
+
+        /// four numbers from 0 to 255 separated by dots
+        bool isIpV4(Iterator begin, Iterator end) {
+          for (int octet = 0; octet < 3; ++octet) {
+            auto dot = std::find(begin, end, '.');
+            if (dot == end or not isNumber(begin, dot, 3, 255)) {
+              return false;
+            }
+            begin = dot + 1;
+          }
+          return isNumber(begin, end, 3, 255);
+        }
+
+        /// name, separator and domain, name does not contain the separator
+        bool isNameInDomain(const std::string &value, char separator) {
+          auto pos = std::find(value.begin(), value.end(), separator);
+          return pos != value.end() and isName(value.begin(), pos)
+              and isDomain(pos + 1, value.end());
+        }
+      }  // namespace
+
+      bool accountName(const std::string &value) {
+        return isName(value.begin(), value.end());
+      }
+
+      bool assetName(const std::string &value) {
+        return isName(value.begin(), value.end());
+      }
+
+      bool roleId(const std::string &value) {
+        return isName(value.begin(), value.end());
+      }
+
+      bool domain(const std::string &value) {
+        return isDomain(value.begin(), value.end());
+      }
+
+      bool peerAddress(const std::string &value) {
+        // neither host nor port contain a colon
+        auto colon = std::find(value.begin(), value.end(), ':');
+        if (colon == value.end()) {
+          return false;
+        }
+        return (isIpV4(value.begin(), colon) or isDomain(value.begin(), colon))
+            and isNumber(colon + 1, value.end(), 5, 65535);
+      }
+
+      bool accountId(const std::string &value) {
+        return isNameInDomain(value, '@');
+      }
+
+      bool assetId(const std::string &value) {
+        return isNameInDomain(value, '#');
+      }
+
+      bool detailKey(const std::string &value) {
+        return value.size() >= 1 and value.size() <= 64
+            and std::all_of(value.begin(), value.end(), [](char c) {
+                  return isAlnum(c) or c == '_';
+                });
+      }
+
+    }  // namespace matchers
+  }  // namespace validation
+}  // namespace shared_model
@@ -0,0 +1,49 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_SHARED_MODEL_FIELD_MATCHERS_HPP
+#define IROHA_SHARED_MODEL_FIELD_MATCHERS_HPP
+
+#include <string>
+
+namespace shared_model {
+  namespace validation {
+
+    /**
+     * Matchers of whole strings against patterns of FieldValidator, which do
+     * not allocate memory. Each matcher accepts exactly the strings matched
+     * by the corresponding pattern
+     */
+    namespace matchers {
+
+      /// @see FieldValidator::account_name_pattern_
+      bool accountName(const std::string &value);
+
+      /// @see FieldValidator::asset_name_pattern_
+      bool assetName(const std::string &value);
+
+      /// @see FieldValidator::role_id_pattern_
+      bool roleId(const std::string &value);
+
+      /// @see FieldValidator::domain_pattern_
+      bool domain(const std::string &value);
+
+      /// @see FieldValidator::peer_address_pattern_
+      bool peerAddress(const std::string &value);
+
+      /// @see FieldValidator::account_id_pattern_
+      bool accountId(const std::string &value);
+
+      /// @see FieldValidator::asset_id_pattern_
+      bool assetId(const std::string &value);
+
+      /// @see FieldValidator::detail_key_pattern_
+      bool detailKey(const std::string &value);
+
+    }  // namespace matchers
+  }  // namespace validation
+}  // namespace shared_model
+
+#endif  // IROHA_SHARED_MODEL_FIELD_MATCHERS_HPP
@@ -17,12 +17,15 @@
 
 #include "validators/field_validator.hpp"
 
-#include <boost/algorithm/string_regex.hpp>
 #include <boost/format.hpp>
 #include <limits>
+#include "cache/cache.hpp"
+#include "common/thread_pool.hpp"
 #include "cryptography/crypto_provider/crypto_defaults.hpp"
 #include "cryptography/crypto_provider/crypto_verifier.hpp"
+#include "cryptography/default_hash_provider.hpp"
 #include "interfaces/queries/query_payload_meta.hpp"
+#include "validators/field_matchers.hpp"
 #include "validators/field_validator.hpp"
 
 // TODO: 15.02.18 nickaleks Change structure to compositional IR-978
@@ -30,6 +33,40 @@
 namespace shared_model {
   namespace validation {
 
+    namespace {
+      /**
+       * Verdicts of signature verification, shared by all validators of the
+       * node. A transaction is validated by several stages, and its
+       * signatures are verified by the first one
+       * @return cache of verdicts by hash of signed data, signature and
+       * public key
+       */
+      iroha::cache::Cache<std::string, bool> &signatureVerdicts() {
+        static iroha::cache::Cache<std::string, bool> verdicts;
+        return verdicts;
+      }
+
+      bool verifySignature(const crypto::Signed &sign,
+                           const crypto::Blob &source,
+                           const crypto::Hash &source_hash,
+                           const crypto::PublicKey &pkey) {
+        std::string key;
+        key.reserve(source_hash.size() + sign.size() + pkey.size());
+        for (const auto *blob :
+             std::initializer_list<const crypto::Blob *>{
+                 &source_hash, &sign, &pkey}) {
+          key.append(blob->blob().begin(), blob->blob().end());
+        }
+        if (auto verdict = signatureVerdicts().findItem(key)) {
+          return *verdict;
+        }
+        auto verdict =
+            shared_model::crypto::CryptoVerifier<>::verify(sign, source, pkey);
+        signatureVerdicts().addItem(key, verdict);
+        return verdict;
+      }
+    }  // namespace
+
     const std::string FieldValidator::account_name_pattern_ =
         R"#([a-z_0-9]{1,32})#";
     const std::string FieldValidator::asset_name_pattern_ =
@@ -60,16 +97,6 @@ namespace shared_model {
     const size_t FieldValidator::value_size = 4 * 1024 * 1024;
     const size_t FieldValidator::description_size = 64;
 
-    const std::regex FieldValidator::account_name_regex_(account_name_pattern_);
-    const std::regex FieldValidator::asset_name_regex_(asset_name_pattern_);
-    const std::regex FieldValidator::domain_regex_(domain_pattern_);
-    const std::regex FieldValidator::ip_v4_regex_(ip_v4_pattern_);
-    const std::regex FieldValidator::peer_address_regex_(peer_address_pattern_);
-    const std::regex FieldValidator::account_id_regex_(account_id_pattern_);
-    const std::regex FieldValidator::asset_id_regex_(asset_id_pattern_);
-    const std::regex FieldValidator::detail_key_regex_(detail_key_pattern_);
-    const std::regex FieldValidator::role_id_regex_(role_id_pattern_);
-
     FieldValidator::FieldValidator(time_t future_gap,
                                    TimeFunction time_provider)
         : future_gap_(future_gap), time_provider_(time_provider) {}
@@ -77,7 +104,7 @@ namespace shared_model {
     void FieldValidator::validateAccountId(
         ReasonsGroupType &reason,
         const interface::types::AccountIdType &account_id) const {
-      if (not std::regex_match(account_id, account_id_regex_)) {
+      if (not matchers::accountId(account_id)) {
         auto message =
             (boost::format("Wrongly formed account_id, passed value: '%s'. "
                            "Field should match regex '%s'")
@@ -90,7 +117,7 @@ namespace shared_model {
     void FieldValidator::validateAssetId(
         ReasonsGroupType &reason,
         const interface::types::AssetIdType &asset_id) const {
-      if (not std::regex_match(asset_id, asset_id_regex_)) {
+      if (not matchers::assetId(asset_id)) {
         auto message = (boost::format("Wrongly formed asset_id, passed value: "
                                       "'%s'. Field should match regex '%s'")
                         % asset_id % asset_id_pattern_)
@@ -131,7 +158,7 @@ namespace shared_model {
     void FieldValidator::validatePeerAddress(
         ReasonsGroupType &reason,
         const interface::types::AddressType &address) const {
-      if (not std::regex_match(address, peer_address_regex_)) {
+      if (not matchers::peerAddress(address)) {
         auto message =
             (boost::format("Wrongly formed peer address, passed value: '%s'. "
                            "Field should have a valid 'host:port' format where "
@@ -146,7 +173,7 @@ namespace shared_model {
     void FieldValidator::validateRoleId(
         ReasonsGroupType &reason,
         const interface::types::RoleIdType &role_id) const {
-      if (not std::regex_match(role_id, role_id_regex_)) {
+      if (not matchers::roleId(role_id)) {
         auto message = (boost::format("Wrongly formed role_id, passed value: "
                                       "'%s'. Field should match regex '%s'")
                         % role_id % role_id_pattern_)
@@ -158,7 +185,7 @@ namespace shared_model {
     void FieldValidator::validateAccountName(
         ReasonsGroupType &reason,
         const interface::types::AccountNameType &account_name) const {
-      if (not std::regex_match(account_name, account_name_regex_)) {
+      if (not matchers::accountName(account_name)) {
         auto message =
             (boost::format("Wrongly formed account_name, passed value: '%s'. "
                            "Field should match regex '%s'")
@@ -171,7 +198,7 @@ namespace shared_model {
     void FieldValidator::validateDomainId(
         ReasonsGroupType &reason,
         const interface::types::DomainIdType &domain_id) const {
-      if (not std::regex_match(domain_id, domain_regex_)) {
+      if (not matchers::domain(domain_id)) {
         auto message = (boost::format("Wrongly formed domain_id, passed value: "
                                       "'%s'. Field should match regex '%s'")
                         % domain_id % domain_pattern_)
@@ -183,7 +210,7 @@ namespace shared_model {
     void FieldValidator::validateAssetName(
         ReasonsGroupType &reason,
         const interface::types::AssetNameType &asset_name) const {
-      if (not std::regex_match(asset_name, asset_name_regex_)) {
+      if (not matchers::assetName(asset_name)) {
         auto message =
             (boost::format("Wrongly formed asset_name, passed value: '%s'. "
                            "Field should match regex '%s'")
@@ -196,7 +223,7 @@ namespace shared_model {
     void FieldValidator::validateAccountDetailKey(
         ReasonsGroupType &reason,
         const interface::types::AccountDetailKeyType &key) const {
-      if (not std::regex_match(key, detail_key_regex_)) {
+      if (not matchers::detailKey(key)) {
         auto message = (boost::format("Wrongly formed key, passed value: '%s'. "
                                       "Field should match regex '%s'")
                         % key % detail_key_pattern_)
@@ -263,7 +290,7 @@ namespace shared_model {
     void FieldValidator::validateCreatorAccountId(
         ReasonsGroupType &reason,
         const interface::types::AccountIdType &account_id) const {
-      if (not std::regex_match(account_id, account_id_regex_)) {
+      if (not matchers::accountId(account_id)) {
         auto message =
             (boost::format("Wrongly formed creator_account_id, passed value: "
                            "'%s'. Field should match regex '%s'")
@@ -312,31 +339,46 @@ namespace shared_model {
         const crypto::Blob &source) const {
       if (boost::empty(signatures)) {
         reason.second.push_back("Signatures cannot be empty");
+        return;
       }
+      std::vector<const interface::Signature *> pointers;
       for (const auto &signature : signatures) {
-        const auto &sign = signature.signedData();
-        const auto &pkey = signature.publicKey();
-        bool is_valid = true;
-
-        if (sign.blob().size() != signature_size) {
-          reason.second.push_back(
-              (boost::format("Invalid signature: %s") % sign.hex()).str());
-          is_valid = false;
-        }
-
-        if (pkey.blob().size() != public_key_size) {
-          reason.second.push_back(
-              (boost::format("Invalid pubkey: %s") % pkey.hex()).str());
-          is_valid = false;
-        }
+        pointers.push_back(&signature);
+      }
 
-        if (is_valid
-            && not shared_model::crypto::CryptoVerifier<>::verify(
-                   sign, source, pkey)) {
-          reason.second.push_back((boost::format("Wrong signature [%s;%s]")
-                                   % sign.hex() % pkey.hex())
-                                      .str());
-        }
+      // blocks are signed by many peers, so signatures are verified on the
+      // shared pool, messages are kept in order of the signatures
+      auto source_hash = crypto::DefaultHashProvider::makeHash(source);
+      std::vector<GroupedReasons> messages(pointers.size());
+      iroha::ThreadPool::shared().parallelFor(
+          pointers.size(), [&](size_t i) {
+            const auto &sign = pointers[i]->signedData();
+            const auto &pkey = pointers[i]->publicKey();
+            bool is_valid = true;
+
+            if (sign.blob().size() != signature_size) {
+              messages[i].push_back(
+                  (boost::format("Invalid signature: %s") % sign.hex()).str());
+              is_valid = false;
+            }
+
+            if (pkey.blob().size() != public_key_size) {
+              messages[i].push_back(
+                  (boost::format("Invalid pubkey: %s") % pkey.hex()).str());
+              is_valid = false;
+            }
+
+            if (is_valid
+                && not verifySignature(sign, source, source_hash, pkey)) {
+              messages[i].push_back((boost::format("Wrong signature [%s;%s]")
+                                     % sign.hex() % pkey.hex())
+                                        .str());
+            }
+          });
+      for (auto &signature_messages : messages) {
+        std::move(signature_messages.begin(),
+                  signature_messages.end(),
+                  std::back_inserter(reason.second));
       }
     }
 
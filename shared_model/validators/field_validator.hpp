@@ -18,8 +18,6 @@
 #ifndef IROHA_SHARED_MODEL_FIELD_VALIDATOR_HPP
 #define IROHA_SHARED_MODEL_FIELD_VALIDATOR_HPP
 
-#include <regex>
-
 #include "datetime/time.hpp"
 #include "interfaces/base/signable.hpp"
 #include "interfaces/commands/command.hpp"
@@ -160,6 +158,11 @@ namespace shared_model {
                         const crypto::Hash &hash) const;
 
      private:
+      // compares the patterns with the matchers
+      friend class FieldMatchersTest;
+
+      // patterns of fields, which are reported in reasons, fields are checked
+      // by equivalent matchers
       const static std::string account_name_pattern_;
       const static std::string asset_name_pattern_;
       const static std::string domain_pattern_;
@@ -170,16 +173,6 @@ namespace shared_model {
       const static std::string detail_key_pattern_;
       const static std::string role_id_pattern_;
 
-      const static std::regex account_name_regex_;
-      const static std::regex asset_name_regex_;
-      const static std::regex domain_regex_;
-      const static std::regex ip_v4_regex_;
-      const static std::regex peer_address_regex_;
-      const static std::regex account_id_regex_;
-      const static std::regex asset_id_regex_;
-      const static std::regex detail_key_regex_;
-      const static std::regex role_id_regex_;
-
       // gap for future transactions
       time_t future_gap_;
       // time provider callback
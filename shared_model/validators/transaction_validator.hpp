@@ -273,6 +273,9 @@ namespace shared_model {
           answer.addReason(std::move(tx_reason));
         }
 
+        // commands are numbered by the visitor, so every call uses its own
+        // copy, which counts from zero and is not shared between threads
+        auto command_validator = command_validator_;
         for (const auto &command : tx.commands()) {
           auto cmd_case =
               static_cast<const shared_model::proto::Command &>(command)
@@ -285,7 +288,7 @@ namespace shared_model {
             answer.addReason(std::move(reason));
             continue;
           }
-          auto reason = boost::apply_visitor(command_validator_, command.get());
+          auto reason = boost::apply_visitor(command_validator, command.get());
           if (not reason.second.empty()) {
             answer.addReason(std::move(reason));
           }
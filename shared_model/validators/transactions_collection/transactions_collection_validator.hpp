@@ -7,7 +7,12 @@
 #define IROHA_TRANSACTION_SEQUENCE_VALIDATOR_HPP
 
 #include <algorithm>
+
+#include <boost/format.hpp>
+#include <boost/optional.hpp>
+#include "common/thread_pool.hpp"
 #include "interfaces/common_objects/transaction_sequence_common.hpp"
+#include "interfaces/transaction.hpp"
 #include "validators/answer.hpp"
 #include "validators/transactions_collection/any_order_validator.hpp"
 
@@ -25,6 +30,38 @@ namespace shared_model {
       TransactionValidator transaction_validator_;
       OrderValidator order_validator_;
 
+      /**
+       * Validate each transaction of the collection, transactions are split
+       * between threads of the shared pool
+       * @param transactions collection of transactions
+       * @return reasons of invalid transactions in order of the collection
+       */
+      ReasonsGroupType validateEach(
+          const interface::types::SharedTxsCollectionType &transactions)
+          const {
+        std::vector<boost::optional<std::string>> messages(
+            transactions.size());
+        iroha::ThreadPool::shared().parallelFor(
+            transactions.size(), [&](size_t i) {
+              auto answer = transaction_validator_.validate(*transactions[i]);
+              if (answer.hasErrors()) {
+                messages[i] = (boost::format("Tx %s : %s")
+                               % transactions[i]->hash().hex()
+                               % answer.reason())
+                                  .str();
+              }
+            });
+
+        ReasonsGroupType reason;
+        reason.first = "Transaction list";
+        for (auto &message : messages) {
+          if (message) {
+            reason.second.push_back(std::move(*message));
+          }
+        }
+        return reason;
+      }
+
      public:
       TransactionsCollectionValidator(
           const TransactionValidator &transactions_validator =
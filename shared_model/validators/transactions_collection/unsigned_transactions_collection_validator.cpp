@@ -5,7 +5,6 @@
 
 #include "validators/transactions_collection/unsigned_transactions_collection_validator.hpp"
 
-#include <boost/format.hpp>
 #include "validators/field_validator.hpp"
 #include "validators/transaction_validator.hpp"
 #include "validators/transactions_collection/batch_order_validator.hpp"
@@ -21,19 +20,8 @@ namespace shared_model {
       Answer res =
           UnsignedTransactionsCollectionValidator::order_validator_.validate(
               transactions);
-      ReasonsGroupType reason;
-      reason.first = "Transaction list";
-      for (const auto &tx : transactions) {
-        auto answer =
-            UnsignedTransactionsCollectionValidator::transaction_validator_
-                .validate(*tx);
-        if (answer.hasErrors()) {
-          auto message =
-              (boost::format("Tx %s : %s") % tx->hash().hex() % answer.reason())
-                  .str();
-          reason.second.push_back(message);
-        }
-      }
+      auto reason =
+          UnsignedTransactionsCollectionValidator::validateEach(transactions);
 
       if (not reason.second.empty()) {
         res.addReason(std::move(reason));
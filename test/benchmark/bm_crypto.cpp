@@ -0,0 +1,194 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Costs of the cryptographic paths of a peer: hashing, signing and
+ * verification of raw data, of YAC votes and of transactions.
+ *
+ * Results are written to bm_crypto.json in the working directory, so that
+ * they can be compared between releases, e.g. with compare.py of Google
+ * Benchmark. Another file can be set with --benchmark_out=<path>.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "common/thread_pool.hpp"
+#include "consensus/yac/impl/yac_crypto_provider_impl.hpp"
+#include "consensus/yac/messages.hpp"
+#include "cryptography/crypto_provider/crypto_defaults.hpp"
+#include "cryptography/crypto_provider/crypto_signer.hpp"
+#include "cryptography/crypto_provider/crypto_verifier.hpp"
+#include "cryptography/ed25519_sha3_impl/internal/sha3_hash.hpp"
+#include "datetime/time.hpp"
+#include "logger/logger.hpp"
+#include "module/shared_model/builders/protobuf/test_signature_builder.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+
+using namespace shared_model::crypto;
+
+namespace {
+  /// size of a typical transaction payload
+  constexpr size_t kPayloadSize = 256;
+
+  Blob makeData(size_t size) {
+    std::string data(size, '\0');
+    for (size_t i = 0; i < size; ++i) {
+      data[i] = static_cast<char>(i * 31 + 7);
+    }
+    return Blob(data);
+  }
+
+  iroha::consensus::yac::YacHash makeYacHash(const Keypair &keypair) {
+    iroha::consensus::yac::YacHash hash(std::string(32, 'p'),
+                                        std::string(32, 'b'));
+    hash.block_signature = clone(
+        TestSignatureBuilder()
+            .publicKey(keypair.publicKey())
+            .signedData(CryptoSigner<>::sign(
+                Blob(hash.block_hash), keypair))
+            .build());
+    return hash;
+  }
+}  // namespace
+
+static void BM_Sha3_256(benchmark::State &state) {
+  auto data = makeData(state.range(0));
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(
+        iroha::sha3_256(data.blob().data(), data.blob().size()));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Sha3_256)->RangeMultiplier(4)->Range(32, 64 << 10);
+
+static void BM_Sha3_512(benchmark::State &state) {
+  auto data = makeData(state.range(0));
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(
+        iroha::sha3_512(data.blob().data(), data.blob().size()));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Sha3_512)->RangeMultiplier(4)->Range(32, 64 << 10);
+
+static void BM_Sign(benchmark::State &state) {
+  auto keypair = DefaultCryptoAlgorithmType::generateKeypair();
+  auto data = makeData(kPayloadSize);
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(CryptoSigner<>::sign(data, keypair));
+  }
+}
+BENCHMARK(BM_Sign);
+
+static void BM_Verify(benchmark::State &state) {
+  auto keypair = DefaultCryptoAlgorithmType::generateKeypair();
+  auto data = makeData(kPayloadSize);
+  auto signature = CryptoSigner<>::sign(data, keypair);
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(
+        CryptoVerifier<>::verify(signature, data, keypair.publicKey()));
+  }
+}
+BENCHMARK(BM_Verify);
+
+static void BM_YacVoteSign(benchmark::State &state) {
+  auto keypair = DefaultCryptoAlgorithmType::generateKeypair();
+  iroha::consensus::yac::CryptoProviderImpl provider(keypair);
+  auto hash = makeYacHash(keypair);
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(provider.getVote(hash));
+  }
+}
+BENCHMARK(BM_YacVoteSign);
+
+static void BM_YacVoteVerify(benchmark::State &state) {
+  auto keypair = DefaultCryptoAlgorithmType::generateKeypair();
+  iroha::consensus::yac::CryptoProviderImpl provider(keypair);
+  auto vote = provider.getVote(makeYacHash(keypair));
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(provider.verify(vote));
+  }
+}
+BENCHMARK(BM_YacVoteVerify);
+
+/**
+ * Argument is the number of transfer commands in the transaction. Hash is
+ * cached by the transaction, so every iteration hashes a fresh copy, which is
+ * made with the timer paused
+ */
+static void BM_TransactionHash(benchmark::State &state) {
+  auto transport =
+      TestTransactionBuilder()
+          .creatorAccountId("alice@test")
+          .createdTime(iroha::time::now())
+          .quorum(1)
+          .transferAsset("alice@test", "bob@test", "coin#test", "", "5.00")
+          .build()
+          .getTransport();
+  auto commands =
+      transport.mutable_payload()->mutable_reduced_payload()->mutable_commands();
+  while (commands->size() < state.range(0)) {
+    *commands->Add() = commands->Get(0);
+  }
+
+  std::unique_ptr<shared_model::proto::Transaction> tx;
+  while (state.KeepRunning()) {
+    state.PauseTiming();
+    tx = std::make_unique<shared_model::proto::Transaction>(
+        iroha::protocol::Transaction(transport));
+    state.ResumeTiming();
+    benchmark::DoNotOptimize(tx->hash());
+  }
+  state.SetBytesProcessed(state.iterations() * transport.ByteSizeLong());
+}
+BENCHMARK(BM_TransactionHash)->Arg(1)->Arg(10)->Arg(100);
+
+/**
+ * Argument is the number of signatures of distinct keys, which are verified
+ * on the shared thread pool, the way collections of transactions are
+ */
+static void BM_ParallelVerify(benchmark::State &state) {
+  auto count = static_cast<size_t>(state.range(0));
+  auto data = makeData(kPayloadSize);
+  std::vector<Keypair> keypairs;
+  std::vector<Signed> signatures;
+  for (size_t i = 0; i < count; ++i) {
+    keypairs.push_back(DefaultCryptoAlgorithmType::generateKeypair());
+    signatures.push_back(CryptoSigner<>::sign(data, keypairs.back()));
+  }
+
+  std::atomic<size_t> verified;
+  while (state.KeepRunning()) {
+    verified = 0;
+    iroha::ThreadPool::shared().parallelFor(count, [&](size_t i) {
+      if (CryptoVerifier<>::verify(
+              signatures[i], data, keypairs[i].publicKey())) {
+        ++verified;
+      }
+    });
+    if (verified != count) {
+      state.SkipWithError("signature is not verified");
+      break;
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_ParallelVerify)->Arg(10)->Arg(100)->Arg(1000)->UseRealTime();
+
+int main(int argc, char **argv) {
+  spdlog::set_level(spdlog::level::off);
+  std::vector<char *> args(argv, argv + argc);
+  std::string out = "--benchmark_out=bm_crypto.json";
+  std::string format = "--benchmark_out_format=json";
+  if (std::none_of(args.begin(), args.end(), [](const char *arg) {
+        return std::string(arg).find("--benchmark_out=") == 0;
+      })) {
+    args.push_back(&out[0]);
+    args.push_back(&format[0]);
+  }
+  argc = static_cast<int>(args.size());
+  benchmark::Initialize(&argc, args.data());
+  benchmark::RunSpecifiedBenchmarks();
+}
@@ -0,0 +1,67 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Fields of every command are checked against patterns of FieldValidator.
+ *
+ * The purpose of this benchmark is to compare matching with std::regex,
+ * which was used before, to the hand-written matchers used now.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <regex>
+
+#include "validators/field_matchers.hpp"
+
+namespace matchers = shared_model::validation::matchers;
+
+const std::string account_id = "long_account_name_0@subdomain.iroha-test.com";
+const std::string peer_address = "node-1.iroha-test.com:50541";
+
+// patterns of FieldValidator, which were matched with std::regex
+const std::string domain_pattern =
+    R"#(([a-zA-Z]([a-zA-Z0-9\-]{0,61}[a-zA-Z0-9])?\.)*)#"
+    R"#([a-zA-Z]([a-zA-Z0-9\-]{0,61}[a-zA-Z0-9])?)#";
+const std::string account_id_pattern =
+    R"#([a-z_0-9]{1,32}\@)#" + domain_pattern;
+const std::string peer_address_pattern =
+    R"#(((^((([0-9]|[1-9][0-9]|1[0-9]{2}|2[0-4][0-9]|25[0-5])\.){3})#"
+    R"#(([0-9]|[1-9][0-9]|1[0-9]{2}|2[0-4][0-9]|25[0-5])))|()#"
+    + domain_pattern
+    + R"#()):(6553[0-5]|655[0-2]\d|65[0-4]\d\d|6[0-4]\d{3}|[1-5]\d{4}|)#"
+      R"#([1-9]\d{0,3}|0)$)#";
+
+static void BM_AccountIdRegex(benchmark::State &state) {
+  const std::regex regex(account_id_pattern);
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(std::regex_match(account_id, regex));
+  }
+}
+BENCHMARK(BM_AccountIdRegex);
+
+static void BM_AccountIdMatcher(benchmark::State &state) {
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(matchers::accountId(account_id));
+  }
+}
+BENCHMARK(BM_AccountIdMatcher);
+
+static void BM_PeerAddressRegex(benchmark::State &state) {
+  const std::regex regex(peer_address_pattern);
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(std::regex_match(peer_address, regex));
+  }
+}
+BENCHMARK(BM_PeerAddressRegex);
+
+static void BM_PeerAddressMatcher(benchmark::State &state) {
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(matchers::peerAddress(peer_address));
+  }
+}
+BENCHMARK(BM_PeerAddressMatcher);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,129 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Throughput of YAC consensus in a simulated cluster.
+ *
+ * Peers, network and timers are simulated in a single thread with virtual
+ * time, see yac_cluster_simulator.hpp. Wall-clock time of the benchmark is
+ * dominated by vote signing and verification, while the counters describe
+ * consensus itself:
+ *  - commits_per_s: rounds committed by all alive peers per virtual second
+ *  - messages_per_round: votes, commits and rejects sent in a round
+ *  - dropped_per_round: messages lost or sent to/from crashed peers
+ *  - latency_pXX_ms: virtual time from the round start until commit on a
+ *    peer
+ *
+ * Arguments are number of peers and index of the fault profile from
+ * kProfiles.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "logger/logger.hpp"
+#include "yac_cluster_simulator.hpp"
+
+using namespace iroha::consensus::yac::simulation;
+using namespace std::chrono_literals;
+
+namespace {
+  /// number of rounds in a single benchmark iteration
+  constexpr size_t kRounds = 20;
+
+  /// fault profiles by index
+  FaultProfile profile(int64_t index, size_t peers) {
+    FaultProfile faults;
+    switch (index) {
+      case 0:  // LAN
+        faults.latency = 500us;
+        break;
+      case 1:  // WAN with reordering
+        faults.latency = 50ms;
+        faults.jitter = 30ms;
+        break;
+      case 2:  // lossy WAN
+        faults.latency = 50ms;
+        faults.jitter = 30ms;
+        faults.loss = 0.05;
+        break;
+      case 3:  // maximum tolerated number of crashed peers
+        faults.latency = 50ms;
+        faults.jitter = 30ms;
+        faults.crashed_peers = (peers - 1) / 3;
+        break;
+    }
+    return faults;
+  }
+
+  const char *kProfiles[] = {"lan", "wan", "lossy_wan", "crashed"};
+}  // namespace
+
+static void BM_YacCluster(benchmark::State &state) {
+  ClusterConfig config;
+  config.peers = state.range(0);
+  config.faults = profile(state.range(1), config.peers);
+  state.SetLabel(kProfiles[state.range(1)]);
+
+  size_t rounds = 0, committed = 0;
+  VirtualDuration elapsed{0};
+  MessageCounters counters;
+  std::vector<double> latencies = {0, 0, 0};
+
+  while (state.KeepRunning()) {
+    YacCluster cluster(config);
+    for (size_t i = 0; i < kRounds; ++i) {
+      cluster.runRound();
+    }
+    state.PauseTiming();
+    rounds += kRounds;
+    committed += cluster.committedRounds();
+    elapsed += cluster.elapsed();
+    auto round_counters = cluster.counters();
+    counters.votes += round_counters.votes;
+    counters.commits += round_counters.commits;
+    counters.rejects += round_counters.rejects;
+    counters.dropped += round_counters.dropped;
+    // the simulation is deterministic, so every iteration yields the same
+    // latencies
+    latencies = {
+        std::chrono::duration<double, std::milli>(cluster.latency(0.5))
+            .count(),
+        std::chrono::duration<double, std::milli>(cluster.latency(0.9))
+            .count(),
+        std::chrono::duration<double, std::milli>(cluster.latency(0.99))
+            .count()};
+    state.ResumeTiming();
+  }
+
+  state.SetItemsProcessed(committed);
+  state.counters["commits_per_s"] =
+      committed / std::chrono::duration<double>(elapsed).count();
+  state.counters["committed_ratio"] = double(committed) / rounds;
+  state.counters["messages_per_round"] = double(counters.total()) / rounds;
+  state.counters["dropped_per_round"] = double(counters.dropped) / rounds;
+  state.counters["latency_p50_ms"] = latencies.at(0);
+  state.counters["latency_p90_ms"] = latencies.at(1);
+  state.counters["latency_p99_ms"] = latencies.at(2);
+}
+
+/// peer counts x fault profiles
+static void clusterArguments(benchmark::internal::Benchmark *b) {
+  for (auto peers : {4, 7, 30}) {
+    for (size_t i = 0; i < sizeof(kProfiles) / sizeof(*kProfiles); ++i) {
+      b->Args({peers, static_cast<int>(i)});
+    }
+  }
+}
+
+BENCHMARK(BM_YacCluster)
+    ->Apply(clusterArguments)
+    ->Unit(benchmark::kMillisecond);
+
+int main(int argc, char **argv) {
+  // yac logs every vote, which would dominate the measurements
+  spdlog::set_level(spdlog::level::off);
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+}
@@ -0,0 +1,494 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_YAC_CLUSTER_SIMULATOR_HPP
+#define IROHA_YAC_CLUSTER_SIMULATOR_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "builders/default_builders.hpp"
+#include "builders/protobuf/common_objects/proto_peer_builder.hpp"
+#include "consensus/yac/cluster_order.hpp"
+#include "consensus/yac/impl/yac_crypto_provider_impl.hpp"
+#include "consensus/yac/messages.hpp"
+#include "consensus/yac/storage/yac_proposal_storage.hpp"
+#include "consensus/yac/timer.hpp"
+#include "consensus/yac/transport/yac_network_interface.hpp"
+#include "consensus/yac/yac.hpp"
+#include "cryptography/crypto_provider/crypto_defaults.hpp"
+#include "cryptography/crypto_provider/crypto_signer.hpp"
+
+/**
+ * In-process YAC cluster driven by virtual time.
+ *
+ * All peers live in a single thread: messages and timer expirations are
+ * events of one queue, which is ordered by virtual time and then by
+ * scheduling order. Together with seeded randomness it makes every run with
+ * the same configuration produce exactly the same sequence of events, so that
+ * consensus changes can be compared on equal terms.
+ */
+namespace iroha {
+  namespace consensus {
+    namespace yac {
+      namespace simulation {
+
+        using VirtualDuration = std::chrono::microseconds;
+
+        /**
+         * Queue of events ordered by virtual time
+         */
+        class EventLoop {
+         public:
+          using EventId = uint64_t;
+
+          /**
+           * Schedule handler invocation
+           * @param delay - virtual time from now until the invocation
+           * @param handler - function to invoke
+           * @return id of the event, which can be used to cancel it
+           */
+          EventId schedule(VirtualDuration delay,
+                           std::function<void()> handler) {
+            auto key = std::make_pair(now_ + delay, next_id_++);
+            queue_.emplace(key, std::move(handler));
+            index_.emplace(key.second, key.first);
+            return key.second;
+          }
+
+          /**
+           * Remove pending event, no-op if it has already happened
+           */
+          void cancel(EventId id) {
+            auto it = index_.find(id);
+            if (it != index_.end()) {
+              queue_.erase(std::make_pair(it->second, id));
+              index_.erase(it);
+            }
+          }
+
+          /**
+           * Invoke pending events until predicate holds or the deadline
+           * passes, virtual time jumps to the next event on every step
+           * @return true if predicate holds on return
+           */
+          bool runUntil(const std::function<bool()> &done,
+                        VirtualDuration deadline) {
+            while (not done()) {
+              if (queue_.empty() or queue_.begin()->first.first > deadline) {
+                now_ = std::max(now_, deadline);
+                return false;
+              }
+              auto event = queue_.begin();
+              auto handler = std::move(event->second);
+              now_ = event->first.first;
+              index_.erase(event->first.second);
+              queue_.erase(event);
+              handler();
+            }
+            return true;
+          }
+
+          VirtualDuration now() const {
+            return now_;
+          }
+
+          size_t pending() const {
+            return queue_.size();
+          }
+
+         private:
+          VirtualDuration now_{0};
+          EventId next_id_ = 0;
+          std::map<std::pair<VirtualDuration, EventId>, std::function<void()>>
+              queue_;
+          std::unordered_map<EventId, VirtualDuration> index_;
+        };
+
+        /**
+         * Yac timer which fires in virtual time of the loop
+         */
+        class VirtualTimer : public Timer {
+         public:
+          VirtualTimer(std::shared_ptr<EventLoop> loop, VirtualDuration delay)
+              : loop_(std::move(loop)), delay_(delay) {}
+
+          void invokeAfterDelay(std::function<void()> handler) override {
+            deny();
+            pending_ = loop_->schedule(
+                delay_, [this, handler{std::move(handler)}] {
+                  pending_ = boost::none;
+                  handler();
+                });
+          }
+
+          void deny() override {
+            if (pending_) {
+              loop_->cancel(*pending_);
+              pending_ = boost::none;
+            }
+          }
+
+         private:
+          std::shared_ptr<EventLoop> loop_;
+          VirtualDuration delay_;
+          boost::optional<EventLoop::EventId> pending_;
+        };
+
+        /**
+         * Misbehaviour of the network and peers
+         */
+        struct FaultProfile {
+          /// one-way delay of every message between two different peers
+          VirtualDuration latency{1000};
+          /// upper bound of the uniformly distributed extra delay, messages
+          /// sent back to back overtake each other when it is non-zero
+          VirtualDuration jitter{0};
+          /// probability of a message between two different peers to be lost
+          double loss = 0.;
+          /// number of peers which neither send nor receive anything
+          size_t crashed_peers = 0;
+          /// seed of all random decisions of the simulation
+          uint32_t seed = 42;
+        };
+
+        /**
+         * Number of messages passed to the network
+         */
+        struct MessageCounters {
+          size_t votes = 0;
+          size_t commits = 0;
+          size_t rejects = 0;
+          size_t dropped = 0;
+
+          size_t total() const {
+            return votes + commits + rejects;
+          }
+        };
+
+        /**
+         * In-memory network which delivers messages through the event loop
+         */
+        class SimulatedNetwork {
+         public:
+          SimulatedNetwork(std::shared_ptr<EventLoop> loop,
+                           FaultProfile faults)
+              : loop_(std::move(loop)),
+                faults_(faults),
+                random_(faults.seed) {}
+
+          void subscribe(const std::string &address,
+                         std::weak_ptr<YacNetworkNotifications> handler) {
+            handlers_[address] = std::move(handler);
+          }
+
+          void crash(const std::string &address) {
+            crashed_.push_back(address);
+          }
+
+          bool isCrashed(const std::string &address) const {
+            return std::find(crashed_.begin(), crashed_.end(), address)
+                != crashed_.end();
+          }
+
+          /**
+           * Pass message to the recipient according to the fault profile
+           * @param from - address of the sender
+           * @param to - address of the recipient
+           * @param deliver - function which hands message to the recipient
+           */
+          void send(const std::string &from,
+                    const std::string &to,
+                    std::function<void(YacNetworkNotifications &)> deliver) {
+            if (isCrashed(from) or isCrashed(to)) {
+              ++counters_.dropped;
+              return;
+            }
+            auto delay = VirtualDuration{0};
+            if (from != to) {
+              if (std::bernoulli_distribution(faults_.loss)(random_)) {
+                ++counters_.dropped;
+                return;
+              }
+              delay = faults_.latency + jitter();
+            }
+            loop_->schedule(
+                delay, [this, to, deliver{std::move(deliver)}] {
+                  if (auto handler = handlers_[to].lock()) {
+                    deliver(*handler);
+                  }
+                });
+          }
+
+          /**
+           * @return random delay within jitter bound of the fault profile
+           */
+          VirtualDuration jitter() {
+            if (faults_.jitter.count() == 0) {
+              return VirtualDuration{0};
+            }
+            return VirtualDuration{
+                std::uniform_int_distribution<VirtualDuration::rep>(
+                    0, faults_.jitter.count())(random_)};
+          }
+
+          std::mt19937 &random() {
+            return random_;
+          }
+
+          MessageCounters &counters() {
+            return counters_;
+          }
+
+         private:
+          std::shared_ptr<EventLoop> loop_;
+          FaultProfile faults_;
+          std::mt19937 random_;
+          MessageCounters counters_;
+          std::unordered_map<std::string,
+                             std::weak_ptr<YacNetworkNotifications>>
+              handlers_;
+          std::vector<std::string> crashed_;
+        };
+
+        /**
+         * Endpoint of a single peer in the simulated network
+         */
+        class PeerTransport : public YacNetwork {
+         public:
+          PeerTransport(std::shared_ptr<SimulatedNetwork> network,
+                        std::string address)
+              : network_(std::move(network)), address_(std::move(address)) {}
+
+          void subscribe(
+              std::shared_ptr<YacNetworkNotifications> handler) override {
+            network_->subscribe(address_, handler);
+          }
+
+          void send_commit(const shared_model::interface::Peer &to,
+                           const CommitMessage &commit) override {
+            ++network_->counters().commits;
+            network_->send(address_, to.address(), [commit](auto &handler) {
+              handler.on_commit(commit);
+            });
+          }
+
+          void send_reject(const shared_model::interface::Peer &to,
+                           RejectMessage reject) override {
+            ++network_->counters().rejects;
+            network_->send(address_, to.address(), [reject](auto &handler) {
+              handler.on_reject(reject);
+            });
+          }
+
+          void send_vote(const shared_model::interface::Peer &to,
+                         VoteMessage vote) override {
+            ++network_->counters().votes;
+            network_->send(address_, to.address(), [vote](auto &handler) {
+              handler.on_vote(vote);
+            });
+          }
+
+         private:
+          std::shared_ptr<SimulatedNetwork> network_;
+          std::string address_;
+        };
+
+        /**
+         * Parameters of the simulated cluster
+         */
+        struct ClusterConfig {
+          size_t peers = 4;
+          /// delay of yac timer between votes to the next peers in order
+          VirtualDuration vote_delay{std::chrono::milliseconds(1000)};
+          /// virtual time after which unfinished round is abandoned
+          VirtualDuration round_timeout{std::chrono::seconds(30)};
+          FaultProfile faults;
+        };
+
+        /**
+         * N Yac instances wired through the simulated network, which vote
+         * for a new hash every round
+         */
+        class YacCluster {
+         public:
+          explicit YacCluster(ClusterConfig config)
+              : config_(config),
+                loop_(std::make_shared<EventLoop>()),
+                network_(
+                    std::make_shared<SimulatedNetwork>(loop_, config.faults)) {
+            using shared_model::crypto::DefaultCryptoAlgorithmType;
+            for (size_t i = 0; i < config_.peers; ++i) {
+              auto address = "peer" + std::to_string(i);
+              // keys are derived from the address to keep runs reproducible
+              keypairs_.push_back(DefaultCryptoAlgorithmType::generateKeypair(
+                  DefaultCryptoAlgorithmType::generateSeed(address)));
+              peers_.push_back(
+                  clone(shared_model::proto::PeerBuilder()
+                            .address(address)
+                            .pubkey(keypairs_.back().publicKey())
+                            .build()));
+            }
+            // the last peers in the ledger are the crashed ones
+            for (size_t i = config_.peers
+                     - std::min(config_.faults.crashed_peers, config_.peers);
+                 i < config_.peers;
+                 ++i) {
+              network_->crash(peers_.at(i)->address());
+            }
+
+            auto order = ClusterOrdering::create(peers_).value();
+            for (size_t i = 0; i < config_.peers; ++i) {
+              auto yac = Yac::create(
+                  YacVoteStorage(),
+                  std::make_shared<PeerTransport>(network_,
+                                                  peers_.at(i)->address()),
+                  std::make_shared<CryptoProviderImpl>(keypairs_.at(i)),
+                  std::make_shared<VirtualTimer>(loop_, config_.vote_delay),
+                  order);
+              yac->on_commit().subscribe(
+                  [this, i](const CommitMessage &commit) {
+                    this->onCommit(i, commit);
+                  });
+              network_->subscribe(peers_.at(i)->address(), yac);
+              yacs_.push_back(std::move(yac));
+            }
+          }
+
+          /**
+           * Let all alive peers vote for the next hash and process events
+           * until every one of them commits or the round times out
+           * @return true if all alive peers have committed
+           */
+          bool runRound() {
+            ++round_;
+            round_start_ = loop_->now();
+            current_proposal_ = "proposal" + std::to_string(round_);
+            committed_.assign(config_.peers, false);
+
+            // order of peers is different in every round, as it is in the
+            // real network where it is derived from the proposal hash
+            auto peers = peers_;
+            std::shuffle(peers.begin(), peers.end(), network_->random());
+            auto order = ClusterOrdering::create(peers).value();
+
+            size_t alive = 0;
+            for (size_t i = 0; i < config_.peers; ++i) {
+              if (network_->isCrashed(peers_.at(i)->address())) {
+                continue;
+              }
+              ++alive;
+              auto hash = makeHash(i, current_proposal_);
+              loop_->schedule(network_->jitter(), [this, i, hash, order] {
+                yacs_.at(i)->vote(hash, order);
+              });
+            }
+
+            auto all_committed = loop_->runUntil(
+                [this, alive] {
+                  return static_cast<size_t>(std::count(
+                             committed_.begin(), committed_.end(), true))
+                      == alive;
+                },
+                round_start_ + config_.round_timeout);
+            if (all_committed) {
+              ++committed_rounds_;
+            }
+            return all_committed;
+          }
+
+          /**
+           * @return number of rounds in which all alive peers have committed
+           */
+          size_t committedRounds() const {
+            return committed_rounds_;
+          }
+
+          /**
+           * @return virtual time elapsed since the cluster start
+           */
+          VirtualDuration elapsed() const {
+            return loop_->now();
+          }
+
+          MessageCounters counters() const {
+            return network_->counters();
+          }
+
+          /**
+           * Latency between the round start and commit on a single peer
+           * @param quantile - value in range [0, 1]
+           * @return latency of given quantile among all commits observed
+           */
+          VirtualDuration latency(double quantile) const {
+            if (latencies_.empty()) {
+              return VirtualDuration{0};
+            }
+            auto sorted = latencies_;
+            std::sort(sorted.begin(), sorted.end());
+            auto rank = static_cast<size_t>(quantile * (sorted.size() - 1));
+            return sorted.at(rank);
+          }
+
+         private:
+          YacHash makeHash(size_t peer, const std::string &proposal) const {
+            YacHash hash(proposal, "block" + std::to_string(round_));
+            auto signed_data = shared_model::crypto::CryptoSigner<>::sign(
+                shared_model::crypto::Blob(hash.block_hash),
+                keypairs_.at(peer));
+            shared_model::builder::DefaultSignatureBuilder()
+                .publicKey(keypairs_.at(peer).publicKey())
+                .signedData(signed_data)
+                .build()
+                .match(
+                    [&hash](iroha::expected::Value<std::shared_ptr<
+                                shared_model::interface::Signature>> &sig) {
+                      hash.block_signature = sig.value;
+                    },
+                    [](const auto &) {});
+            return hash;
+          }
+
+          void onCommit(size_t peer, const CommitMessage &commit) {
+            if (commit.votes.empty()
+                or commit.votes.front().hash.proposal_hash
+                    != current_proposal_
+                or committed_.at(peer)) {
+              return;
+            }
+            committed_.at(peer) = true;
+            latencies_.push_back(loop_->now() - round_start_);
+          }
+
+          ClusterConfig config_;
+          std::shared_ptr<EventLoop> loop_;
+          std::shared_ptr<SimulatedNetwork> network_;
+          std::vector<shared_model::crypto::Keypair> keypairs_;
+          std::vector<std::shared_ptr<shared_model::interface::Peer>> peers_;
+          std::vector<std::shared_ptr<Yac>> yacs_;
+
+          size_t round_ = 0;
+          size_t committed_rounds_ = 0;
+          VirtualDuration round_start_{0};
+          std::string current_proposal_;
+          std::vector<bool> committed_;
+          std::vector<VirtualDuration> latencies_;
+        };
+
+      }  // namespace simulation
+    }    // namespace yac
+  }      // namespace consensus
+}  // namespace iroha
+
+#endif  // IROHA_YAC_CLUSTER_SIMULATOR_HPP
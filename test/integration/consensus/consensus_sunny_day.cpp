@@ -131,7 +131,7 @@ TEST_F(ConsensusSunnyDayTest, SunnyDayTest) {
   wrapper.subscribe(
       [](auto hash) { std::cout << "^_^ COMMITTED!!!" << std::endl; });
 
-  EXPECT_CALL(*crypto, verify(An<CommitMessage>()))
+  EXPECT_CALL(*crypto, verify(An<const CommitMessage &>()))
       .Times(1)
       .WillRepeatedly(DoAll(InvokeWithoutArgs([&cv] {
                               // wake up after commit is received from the
@@ -139,7 +139,8 @@ TEST_F(ConsensusSunnyDayTest, SunnyDayTest) {
                               cv.notify_one();
                             }),
                             Return(true)));
-  EXPECT_CALL(*crypto, verify(An<VoteMessage>())).WillRepeatedly(Return(true));
+  EXPECT_CALL(*crypto, verify(An<const VoteMessage &>()))
+      .WillRepeatedly(Return(true));
 
   // Wait for other peers to start
   std::this_thread::sleep_for(std::chrono::milliseconds(delay_before));
@@ -187,6 +187,20 @@ namespace iroha {
       MOCK_METHOD0(
           createTemporaryWsv,
           expected::Result<std::unique_ptr<TemporaryWsv>, std::string>(void));
+
+      void prepareBlock(
+          std::unique_ptr<TemporaryWsv> wsv,
+          const shared_model::interface::types::HashType &block_hash,
+          const shared_model::interface::types::HashType &top_hash) override {
+        // gmock workaround for non-copyable parameters
+        prepareBlock_(wsv, block_hash, top_hash);
+      }
+
+      MOCK_METHOD3(
+          prepareBlock_,
+          void(std::unique_ptr<TemporaryWsv> &,
+               const shared_model::interface::types::HashType &,
+               const shared_model::interface::types::HashType &));
     };
 
     class MockTemporaryWsv : public TemporaryWsv {
@@ -275,6 +289,20 @@ namespace iroha {
       MOCK_METHOD0(reset, void(void));
       MOCK_METHOD0(dropStorage, void(void));
 
+      void prepareBlock(
+          std::unique_ptr<TemporaryWsv> wsv,
+          const shared_model::interface::types::HashType &block_hash,
+          const shared_model::interface::types::HashType &top_hash) override {
+        // gmock workaround for non-copyable parameters
+        prepareBlock_(wsv, block_hash, top_hash);
+      }
+
+      MOCK_METHOD3(
+          prepareBlock_,
+          void(std::unique_ptr<TemporaryWsv> &,
+               const shared_model::interface::types::HashType &,
+               const shared_model::interface::types::HashType &));
+
       rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
       on_commit() override {
         return notifier.get_observable();
@@ -10,6 +10,7 @@
 #include "ametsuchi/impl/postgres_wsv_query.hpp"
 #include "ametsuchi/impl/wsv_restorer_impl.hpp"
 #include "ametsuchi/mutable_storage.hpp"
+#include "ametsuchi/temporary_wsv.hpp"
 #include "builders/default_builders.hpp"
 #include "builders/protobuf/transaction.hpp"
 #include "framework/result_fixture.hpp"
@@ -672,6 +673,97 @@ TEST_F(AmetsuchiTest, FindTxByHashTest) {
   ASSERT_EQ(blocks->getTxByHashSync(tx3hash), boost::none);
 }
 
+/**
+ * @given storage with a committed block
+ * @when another block is committed
+ * @then it is returned as the top block by existing block queries
+ * @and it is the top block of a storage created over the same block store
+ */
+TEST_F(AmetsuchiTest, TopBlockIsUpdatedOnCommit) {
+  ASSERT_TRUE(storage);
+  auto blocks = storage->getBlockQuery();
+
+  auto block1 = TestBlockBuilder().height(1).prevHash(fake_hash).build();
+  apply(storage, block1);
+  auto block2 = TestBlockBuilder().height(2).prevHash(block1.hash()).build();
+  apply(storage, block2);
+
+  auto top_block = framework::expected::val(blocks->getTopBlock());
+  ASSERT_TRUE(top_block);
+  ASSERT_EQ(*top_block->value, block2);
+
+  std::shared_ptr<StorageImpl> restarted;
+  StorageImpl::create(block_store_path, pgopt_, factory)
+      .match([&](iroha::expected::Value<std::shared_ptr<StorageImpl>>
+                     &_storage) { restarted = _storage.value; },
+             [](iroha::expected::Error<std::string> &error) {
+               FAIL() << "StorageImpl: " << error.error;
+             });
+  ASSERT_TRUE(restarted);
+  top_block =
+      framework::expected::val(restarted->getBlockQuery()->getTopBlock());
+  ASSERT_TRUE(top_block);
+  ASSERT_EQ(*top_block->value, block2);
+}
+
+/**
+ * @given storage with a block
+ * @when the next block is committed
+ * @then subscribers of committed blocks see it as the top block
+ */
+TEST_F(AmetsuchiTest, TopBlockIsUpdatedBeforeNotification) {
+  ASSERT_TRUE(storage);
+  auto block1 = TestBlockBuilder().height(1).prevHash(fake_hash).build();
+  apply(storage, block1);
+  auto block2 = TestBlockBuilder().height(2).prevHash(block1.hash()).build();
+
+  auto blocks = storage->getBlockQuery();
+  auto wrapper = make_test_subscriber<CallExact>(storage->on_commit(), 1);
+  wrapper.subscribe([&](const auto &block) {
+    auto top_block = framework::expected::val(blocks->getTopBlock());
+    ASSERT_TRUE(top_block);
+    ASSERT_EQ(*top_block->value, block2);
+  });
+  apply(storage, block2);
+
+  ASSERT_TRUE(wrapper.validate());
+}
+
+/**
+ * @given storage without blocks
+ * @when two blocks are committed at once
+ * @then subscribers see each of them as the top block when it is published
+ */
+TEST_F(AmetsuchiTest, TopBlockFollowsEachCommittedBlock) {
+  ASSERT_TRUE(storage);
+  auto block1 = TestBlockBuilder().height(1).prevHash(fake_hash).build();
+  auto block2 = TestBlockBuilder().height(2).prevHash(block1.hash()).build();
+
+  std::unique_ptr<MutableStorage> ms;
+  storage->createMutableStorage().match(
+      [&](iroha::expected::Value<std::unique_ptr<MutableStorage>> &_storage) {
+        ms = std::move(_storage.value);
+      },
+      [](iroha::expected::Error<std::string> &error) {
+        FAIL() << "MutableStorage: " << error.error;
+      });
+  ASSERT_TRUE(ms);
+  auto apply_all = [](const auto &, auto &, const auto &) { return true; };
+  ASSERT_TRUE(ms->apply(block1, apply_all));
+  ASSERT_TRUE(ms->apply(block2, apply_all));
+
+  auto blocks = storage->getBlockQuery();
+  auto wrapper = make_test_subscriber<CallExact>(storage->on_commit(), 2);
+  wrapper.subscribe([&](const auto &block) {
+    auto top_block = framework::expected::val(blocks->getTopBlock());
+    ASSERT_TRUE(top_block);
+    ASSERT_EQ(block->height(), top_block->value->height());
+  });
+  storage->commit(std::move(ms));
+
+  ASSERT_TRUE(wrapper.validate());
+}
+
 /**
  * @given initialized storage for ordering service
  * @when save proposal height
@@ -843,3 +935,142 @@ TEST_F(AmetsuchiTest, TestRestoreWSV) {
   res = storage->getWsvQuery()->getDomain("test");
   EXPECT_TRUE(res);
 }
+
+/**
+ * Fixture for blocks, which state is prepared in a temporary wsv during
+ * stateful validation. The prepared state adds a peer, which is not in the
+ * block, so that it is seen whether the block was executed or its prepared
+ * state was committed
+ */
+class PreparedBlockTest : public AmetsuchiTest {
+ public:
+  void SetUp() override {
+    AmetsuchiTest::SetUp();
+    genesis = std::make_unique<shared_model::proto::Block>(
+        TestBlockBuilder()
+            .transactions(std::vector<shared_model::proto::Transaction>(
+                {TestTransactionBuilder()
+                     .creatorAccountId("admin@test")
+                     .createRole("admin", {Role::kAddPeer})
+                     .createDomain("test", "admin")
+                     .createAccount("admin", "test", fake_pubkey)
+                     .build()}))
+            .height(1)
+            .prevHash(fake_hash)
+            .build());
+    apply(storage, *genesis);
+    block = std::make_unique<shared_model::proto::Block>(
+        TestBlockBuilder()
+            .transactions(std::vector<shared_model::proto::Transaction>(
+                {TestTransactionBuilder()
+                     .creatorAccountId("admin@test")
+                     .addPeer(kBlockPeer, fake_pubkey)
+                     .build()}))
+            .height(2)
+            .prevHash(genesis->hash())
+            .build());
+  }
+
+  /**
+   * Apply a transaction with the prepared peer to a temporary wsv and keep it
+   * as the prepared state of a block
+   * @param block_hash - hash of the prepared block
+   * @param top_hash - hash of the top block the state is based on
+   */
+  void prepare(const shared_model::interface::types::HashType &block_hash,
+               const shared_model::interface::types::HashType &top_hash) {
+    std::unique_ptr<TemporaryWsv> wsv;
+    storage->createTemporaryWsv().match(
+        [&](iroha::expected::Value<std::unique_ptr<TemporaryWsv>> &_wsv) {
+          wsv = std::move(_wsv.value);
+        },
+        [](iroha::expected::Error<std::string> &error) {
+          FAIL() << "TemporaryWsv: " << error.error;
+        });
+    ASSERT_TRUE(wsv);
+    auto tx = TestTransactionBuilder()
+                  .creatorAccountId("admin@test")
+                  .addPeer(kPreparedPeer, fake_pubkey)
+                  .build();
+    auto result = wsv->apply(
+        tx,
+        [](const auto &, auto &)
+            -> iroha::expected::Result<void, iroha::validation::CommandError> {
+          return {};
+        });
+    ASSERT_TRUE(framework::expected::val(result));
+    storage->prepareBlock(std::move(wsv), block_hash, top_hash);
+  }
+
+  /**
+   * @return addresses of the peers in the ledger
+   */
+  std::vector<std::string> peers() {
+    std::vector<std::string> addresses;
+    if (auto peers = storage->getWsvQuery()->getPeers()) {
+      for (const auto &peer : *peers) {
+        addresses.push_back(peer->address());
+      }
+    }
+    return addresses;
+  }
+
+  /**
+   * Check that the block is the top one in the block store and in the ledger
+   */
+  void checkTopBlock() {
+    auto top_block =
+        framework::expected::val(storage->getBlockQuery()->getTopBlock());
+    ASSERT_TRUE(top_block);
+    ASSERT_EQ(*top_block->value, *block);
+    ASSERT_EQ(*storage->getBlockQuery()->getBlocks(2, 1)[0], *block);
+  }
+
+  const std::string kBlockPeer = "block:50541";
+  const std::string kPreparedPeer = "prepared:50541";
+
+  std::unique_ptr<shared_model::proto::Block> genesis, block;
+};
+
+/**
+ * @given block prepared on top of the current top block
+ * @when the block is applied and committed
+ * @then the prepared state is committed instead of execution of the block
+ * @and the block becomes the top one
+ */
+TEST_F(PreparedBlockTest, PreparedBlockIsCommitted) {
+  prepare(block->hash(), genesis->hash());
+
+  apply(storage, *block);
+
+  checkTopBlock();
+  ASSERT_EQ(peers(), std::vector<std::string>{kPreparedPeer});
+}
+
+/**
+ * @given prepared state of another block
+ * @when the block is applied and committed
+ * @then the prepared state is rolled back and the block is executed
+ */
+TEST_F(PreparedBlockTest, MismatchedHashExecutesBlock) {
+  prepare(fake_hash, genesis->hash());
+
+  apply(storage, *block);
+
+  checkTopBlock();
+  ASSERT_EQ(peers(), std::vector<std::string>{kBlockPeer});
+}
+
+/**
+ * @given block prepared on top of a block, which is not the top one anymore
+ * @when the block is applied and committed
+ * @then the prepared state is rolled back and the block is executed
+ */
+TEST_F(PreparedBlockTest, StaleTopBlockExecutesBlock) {
+  prepare(block->hash(), fake_hash);
+
+  apply(storage, *block);
+
+  checkTopBlock();
+  ASSERT_EQ(peers(), std::vector<std::string>{kBlockPeer});
+}
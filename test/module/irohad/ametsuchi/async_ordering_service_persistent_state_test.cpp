@@ -0,0 +1,99 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/async_ordering_service_persistent_state.hpp"
+
+#include <gtest/gtest.h>
+
+#include "module/irohad/ordering/mock_ordering_service_persistent_state.hpp"
+
+using namespace iroha::ametsuchi;
+using namespace std::chrono_literals;
+
+using ::testing::_;
+using ::testing::InSequence;
+using ::testing::Invoke;
+using ::testing::Return;
+
+class AsyncOrderingServicePersistentStateTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    storage = std::make_shared<MockOrderingServicePersistentState>();
+    state = std::make_unique<AsyncOrderingServicePersistentState>(storage);
+  }
+
+  std::shared_ptr<MockOrderingServicePersistentState> storage;
+  std::unique_ptr<AsyncOrderingServicePersistentState> state;
+};
+
+/**
+ * @given state without saved heights
+ * @when height is loaded
+ * @then it is read from the storage
+ */
+TEST_F(AsyncOrderingServicePersistentStateTest, LoadFromStorage) {
+  EXPECT_CALL(*storage, loadProposalHeight())
+      .WillOnce(Return(boost::optional<size_t>(5)));
+
+  EXPECT_EQ(5, state->loadProposalHeight().value_or(0));
+}
+
+/**
+ * @given state with storage which blocks on write
+ * @when several heights are saved during the write
+ * @then saving does not wait, the latest height is loaded without the
+ * storage, and only the latest one is written after the blocked write
+ */
+TEST_F(AsyncOrderingServicePersistentStateTest, LatestHeightWritten) {
+  std::mutex mutex;
+  std::condition_variable cv;
+  bool writing = false, released = false;
+  {
+    InSequence seq;
+    EXPECT_CALL(*storage, saveProposalHeight(2))
+        .WillOnce(Invoke([&](auto) {
+          std::unique_lock<std::mutex> lock(mutex);
+          writing = true;
+          cv.notify_one();
+          cv.wait(lock, [&] { return released; });
+          return true;
+        }));
+    EXPECT_CALL(*storage, saveProposalHeight(4)).WillOnce(Return(true));
+  }
+  EXPECT_CALL(*storage, loadProposalHeight()).Times(0);
+
+  EXPECT_TRUE(state->saveProposalHeight(2));
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    ASSERT_TRUE(cv.wait_for(lock, 5s, [&] { return writing; }));
+  }
+  EXPECT_TRUE(state->saveProposalHeight(3));
+  EXPECT_TRUE(state->saveProposalHeight(4));
+  EXPECT_EQ(4, state->loadProposalHeight().value_or(0));
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    released = true;
+  }
+  cv.notify_one();
+
+  // pending height is written on destruction
+  state.reset();
+}
+
+/**
+ * @given state with a saved height
+ * @when the state is reset
+ * @then the storage is reset and the height is loaded from it again
+ */
+TEST_F(AsyncOrderingServicePersistentStateTest, ResetDropsSavedHeight) {
+  EXPECT_CALL(*storage, saveProposalHeight(_)).WillRepeatedly(Return(true));
+  EXPECT_CALL(*storage, resetState()).WillOnce(Return(true));
+  EXPECT_CALL(*storage, loadProposalHeight())
+      .WillOnce(Return(boost::optional<size_t>(2)));
+
+  state->saveProposalHeight(10);
+  EXPECT_TRUE(state->resetState());
+  EXPECT_EQ(2, state->loadProposalHeight().value_or(0));
+}
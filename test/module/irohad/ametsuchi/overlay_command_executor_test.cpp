@@ -0,0 +1,280 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/overlay_command_executor.hpp"
+
+#include <gtest/gtest.h>
+
+#include "ametsuchi/impl/postgres_command_executor.hpp"
+#include "ametsuchi/impl/postgres_wsv_query.hpp"
+#include "module/irohad/ametsuchi/ametsuchi_fixture.hpp"
+#include "module/irohad/ametsuchi/ametsuchi_mocks.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+
+using namespace iroha::ametsuchi;
+using namespace shared_model::interface::permissions;
+using ::testing::NiceMock;
+
+/**
+ * Runs the same commands on the overlay executor and on the Postgres one,
+ * which is the reference, and compares results of the commands and the world
+ * state views they leave
+ */
+class OverlayCommandExecutorTest : public AmetsuchiTest {
+ public:
+  void SetUp() override {
+    AmetsuchiTest::SetUp();
+    sql = std::make_unique<soci::session>(soci::postgresql, pgopt_);
+    *sql << init_;
+
+    auto factory =
+        std::make_shared<shared_model::proto::ProtoCommonObjectsFactory<
+            shared_model::validation::FieldValidator>>();
+    postgres_query = std::make_unique<PostgresWsvQuery>(*sql, factory);
+    postgres_executor = std::make_unique<PostgresCommandExecutor>(*sql);
+
+    overlay = std::make_shared<WsvOverlay>(
+        std::make_shared<NiceMock<MockWsvQuery>>(), factory);
+    overlay_executor =
+        std::make_unique<OverlayCommandExecutor>(overlay, factory);
+  }
+
+  /**
+   * Execute the command with both executors and check that the results are
+   * the same
+   */
+  void execute(const TestTransactionBuilder &builder,
+               const std::string &creator = "admin@domain") {
+    auto tx = builder.build();
+    const auto &command = tx.commands().front();
+    postgres_executor->setCreatorAccountId(creator);
+    overlay_executor->setCreatorAccountId(creator);
+    auto expected = boost::apply_visitor(*postgres_executor, command.get());
+    auto result = boost::apply_visitor(*overlay_executor, command.get());
+    EXPECT_EQ(describe(result), describe(expected)) << command.toString();
+  }
+
+  /**
+   * @return empty string for a successful command, otherwise name of the
+   * command and its error without details of the database
+   */
+  static std::string describe(const CommandResult &result) {
+    return result.match(
+        [](const iroha::expected::Value<void> &) { return std::string(); },
+        [](const iroha::expected::Error<CommandError> &error) {
+          auto &message = error.error.error_message;
+          return error.error.command_name + ": "
+              + message.substr(0, message.find('\n'));
+        });
+  }
+
+  /**
+   * Check that the wsv queries give the same state for the given accounts
+   * and assets
+   */
+  void compareState(const std::vector<std::string> &accounts,
+                    const std::vector<std::string> &assets) {
+    auto sorted = [](auto values) {
+      if (values) {
+        std::sort(values->begin(), values->end());
+      }
+      return values;
+    };
+
+    EXPECT_EQ(sorted(overlay->getRoles()), sorted(postgres_query->getRoles()));
+    for (const auto &role : *postgres_query->getRoles()) {
+      auto expected = postgres_query->getRolePermissions(role);
+      auto permissions = overlay->getRolePermissions(role);
+      ASSERT_TRUE(expected);
+      ASSERT_TRUE(permissions) << role;
+      EXPECT_EQ(permissions->toBitstring(), expected->toBitstring()) << role;
+    }
+
+    auto peers = [](WsvQuery &query) {
+      std::vector<std::string> addresses;
+      for (const auto &peer : query.getPeers().value_or(
+               std::vector<std::shared_ptr<shared_model::interface::Peer>>{})) {
+        addresses.push_back(peer->address() + " " + peer->pubkey().hex());
+      }
+      std::sort(addresses.begin(), addresses.end());
+      return addresses;
+    };
+    EXPECT_EQ(peers(*overlay), peers(*postgres_query));
+
+    auto signatories = [](WsvQuery &query, const std::string &account_id) {
+      std::vector<std::string> keys;
+      for (const auto &key : query.getSignatories(account_id).value_or(
+               std::vector<shared_model::interface::types::PubkeyType>{})) {
+        keys.push_back(key.hex());
+      }
+      std::sort(keys.begin(), keys.end());
+      return keys;
+    };
+
+    for (const auto &account_id : accounts) {
+      auto expected = postgres_query->getAccount(account_id);
+      auto account = overlay->getAccount(account_id);
+      ASSERT_EQ(static_cast<bool>(account), static_cast<bool>(expected))
+          << account_id;
+      if (not expected) {
+        continue;
+      }
+      EXPECT_EQ((*account)->domainId(), (*expected)->domainId());
+      EXPECT_EQ((*account)->quorum(), (*expected)->quorum()) << account_id;
+      EXPECT_EQ(sorted(overlay->getAccountRoles(account_id)),
+                sorted(postgres_query->getAccountRoles(account_id)))
+          << account_id;
+      EXPECT_EQ(signatories(*overlay, account_id),
+                signatories(*postgres_query, account_id))
+          << account_id;
+      for (const auto &permitee : accounts) {
+        EXPECT_EQ(overlay->hasAccountGrantablePermission(
+                      permitee, account_id, Grantable::kSetMyQuorum),
+                  postgres_query->hasAccountGrantablePermission(
+                      permitee, account_id, Grantable::kSetMyQuorum))
+            << permitee << " of " << account_id;
+      }
+      for (const auto &asset_id : assets) {
+        auto expected_asset =
+            postgres_query->getAccountAsset(account_id, asset_id);
+        auto asset = overlay->getAccountAsset(account_id, asset_id);
+        ASSERT_EQ(static_cast<bool>(asset), static_cast<bool>(expected_asset))
+            << account_id << " " << asset_id;
+        if (expected_asset) {
+          EXPECT_EQ((*asset)->balance().toStringRepr(),
+                    (*expected_asset)->balance().toStringRepr())
+              << account_id << " " << asset_id;
+        }
+      }
+    }
+  }
+
+  /**
+   * Create role, domain and accounts used by the tests
+   */
+  void createAccounts() {
+    execute(TestTransactionBuilder().createRole(
+        "admin",
+        shared_model::interface::RolePermissionSet(
+            {Role::kAddPeer, Role::kAddSignatory, Role::kSetQuorum})));
+    execute(TestTransactionBuilder().createRole(
+        "user", shared_model::interface::RolePermissionSet()));
+    execute(TestTransactionBuilder().createDomain(domain, "user"));
+    execute(TestTransactionBuilder().createAccount("admin", domain, key1));
+    execute(TestTransactionBuilder().createAccount("user", domain, key1));
+    execute(TestTransactionBuilder().appendRole("admin@domain", "admin"));
+  }
+
+  const std::string domain = "domain";
+  const std::string asset_id = "coin#domain";
+  const shared_model::interface::types::PubkeyType key1{std::string(32, '1')};
+  const shared_model::interface::types::PubkeyType key2{std::string(32, '2')};
+
+  std::unique_ptr<soci::session> sql;
+  std::unique_ptr<WsvQuery> postgres_query;
+  std::unique_ptr<CommandExecutor> postgres_executor;
+  std::shared_ptr<WsvOverlay> overlay;
+  std::unique_ptr<CommandExecutor> overlay_executor;
+};
+
+/**
+ * @given empty world state views
+ * @when roles, domains, accounts and peers are created, also twice or with
+ * missing dependencies
+ * @then both executors give the same results and states
+ */
+TEST_F(OverlayCommandExecutorTest, CreationCommands) {
+  execute(TestTransactionBuilder().createDomain("another", "missing"));
+  createAccounts();
+
+  execute(TestTransactionBuilder().createRole(
+      "user", shared_model::interface::RolePermissionSet()));
+  execute(TestTransactionBuilder().createDomain(domain, "user"));
+  execute(TestTransactionBuilder().createAccount("user", domain, key2));
+  execute(TestTransactionBuilder().createAccount("user", "missing", key2));
+  execute(TestTransactionBuilder().createAsset("coin", domain, 2));
+  execute(TestTransactionBuilder().createAsset("coin", domain, 1));
+  execute(TestTransactionBuilder().createAsset("coin", "missing", 1));
+  execute(TestTransactionBuilder().addPeer("peer:50541", key1));
+  execute(TestTransactionBuilder().addPeer("peer:50541", key1));
+
+  compareState({"admin@domain", "user@domain", "user@missing"}, {asset_id});
+}
+
+/**
+ * @given accounts with roles
+ * @when roles, signatories, quorums and grantable permissions are changed,
+ * also of missing accounts
+ * @then both executors give the same results and states
+ */
+TEST_F(OverlayCommandExecutorTest, AccountCommands) {
+  createAccounts();
+
+  execute(TestTransactionBuilder().appendRole("user@domain", "admin"));
+  execute(TestTransactionBuilder().appendRole("user@domain", "admin"));
+  execute(TestTransactionBuilder().appendRole("user@domain", "missing"));
+  execute(TestTransactionBuilder().appendRole("missing@domain", "admin"));
+  execute(TestTransactionBuilder().detachRole("user@domain", "admin"));
+  execute(TestTransactionBuilder().detachRole("user@domain", "admin"));
+
+  execute(TestTransactionBuilder().addSignatory("user@domain", key2));
+  execute(TestTransactionBuilder().addSignatory("user@domain", key2));
+  execute(TestTransactionBuilder().addSignatory("missing@domain", key2));
+  execute(TestTransactionBuilder().setAccountQuorum("user@domain", 2));
+  execute(TestTransactionBuilder().setAccountQuorum("missing@domain", 2));
+  execute(TestTransactionBuilder().removeSignatory("user@domain", key2));
+  execute(TestTransactionBuilder().setAccountQuorum("user@domain", 1));
+  execute(TestTransactionBuilder().removeSignatory("user@domain", key2));
+  execute(TestTransactionBuilder().removeSignatory("user@domain", key1));
+
+  execute(TestTransactionBuilder().grantPermission("admin@domain",
+                                                   Grantable::kSetMyQuorum),
+          "user@domain");
+  execute(TestTransactionBuilder().grantPermission("admin@domain",
+                                                   Grantable::kSetMyQuorum),
+          "user@domain");
+  execute(TestTransactionBuilder().revokePermission("user@domain",
+                                                    Grantable::kSetMyQuorum),
+          "admin@domain");
+  execute(TestTransactionBuilder().setAccountDetail("user@domain", "k", "v"));
+  execute(
+      TestTransactionBuilder().setAccountDetail("missing@domain", "k", "v"));
+
+  compareState({"admin@domain", "user@domain", "missing@domain"}, {});
+}
+
+/**
+ * @given accounts and an asset
+ * @when quantities are added, subtracted and transferred with various
+ * precisions, also beyond balances and to missing accounts
+ * @then both executors give the same results and balances
+ */
+TEST_F(OverlayCommandExecutorTest, AssetCommands) {
+  createAccounts();
+  execute(TestTransactionBuilder().createAsset("coin", domain, 2));
+
+  execute(TestTransactionBuilder().addAssetQuantity(asset_id, "1.5"));
+  execute(TestTransactionBuilder().addAssetQuantity(asset_id, "0.25"));
+  execute(TestTransactionBuilder().addAssetQuantity(asset_id, "0.001"));
+  execute(TestTransactionBuilder().addAssetQuantity("missing#domain", "1"));
+  execute(TestTransactionBuilder().addAssetQuantity(asset_id, "1"),
+          "missing@domain");
+
+  execute(TestTransactionBuilder().subtractAssetQuantity(asset_id, "0.5"));
+  execute(TestTransactionBuilder().subtractAssetQuantity(asset_id, "2"));
+  execute(TestTransactionBuilder().subtractAssetQuantity(asset_id, "1"),
+          "user@domain");
+
+  execute(TestTransactionBuilder().transferAsset(
+      "admin@domain", "user@domain", asset_id, "", "0.75"));
+  execute(TestTransactionBuilder().transferAsset(
+      "admin@domain", "user@domain", asset_id, "", "1"));
+  execute(TestTransactionBuilder().transferAsset(
+      "admin@domain", "missing@domain", asset_id, "", "0.1"));
+  execute(TestTransactionBuilder().transferAsset(
+      "user@domain", "admin@domain", asset_id, "", "0.75"));
+
+  compareState({"admin@domain", "user@domain"}, {asset_id});
+}
@@ -0,0 +1,189 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/wsv_overlay.hpp"
+
+#include <gtest/gtest.h>
+
+#include "ametsuchi/impl/overlay_command_executor.hpp"
+#include "backend/protobuf/common_objects/proto_common_objects_factory.hpp"
+#include "framework/result_fixture.hpp"
+#include "module/irohad/ametsuchi/ametsuchi_mocks.hpp"
+#include "module/shared_model/builders/protobuf/test_account_builder.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+#include "validators/field_validator.hpp"
+
+using namespace iroha::ametsuchi;
+using namespace framework::expected;
+using ::testing::_;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+class WsvOverlayTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    base = std::make_shared<NiceMock<MockWsvQuery>>();
+    auto factory =
+        std::make_shared<shared_model::proto::ProtoCommonObjectsFactory<
+            shared_model::validation::FieldValidator>>();
+    overlay = std::make_shared<WsvOverlay>(base, factory);
+    executor = std::make_shared<OverlayCommandExecutor>(overlay, factory);
+
+    ASSERT_TRUE(val(execute(TestTransactionBuilder().createRole(
+        role, shared_model::interface::RolePermissionSet()))));
+    ASSERT_TRUE(
+        val(execute(TestTransactionBuilder().createDomain(domain, role))));
+    ASSERT_TRUE(val(execute(
+        TestTransactionBuilder().createAccount("id", domain, pubkey))));
+    ASSERT_TRUE(val(execute(
+        TestTransactionBuilder().createAccount("other", domain, pubkey))));
+    ASSERT_TRUE(
+        val(execute(TestTransactionBuilder().createAsset("coin", domain, 2))));
+  }
+
+  CommandResult execute(const TestTransactionBuilder &builder,
+                        const std::string &creator = "id@domain") {
+    executor->setCreatorAccountId(creator);
+    return boost::apply_visitor(*executor,
+                                builder.build().commands().front().get());
+  }
+
+  /**
+   * @return balance of the account as a string, empty if it has no asset
+   */
+  std::string balance(const std::string &account_id) {
+    auto asset = overlay->getAccountAsset(account_id, asset_id);
+    return asset ? (*asset)->balance().toStringRepr() : "";
+  }
+
+  std::string role = "user";
+  std::string domain = "domain";
+  std::string asset_id = "coin#domain";
+  shared_model::interface::types::PubkeyType pubkey{std::string(32, '1')};
+
+  std::shared_ptr<MockWsvQuery> base;
+  std::shared_ptr<WsvOverlay> overlay;
+  std::shared_ptr<OverlayCommandExecutor> executor;
+};
+
+/**
+ * @given overlay with no data in the underlying wsv
+ * @when objects are created by commands
+ * @then they are returned by the overlay
+ */
+TEST_F(WsvOverlayTest, CreatedObjectsAreVisible) {
+  auto account = overlay->getAccount("id@domain");
+  ASSERT_TRUE(account);
+  EXPECT_EQ((*account)->domainId(), domain);
+  EXPECT_EQ((*account)->quorum(), 1);
+  EXPECT_EQ(*overlay->getAccountRoles("id@domain"),
+            std::vector<std::string>{role});
+  EXPECT_EQ(overlay->getSignatories("id@domain")->size(), 1);
+  EXPECT_TRUE(overlay->getAsset(asset_id));
+  EXPECT_EQ(*overlay->getRoles(), std::vector<std::string>{role});
+
+  EXPECT_TRUE(err(execute(
+      TestTransactionBuilder().createAccount("id", domain, pubkey))));
+  EXPECT_TRUE(err(
+      execute(TestTransactionBuilder().createDomain("another", "missing"))));
+}
+
+/**
+ * @given account with some asset
+ * @when assets are added, subtracted and transferred
+ * @then balances are computed with the most precise operand
+ * @and overdrafts are rejected
+ */
+TEST_F(WsvOverlayTest, AssetArithmetic) {
+  ASSERT_TRUE(
+      val(execute(TestTransactionBuilder().addAssetQuantity(asset_id, "1.5"))));
+  ASSERT_TRUE(val(
+      execute(TestTransactionBuilder().addAssetQuantity(asset_id, "0.25"))));
+  EXPECT_EQ(balance("id@domain"), "1.75");
+
+  EXPECT_TRUE(err(
+      execute(TestTransactionBuilder().addAssetQuantity(asset_id, "0.001"))));
+  EXPECT_TRUE(err(execute(
+      TestTransactionBuilder().subtractAssetQuantity(asset_id, "2"))));
+
+  ASSERT_TRUE(val(execute(TestTransactionBuilder().transferAsset(
+      "id@domain", "other@domain", asset_id, "", "0.75"))));
+  EXPECT_EQ(balance("id@domain"), "1.00");
+  EXPECT_EQ(balance("other@domain"), "0.75");
+  EXPECT_TRUE(err(execute(TestTransactionBuilder().transferAsset(
+      "id@domain", "other@domain", asset_id, "", "1.01"))));
+  EXPECT_EQ(overlay->getAccountAssets("id@domain")->size(), 1);
+}
+
+/**
+ * @given account with some asset
+ * @when changes are made after a savepoint, which is rolled back
+ * @then state of the savepoint is restored
+ * @and changes made after a released savepoint are kept
+ */
+TEST_F(WsvOverlayTest, RollbackToSavepoint) {
+  ASSERT_TRUE(
+      val(execute(TestTransactionBuilder().addAssetQuantity(asset_id, "1"))));
+
+  auto batch = overlay->createSavepoint();
+  auto tx = overlay->createSavepoint();
+  ASSERT_TRUE(val(execute(TestTransactionBuilder().transferAsset(
+      "id@domain", "other@domain", asset_id, "", "0.5"))));
+  ASSERT_TRUE(val(execute(
+      TestTransactionBuilder().createAccount("new", domain, pubkey))));
+  overlay->releaseSavepoint(tx);
+  EXPECT_EQ(balance("other@domain"), "0.5");
+
+  tx = overlay->createSavepoint();
+  ASSERT_TRUE(val(
+      execute(TestTransactionBuilder().addAssetQuantity(asset_id, "2"))));
+  overlay->rollbackToSavepoint(tx);
+  EXPECT_EQ(balance("id@domain"), "0.5");
+
+  overlay->rollbackToSavepoint(batch);
+  EXPECT_EQ(balance("id@domain"), "1");
+  EXPECT_EQ(balance("other@domain"), "");
+  EXPECT_FALSE(overlay->getAccount("new@domain"));
+}
+
+/**
+ * @given account in the underlying wsv
+ * @when it is read and changed several times
+ * @then the underlying wsv is queried once
+ */
+TEST_F(WsvOverlayTest, ReadsUnderlyingWsvOnce) {
+  std::shared_ptr<shared_model::interface::Account> account =
+      clone(TestAccountBuilder()
+                .accountId("base@domain")
+                .domainId(domain)
+                .quorum(2)
+                .jsonData("{}")
+                .build());
+  EXPECT_CALL(*base, getAccount("base@domain"))
+      .WillOnce(Return(boost::make_optional(account)));
+
+  ASSERT_TRUE(overlay->getAccount("base@domain"));
+  ASSERT_TRUE(val(execute(
+      TestTransactionBuilder().setAccountQuorum("base@domain", 3))));
+  auto changed = overlay->getAccount("base@domain");
+  ASSERT_TRUE(changed);
+  EXPECT_EQ((*changed)->quorum(), 3);
+}
+
+/**
+ * @given account created in the overlay
+ * @when its detail is set
+ * @then the detail is returned under the key of its writer
+ */
+TEST_F(WsvOverlayTest, AccountDetail) {
+  ASSERT_TRUE(val(execute(TestTransactionBuilder().setAccountDetail(
+      "other@domain", "key", "value"))));
+
+  EXPECT_EQ(*overlay->getAccountDetail("other@domain", "key", "id@domain"),
+            R"({"id@domain":{"key":"value"}})");
+  EXPECT_EQ(*overlay->getAccountDetail("other@domain", "key"),
+            R"({"id@domain":{"key":"value"}})");
+  EXPECT_FALSE(overlay->getAccountDetail("other@domain", "missing"));
+}
@@ -0,0 +1,85 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gtest/gtest.h>
+
+#include "consensus/yac/impl/adaptive_delay.hpp"
+#include "module/irohad/metrics/metrics_mocks.hpp"
+
+using namespace iroha::consensus::yac;
+using namespace std::chrono_literals;
+
+using ::testing::_;
+
+/**
+ * @given adaptive delay without observations
+ * @when current delay is requested
+ * @then initial value clamped to bounds is returned
+ */
+TEST(AdaptiveDelayTest, InitialDelayIsClamped) {
+  ASSERT_EQ(500ms, AdaptiveDelay(500ms, 100ms, 1000ms).current());
+  ASSERT_EQ(100ms, AdaptiveDelay(10ms, 100ms, 1000ms).current());
+  ASSERT_EQ(1000ms, AdaptiveDelay(5000ms, 100ms, 1000ms).current());
+}
+
+/**
+ * @given adaptive delay with equal bounds
+ * @when latency is observed
+ * @then delay stays fixed
+ */
+TEST(AdaptiveDelayTest, EqualBoundsKeepDelayFixed) {
+  AdaptiveDelay delay(300ms, 300ms, 300ms);
+  delay.observe(10ms);
+  delay.observe(5000ms);
+  ASSERT_EQ(300ms, delay.current());
+}
+
+/**
+ * @given adaptive delay
+ * @when stable latency is observed
+ * @then delay converges to the latency
+ */
+TEST(AdaptiveDelayTest, StableLatencyIsTracked) {
+  AdaptiveDelay delay(1000ms, 10ms, 5000ms);
+  // first observation: average 100, deviation 50
+  delay.observe(100ms);
+  ASSERT_EQ(300ms, delay.current());
+  for (int i = 0; i < 100; ++i) {
+    delay.observe(100ms);
+  }
+  ASSERT_EQ(101ms, delay.current());
+}
+
+/**
+ * @given adaptive delay which tracks low latency
+ * @when latency spikes
+ * @then delay grows and is limited by upper bound
+ */
+TEST(AdaptiveDelayTest, LatencySpikeIsBounded) {
+  AdaptiveDelay delay(100ms, 50ms, 2000ms);
+  for (int i = 0; i < 100; ++i) {
+    delay.observe(100ms);
+  }
+  auto before = delay.current();
+  delay.observe(1000ms);
+  ASSERT_GT(delay.current(), before);
+  for (int i = 0; i < 10; ++i) {
+    delay.observe(10000ms);
+  }
+  ASSERT_EQ(2000ms, delay.current());
+}
+
+/**
+ * @given adaptive delay with metrics sink
+ * @when latency is observed
+ * @then new delay is reported as a gauge
+ */
+TEST(AdaptiveDelayTest, DelayIsReported) {
+  auto sink = std::make_shared<iroha::metrics::MockMetricsSink>();
+  EXPECT_CALL(*sink, onGauge(AdaptiveDelay::kDelayGauge, 1000));
+  EXPECT_CALL(*sink, onGauge(AdaptiveDelay::kDelayGauge, 300));
+  AdaptiveDelay delay(1000ms, 10ms, 5000ms, sink);
+  delay.observe(100ms);
+}
@@ -88,7 +88,8 @@ class YacGateTest : public ::testing::Test {
                                          hash_provider,
                                          block_creator,
                                          block_loader,
-                                         delay);
+                                         delay,
+                                         false);
   }
 
   YacHash expected_hash;
@@ -209,7 +210,7 @@ TEST_F(YacGateTest, LoadBlockWhenDifferentCommit) {
   // load block
   auto sig = expected_block->signatures().begin();
   auto &pubkey = sig->publicKey();
-  EXPECT_CALL(*block_loader, retrieveBlock(pubkey, expected_block->hash()))
+  EXPECT_CALL(*block_loader, retrieveBlock(pubkey, expected_block->hash(), _))
       .WillOnce(Return(expected_block));
 
   init();
@@ -270,7 +271,7 @@ TEST_F(YacGateTest, LoadBlockWhenDifferentCommitFailFirst) {
   // load block
   auto sig = expected_block->signatures().begin();
   auto &pubkey = sig->publicKey();
-  EXPECT_CALL(*block_loader, retrieveBlock(pubkey, expected_block->hash()))
+  EXPECT_CALL(*block_loader, retrieveBlock(pubkey, expected_block->hash(), _))
       .WillOnce(Return(boost::none))
       .WillOnce(Return(expected_block));
 
@@ -289,3 +290,69 @@ TEST_F(YacGateTest, LoadBlockWhenDifferentCommitFailFirst) {
 
   ASSERT_TRUE(gate_wrapper.validate());
 }
+
+/**
+ * @given yac gate
+ * @when receives new commit different to the one it voted for, with votes of
+ * several peers
+ * @then block is requested from the voters at once
+ * AND the first loaded block is emitted, even if the first voter fails
+ */
+TEST_F(YacGateTest, LoadBlockFromAnyVoter) {
+  // make blocks
+  EXPECT_CALL(*block_creator, on_block())
+      .WillOnce(Return(
+          rxcpp::observable<>::just<shared_model::interface::BlockVariant>(
+              expected_block)));
+
+  // make hash from block
+  EXPECT_CALL(*hash_provider, makeHash(_)).WillOnce(Return(expected_hash));
+
+  // generate order of peers
+  EXPECT_CALL(*peer_orderer, getOrdering(_))
+      .WillOnce(Return(ClusterOrdering::create({mk_peer("fake_node")})));
+
+  EXPECT_CALL(*hash_gate, vote(expected_hash, _)).Times(1);
+
+  // expected values
+  expected_hash = YacHash("actual_proposal", "actual_block");
+
+  auto dead_voter = create_vote(expected_hash, "dead_voter");
+  auto alive_voter = create_vote(expected_hash, "alive_voter");
+  commit_message = CommitMessage({dead_voter, alive_voter});
+  expected_commit = rxcpp::observable<>::just(commit_message);
+
+  // yac consensus
+  EXPECT_CALL(*hash_gate, on_commit()).WillOnce(Return(expected_commit));
+
+  // convert yac hash to model hash
+  EXPECT_CALL(*hash_provider, toModelHash(expected_hash))
+      .WillOnce(Return(expected_block->hash()));
+
+  // load block: the first voter fails, the second one provides the block
+  EXPECT_CALL(*block_loader,
+              retrieveBlock(dead_voter.signature->publicKey(),
+                            expected_block->hash(),
+                            _))
+      .WillOnce(Return(boost::none));
+  EXPECT_CALL(*block_loader,
+              retrieveBlock(alive_voter.signature->publicKey(),
+                            expected_block->hash(),
+                            _))
+      .WillOnce(Return(expected_block));
+
+  init();
+
+  // verify that yac gate emit expected block
+  auto gate_wrapper = make_test_subscriber<CallExact>(gate->on_commit(), 1);
+  gate_wrapper.subscribe([this](const auto &block_variant) {
+    ASSERT_NO_THROW({
+      auto block = boost::apply_visitor(
+          framework::SpecifiedVisitor<decltype(expected_block)>(),
+          block_variant);
+      ASSERT_EQ(*block, *expected_block);
+    });
+  });
+
+  ASSERT_TRUE(gate_wrapper.validate());
+}
@@ -78,9 +78,9 @@ namespace iroha {
 
       class MockYacCryptoProvider : public YacCryptoProvider {
        public:
-        MOCK_METHOD1(verify, bool(CommitMessage));
-        MOCK_METHOD1(verify, bool(RejectMessage));
-        MOCK_METHOD1(verify, bool(VoteMessage));
+        MOCK_METHOD1(verify, bool(const CommitMessage &));
+        MOCK_METHOD1(verify, bool(const RejectMessage &));
+        MOCK_METHOD1(verify, bool(const VoteMessage &));
 
         VoteMessage getVote(YacHash hash) override {
           VoteMessage vote;
@@ -69,9 +69,9 @@ TEST_F(YacTest, YacWhenColdStartAndAchieveOneVote) {
   EXPECT_CALL(*network, send_reject(_, _)).Times(0);
   EXPECT_CALL(*network, send_vote(_, _)).Times(0);
 
-  EXPECT_CALL(*crypto, verify(An<CommitMessage>())).Times(0);
-  EXPECT_CALL(*crypto, verify(An<RejectMessage>())).Times(0);
-  EXPECT_CALL(*crypto, verify(An<VoteMessage>()))
+  EXPECT_CALL(*crypto, verify(An<const CommitMessage &>())).Times(0);
+  EXPECT_CALL(*crypto, verify(An<const RejectMessage &>())).Times(0);
+  EXPECT_CALL(*crypto, verify(An<const VoteMessage &>()))
       .Times(1)
       .WillRepeatedly(Return(true));
 
@@ -100,9 +100,9 @@ TEST_F(YacTest, YacWhenColdStartAndAchieveSupermajorityOfVotes) {
   EXPECT_CALL(*network, send_reject(_, _)).Times(0);
   EXPECT_CALL(*network, send_vote(_, _)).Times(0);
 
-  EXPECT_CALL(*crypto, verify(An<CommitMessage>())).Times(0);
-  EXPECT_CALL(*crypto, verify(An<RejectMessage>())).Times(0);
-  EXPECT_CALL(*crypto, verify(An<VoteMessage>()))
+  EXPECT_CALL(*crypto, verify(An<const CommitMessage &>())).Times(0);
+  EXPECT_CALL(*crypto, verify(An<const RejectMessage &>())).Times(0);
+  EXPECT_CALL(*crypto, verify(An<const VoteMessage &>()))
       .Times(default_peers.size())
       .WillRepeatedly(Return(true));
 
@@ -132,9 +132,10 @@ TEST_F(YacTest, YacWhenColdStartAndAchieveCommitMessage) {
   EXPECT_CALL(*network, send_reject(_, _)).Times(0);
   EXPECT_CALL(*network, send_vote(_, _)).Times(0);
 
-  EXPECT_CALL(*crypto, verify(An<CommitMessage>())).WillOnce(Return(true));
-  EXPECT_CALL(*crypto, verify(An<RejectMessage>())).Times(0);
-  EXPECT_CALL(*crypto, verify(An<VoteMessage>())).Times(0);
+  EXPECT_CALL(*crypto, verify(An<const CommitMessage &>()))
+      .WillOnce(Return(true));
+  EXPECT_CALL(*crypto, verify(An<const RejectMessage &>())).Times(0);
+  EXPECT_CALL(*crypto, verify(An<const VoteMessage &>())).Times(0);
 
   EXPECT_CALL(*timer, deny()).Times(AtLeast(1));
 
@@ -154,7 +155,7 @@ TEST_F(YacTest, YacWhenColdStartAndAchieveCommitMessage) {
  * @then commit is sent to the network before notifying subscribers
  */
 TEST_F(YacTest, PropagateCommitBeforeNotifyingSubscribersApplyVote) {
-  EXPECT_CALL(*crypto, verify(An<VoteMessage>()))
+  EXPECT_CALL(*crypto, verify(An<const VoteMessage &>()))
       .Times(default_peers.size())
       .WillRepeatedly(Return(true));
   std::vector<CommitMessage> messages;
@@ -183,7 +184,8 @@ TEST_F(YacTest, PropagateCommitBeforeNotifyingSubscribersApplyVote) {
  * @then commit is sent to the network before notifying subscribers
  */
 TEST_F(YacTest, PropagateCommitBeforeNotifyingSubscribersApplyReject) {
-  EXPECT_CALL(*crypto, verify(An<RejectMessage>())).WillOnce(Return(true));
+  EXPECT_CALL(*crypto, verify(An<const RejectMessage &>()))
+      .WillOnce(Return(true));
   EXPECT_CALL(*timer, deny()).Times(AtLeast(1));
   std::vector<CommitMessage> messages;
   EXPECT_CALL(*network, send_commit(_, _))
@@ -49,9 +49,10 @@ TEST_F(YacTest, ValidCaseWhenReceiveSupermajority) {
 
   EXPECT_CALL(*timer, deny()).Times(0);
 
-  EXPECT_CALL(*crypto, verify(An<CommitMessage>())).Times(0);
-  EXPECT_CALL(*crypto, verify(An<RejectMessage>())).Times(0);
-  EXPECT_CALL(*crypto, verify(An<VoteMessage>())).WillRepeatedly(Return(true));
+  EXPECT_CALL(*crypto, verify(An<const CommitMessage &>())).Times(0);
+  EXPECT_CALL(*crypto, verify(An<const RejectMessage &>())).Times(0);
+  EXPECT_CALL(*crypto, verify(An<const VoteMessage &>()))
+      .WillRepeatedly(Return(true));
 
   YacHash my_hash("proposal_hash", "block_hash");
   yac->vote(my_hash, my_order.value());
@@ -84,10 +85,11 @@ TEST_F(YacTest, ValidCaseWhenReceiveCommit) {
 
   EXPECT_CALL(*timer, deny()).Times(AtLeast(1));
 
-  EXPECT_CALL(*crypto, verify(An<CommitMessage>()))
+  EXPECT_CALL(*crypto, verify(An<const CommitMessage &>()))
+      .WillRepeatedly(Return(true));
+  EXPECT_CALL(*crypto, verify(An<const RejectMessage &>())).Times(0);
+  EXPECT_CALL(*crypto, verify(An<const VoteMessage &>()))
       .WillRepeatedly(Return(true));
-  EXPECT_CALL(*crypto, verify(An<RejectMessage>())).Times(0);
-  EXPECT_CALL(*crypto, verify(An<VoteMessage>())).WillRepeatedly(Return(true));
 
   yac->vote(my_hash, my_order.value());
 
@@ -121,10 +123,11 @@ TEST_F(YacTest, ValidCaseWhenReceiveCommitTwice) {
   EXPECT_CALL(*network, send_reject(_, _)).Times(0);
   EXPECT_CALL(*network, send_vote(_, _)).Times(my_peers.size());
 
-  EXPECT_CALL(*crypto, verify(An<CommitMessage>()))
+  EXPECT_CALL(*crypto, verify(An<const CommitMessage &>()))
+      .WillRepeatedly(Return(true));
+  EXPECT_CALL(*crypto, verify(An<const RejectMessage &>())).Times(0);
+  EXPECT_CALL(*crypto, verify(An<const VoteMessage &>()))
       .WillRepeatedly(Return(true));
-  EXPECT_CALL(*crypto, verify(An<RejectMessage>())).Times(0);
-  EXPECT_CALL(*crypto, verify(An<VoteMessage>())).WillRepeatedly(Return(true));
 
   yac->vote(my_hash, my_order.value());
 
@@ -160,11 +163,11 @@ TEST_F(YacTest, ValidCaseWhenSoloConsensus) {
 
   EXPECT_CALL(*timer, deny()).Times(AtLeast(1));
 
-  EXPECT_CALL(*crypto, verify(An<CommitMessage>()))
+  EXPECT_CALL(*crypto, verify(An<const CommitMessage &>()))
       .Times(1)
       .WillRepeatedly(Return(true));
-  EXPECT_CALL(*crypto, verify(An<RejectMessage>())).Times(0);
-  EXPECT_CALL(*crypto, verify(An<VoteMessage>()))
+  EXPECT_CALL(*crypto, verify(An<const RejectMessage &>())).Times(0);
+  EXPECT_CALL(*crypto, verify(An<const VoteMessage &>()))
       .Times(1)
       .WillRepeatedly(Return(true));
 
@@ -203,11 +206,11 @@ TEST_F(YacTest, ValidCaseWhenVoteAfterCommit) {
 
   EXPECT_CALL(*timer, deny()).Times(AtLeast(1));
 
-  EXPECT_CALL(*crypto, verify(An<CommitMessage>()))
+  EXPECT_CALL(*crypto, verify(An<const CommitMessage &>()))
       .Times(1)
       .WillRepeatedly(Return(true));
-  EXPECT_CALL(*crypto, verify(An<RejectMessage>())).Times(0);
-  EXPECT_CALL(*crypto, verify(An<VoteMessage>())).Times(0);
+  EXPECT_CALL(*crypto, verify(An<const RejectMessage &>())).Times(0);
+  EXPECT_CALL(*crypto, verify(An<const VoteMessage &>())).Times(0);
 
   YacHash my_hash("proposal_hash", "block_hash");
 
@@ -42,9 +42,9 @@ TEST_F(YacTest, UnknownVoteBeforeCommit) {
   EXPECT_CALL(*network, send_reject(_, _)).Times(0);
   EXPECT_CALL(*network, send_vote(_, _)).Times(0);
 
-  EXPECT_CALL(*crypto, verify(An<CommitMessage>())).Times(0);
-  EXPECT_CALL(*crypto, verify(An<RejectMessage>())).Times(0);
-  EXPECT_CALL(*crypto, verify(An<VoteMessage>()))
+  EXPECT_CALL(*crypto, verify(An<const CommitMessage &>())).Times(0);
+  EXPECT_CALL(*crypto, verify(An<const RejectMessage &>())).Times(0);
+  EXPECT_CALL(*crypto, verify(An<const VoteMessage &>()))
       .Times(1)
       .WillRepeatedly(Return(true));
 
@@ -81,9 +81,11 @@ TEST_F(YacTest, UnknownVoteAfterCommit) {
 
   EXPECT_CALL(*timer, deny()).Times(AtLeast(1));
 
-  EXPECT_CALL(*crypto, verify(An<CommitMessage>())).WillOnce(Return(true));
-  EXPECT_CALL(*crypto, verify(An<RejectMessage>())).Times(0);
-  EXPECT_CALL(*crypto, verify(An<VoteMessage>())).WillOnce(Return(true));
+  EXPECT_CALL(*crypto, verify(An<const CommitMessage &>()))
+      .WillOnce(Return(true));
+  EXPECT_CALL(*crypto, verify(An<const RejectMessage &>())).Times(0);
+  EXPECT_CALL(*crypto, verify(An<const VoteMessage &>()))
+      .WillOnce(Return(true));
 
   YacHash my_hash("proposal_hash", "block_hash");
 
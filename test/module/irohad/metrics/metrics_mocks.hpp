@@ -0,0 +1,26 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_METRICS_MOCKS_HPP
+#define IROHA_METRICS_MOCKS_HPP
+
+#include <gmock/gmock.h>
+
+#include "metrics/metrics_sink.hpp"
+
+namespace iroha {
+  namespace metrics {
+
+    class MockMetricsSink : public MetricsSink {
+     public:
+      MOCK_METHOD1(onRoundTrace, void(const RoundTrace &));
+      MOCK_METHOD2(onGauge, void(const std::string &, int64_t));
+      MOCK_METHOD2(onCounter, void(const std::string &, int64_t));
+    };
+
+  }  // namespace metrics
+}  // namespace iroha
+
+#endif  // IROHA_METRICS_MOCKS_HPP
@@ -0,0 +1,126 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "metrics/round_timer.hpp"
+#include "module/irohad/metrics/metrics_mocks.hpp"
+
+using namespace iroha::metrics;
+using namespace std::chrono_literals;
+
+using ::testing::_;
+using ::testing::SaveArg;
+
+class RoundTimerTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    sink = std::make_shared<MockMetricsSink>();
+    timer = std::make_shared<RoundTimer>(sink, [this] { return now; });
+  }
+
+  /// move the fake clock forward
+  void advance(Clock::duration duration) {
+    now += duration;
+  }
+
+  Clock::time_point now;
+  std::shared_ptr<MockMetricsSink> sink;
+  std::shared_ptr<RoundTimer> timer;
+};
+
+/**
+ * @given round timer
+ * @when all stages of the round are reported
+ * @then trace of the round is passed to the sink
+ * AND latency of every stage is recorded
+ */
+TEST_F(RoundTimerTest, FullRoundIsReported) {
+  RoundTrace trace;
+  EXPECT_CALL(*sink, onRoundTrace(_)).WillOnce(SaveArg<0>(&trace));
+
+  auto begin = now;
+  timer->mark(RoundStage::kProposalReceived, 2);
+  advance(1ms);
+  timer->mark(RoundStage::kValidationStarted, 2);
+  advance(10ms);
+  timer->mark(RoundStage::kValidationFinished, 2);
+  timer->mark(RoundStage::kBlockSigned, 2);
+  advance(1ms);
+  timer->mark(RoundStage::kFirstVoteSent);
+  advance(5ms);
+  // second vote must not override the first one
+  timer->mark(RoundStage::kFirstVoteSent);
+  timer->mark(RoundStage::kSupermajorityReached);
+  advance(3ms);
+  timer->mark(RoundStage::kCommitApplied, 2);
+
+  ASSERT_EQ(2, trace.height);
+  ASSERT_EQ(begin, *trace.at(RoundStage::kProposalReceived));
+  ASSERT_EQ(begin + 12ms, *trace.at(RoundStage::kFirstVoteSent));
+  ASSERT_EQ(begin + 20ms, *trace.at(RoundStage::kCommitApplied));
+
+  ASSERT_EQ(0, timer->stageLatency(RoundStage::kProposalReceived).count());
+  ASSERT_EQ(1, timer->stageLatency(RoundStage::kValidationFinished).count());
+  ASSERT_EQ(
+      std::chrono::microseconds(10ms),
+      timer->stageLatency(RoundStage::kValidationFinished).sum());
+  ASSERT_EQ(std::chrono::microseconds(5ms),
+            timer->stageLatency(RoundStage::kSupermajorityReached).sum());
+  ASSERT_EQ(std::chrono::microseconds(20ms), timer->roundLatency().sum());
+}
+
+/**
+ * @given round timer with an open round
+ * @when stages of another height are reported
+ * @then they are ignored
+ */
+TEST_F(RoundTimerTest, StagesOfOtherRoundsAreIgnored) {
+  RoundTrace trace;
+  EXPECT_CALL(*sink, onRoundTrace(_)).WillOnce(SaveArg<0>(&trace));
+
+  timer->mark(RoundStage::kProposalReceived, 2);
+  timer->mark(RoundStage::kValidationStarted, 1);
+  timer->mark(RoundStage::kCommitApplied, 2);
+
+  ASSERT_FALSE(trace.at(RoundStage::kValidationStarted));
+  ASSERT_TRUE(trace.at(RoundStage::kCommitApplied));
+}
+
+/**
+ * @given round timer with an open round
+ * @when proposal of the next round arrives before commit
+ * @then unfinished round is passed to the sink
+ */
+TEST_F(RoundTimerTest, UnfinishedRoundIsReported) {
+  RoundTrace trace;
+  EXPECT_CALL(*sink, onRoundTrace(_)).WillOnce(SaveArg<0>(&trace));
+
+  timer->mark(RoundStage::kProposalReceived, 2);
+  timer->mark(RoundStage::kProposalReceived, 3);
+
+  ASSERT_EQ(2, trace.height);
+  ASSERT_FALSE(trace.at(RoundStage::kCommitApplied));
+  ASSERT_EQ(0, timer->roundLatency().count());
+}
+
+/**
+ * @given latency histogram
+ * @when several values are recorded
+ * @then percentiles are estimated by bucket upper bounds
+ */
+TEST(LatencyHistogramTest, PercentileFallsIntoBucket) {
+  LatencyHistogram histogram;
+  histogram.record(3us);
+  histogram.record(100us);
+  histogram.record(1000us);
+
+  ASSERT_EQ(3, histogram.count());
+  ASSERT_EQ(1103us, histogram.sum());
+  ASSERT_EQ(4us, histogram.percentile(0.));
+  ASSERT_EQ(128us, histogram.percentile(0.5));
+  ASSERT_EQ(1024us, histogram.percentile(1.));
+}
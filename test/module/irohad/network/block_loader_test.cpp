@@ -239,3 +239,22 @@ TEST_F(BlockLoaderTest, ValidWhenBlockMissing) {
 
   ASSERT_FALSE(block);
 }
+
+/**
+ * @given block loader with a block
+ * @when retrieveBlock is called with a cancelled context
+ * @then nothing is returned AND the block is not read from the storage
+ */
+TEST_F(BlockLoaderTest, NothingWhenRequestCancelled) {
+  auto present =
+      getBaseBlockBuilder().build().signAndAddSignature(key).finish();
+
+  EXPECT_CALL(*peer_query, getLedgerPeers())
+      .WillOnce(Return(std::vector<wPeer>{peer}));
+  EXPECT_CALL(*storage, getBlocksFrom(1)).Times(0);
+  grpc::ClientContext context;
+  context.TryCancel();
+  auto block = loader->retrieveBlock(peer_key, present.hash(), context);
+
+  ASSERT_FALSE(block);
+}
@@ -19,6 +19,7 @@
 #define IROHA_NETWORK_MOCKS_HPP
 
 #include <gmock/gmock.h>
+#include <grpc++/client_context.h>
 #include "interfaces/iroha_internal/transaction_batch.hpp"
 #include "network/block_loader.hpp"
 #include "network/consensus_gate.hpp"
@@ -67,6 +68,12 @@ namespace iroha {
           boost::optional<std::shared_ptr<shared_model::interface::Block>>(
               const shared_model::crypto::PublicKey &,
               const shared_model::interface::types::HashType &));
+      MOCK_METHOD3(
+          retrieveBlock,
+          boost::optional<std::shared_ptr<shared_model::interface::Block>>(
+              const shared_model::crypto::PublicKey &,
+              const shared_model::interface::types::HashType &,
+              grpc::ClientContext &));
     };
 
     class MockOrderingGate : public OrderingGate {
@@ -0,0 +1,124 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ordering/impl/adaptive_proposal_size.hpp"
+
+#include <gtest/gtest.h>
+
+#include "module/irohad/metrics/metrics_mocks.hpp"
+
+using namespace iroha::ordering;
+using namespace iroha::metrics;
+using namespace std::chrono_literals;
+
+using ::testing::_;
+using ::testing::StrEq;
+
+class AdaptiveProposalSizeTest : public ::testing::Test {
+ public:
+  /**
+   * Report round of given height which took given time from proposal to
+   * commit
+   */
+  void commit(shared_model::interface::types::HeightType height,
+              std::chrono::milliseconds processing) {
+    RoundTrace trace;
+    trace.height = height;
+    Clock::time_point start;
+    trace.stages[static_cast<size_t>(RoundStage::kProposalReceived)] = start;
+    trace.stages[static_cast<size_t>(RoundStage::kCommitApplied)] =
+        start + processing;
+    sizing.onRoundTrace(trace);
+  }
+
+  AdaptiveProposalSize sizing{100, 1000ms, 1500ms};
+};
+
+/**
+ * @given adaptive proposal size without observations
+ * @then configured size and delay are used
+ */
+TEST_F(AdaptiveProposalSizeTest, StartsFromConfiguredValues) {
+  ASSERT_EQ(100, sizing.size());
+  ASSERT_EQ(1000ms, sizing.delay());
+}
+
+/**
+ * @given full proposal
+ * @when it is processed longer than the target latency
+ * @then size shrinks in proportion and delay is minimal
+ */
+TEST_F(AdaptiveProposalSizeTest, SlowRoundShrinksSize) {
+  sizing.proposed(1, 100);
+  commit(1, 3000ms);
+
+  ASSERT_EQ(50, sizing.size());
+  ASSERT_EQ(AdaptiveProposalSize::kMinDelay, sizing.delay());
+}
+
+/**
+ * @given shrunk proposal size
+ * @when full proposals are processed in time
+ * @then size grows back up to the configured one
+ * @and delay takes the rest of the target latency
+ */
+TEST_F(AdaptiveProposalSizeTest, FastRoundsGrowSize) {
+  sizing.proposed(1, 100);
+  commit(1, 3000ms);
+  ASSERT_EQ(50, sizing.size());
+
+  sizing.proposed(2, 50);
+  commit(2, 500ms);
+  ASSERT_EQ(62, sizing.size());
+
+  for (size_t height = 3; height < 10; ++height) {
+    sizing.proposed(height, sizing.size());
+    commit(height, 500ms);
+  }
+  ASSERT_EQ(100, sizing.size());
+  ASSERT_LT(sizing.delay(), 1000ms);
+  ASSERT_GT(sizing.delay(), AdaptiveProposalSize::kMinDelay);
+}
+
+/**
+ * @given proposal which is not full
+ * @when it is processed in time
+ * @then size is not changed
+ */
+TEST_F(AdaptiveProposalSizeTest, PartialProposalKeepsSize) {
+  sizing.proposed(1, 100);
+  commit(1, 3000ms);
+
+  sizing.proposed(2, 10);
+  commit(2, 500ms);
+  ASSERT_EQ(50, sizing.size());
+}
+
+/**
+ * @given round which was not proposed by this ordering service
+ * @when it is committed
+ * @then nothing is changed, but the trace and other metrics are passed to
+ * the next sink
+ */
+TEST(AdaptiveProposalSizeSinkTest, ForeignRoundIsPassedThrough) {
+  auto sink = std::make_shared<MockMetricsSink>();
+  AdaptiveProposalSize sizing(100, 1000ms, 1500ms, sink);
+
+  EXPECT_CALL(*sink, onRoundTrace(_));
+  EXPECT_CALL(*sink, onGauge(StrEq("other"), 1));
+  EXPECT_CALL(*sink, onCounter(StrEq("counter"), 2));
+
+  RoundTrace trace;
+  trace.height = 5;
+  trace.stages[static_cast<size_t>(RoundStage::kProposalReceived)] =
+      Clock::time_point{};
+  trace.stages[static_cast<size_t>(RoundStage::kCommitApplied)] =
+      Clock::time_point{} + 5000ms;
+  sizing.onRoundTrace(trace);
+  sizing.onGauge("other", 1);
+  sizing.onCounter("counter", 2);
+
+  ASSERT_EQ(100, sizing.size());
+}
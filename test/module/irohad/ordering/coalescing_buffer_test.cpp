@@ -0,0 +1,97 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ordering/impl/coalescing_buffer.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace iroha::ordering;
+using namespace std::chrono_literals;
+
+class CoalescingBufferTest : public ::testing::Test {
+ public:
+  using Buffer = CoalescingBuffer<int>;
+
+  Buffer::Flush flush() {
+    return [this](std::vector<int> items) {
+      std::lock_guard<std::mutex> lock(mutex);
+      flushes.push_back(std::move(items));
+      cv.notify_one();
+    };
+  }
+
+  /// wait until given number of flushes happen
+  bool waitFlushes(size_t count) {
+    std::unique_lock<std::mutex> lock(mutex);
+    return cv.wait_for(lock, 5s, [&] { return flushes.size() >= count; });
+  }
+
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::vector<std::vector<int>> flushes;
+};
+
+/**
+ * @given buffer of size 3 with long delay
+ * @when items of total size 3 and then one more item are added
+ * @then the first items are flushed at once and the last one stays
+ */
+TEST_F(CoalescingBufferTest, FlushOnSize) {
+  Buffer buffer(3, std::chrono::microseconds(1h), flush());
+
+  buffer.push(1, 1);
+  buffer.push(2, 2);
+  buffer.push(3, 1);
+
+  std::lock_guard<std::mutex> lock(mutex);
+  ASSERT_EQ(1, flushes.size());
+  EXPECT_EQ((std::vector<int>{1, 2}), flushes.at(0));
+}
+
+/**
+ * @given buffer of big size with short delay
+ * @when items are added
+ * @then they are flushed together after the delay
+ */
+TEST_F(CoalescingBufferTest, FlushOnTimeout) {
+  Buffer buffer(100, 1000us, flush());
+
+  buffer.push(1, 1);
+  buffer.push(2, 1);
+
+  ASSERT_TRUE(waitFlushes(1));
+  std::lock_guard<std::mutex> lock(mutex);
+  EXPECT_EQ((std::vector<int>{1, 2}), flushes.at(0));
+}
+
+/**
+ * @given buffer of size 2
+ * @when an item bigger than the size is added
+ * @then it is flushed whole
+ */
+TEST_F(CoalescingBufferTest, BigItemNotSplit) {
+  Buffer buffer(2, std::chrono::microseconds(1h), flush());
+
+  buffer.push(1, 5);
+
+  std::lock_guard<std::mutex> lock(mutex);
+  ASSERT_EQ(1, flushes.size());
+  EXPECT_EQ((std::vector<int>{1}), flushes.at(0));
+}
+
+/**
+ * @given buffer with long delay and an item in it
+ * @when the buffer is destroyed
+ * @then the item is flushed
+ */
+TEST_F(CoalescingBufferTest, FlushOnDestruction) {
+  {
+    Buffer buffer(100, std::chrono::microseconds(1h), flush());
+    buffer.push(1, 1);
+  }
+
+  ASSERT_EQ(1, flushes.size());
+  EXPECT_EQ((std::vector<int>{1}), flushes.at(0));
+}
@@ -0,0 +1,139 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ordering/impl/duplicate_batch_filter.hpp"
+
+#include <gtest/gtest.h>
+
+#include "cryptography/hash.hpp"
+#include "module/irohad/metrics/metrics_mocks.hpp"
+
+using namespace iroha::ordering;
+using namespace std::chrono_literals;
+
+using ::testing::_;
+using ::testing::StrEq;
+
+class DuplicateBatchFilterTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    sink = std::make_shared<iroha::metrics::MockMetricsSink>();
+    filter = std::make_unique<DuplicateBatchFilter>(
+        expiration, sink, [this] { return now; });
+  }
+
+  void advance(std::chrono::milliseconds time) {
+    now += time;
+  }
+
+  const std::chrono::milliseconds expiration = 100ms;
+  DuplicateBatchFilter::Clock::time_point now;
+  std::shared_ptr<iroha::metrics::MockMetricsSink> sink;
+  std::unique_ptr<DuplicateBatchFilter> filter;
+
+  shared_model::crypto::Hash first{"first"}, second{"second"};
+};
+
+/**
+ * @given empty filter
+ * @when two different hashes are inserted
+ * @then both are accepted and nothing is rejected
+ */
+TEST_F(DuplicateBatchFilterTest, DifferentBatchesAccepted) {
+  EXPECT_CALL(*sink, onCounter(_, _)).Times(0);
+
+  EXPECT_TRUE(filter->insert(first, 1));
+  EXPECT_TRUE(filter->insert(second, 1));
+  EXPECT_EQ(2, filter->size());
+  EXPECT_EQ(0, filter->rejectedCount());
+}
+
+/**
+ * @given filter with a hash
+ * @when the same hash is inserted again
+ * @then it is rejected and the counter is increased
+ */
+TEST_F(DuplicateBatchFilterTest, DuplicateRejected) {
+  EXPECT_CALL(*sink,
+              onCounter(StrEq(DuplicateBatchFilter::kRejectedCounter), 1));
+
+  EXPECT_TRUE(filter->insert(first, 1));
+  EXPECT_FALSE(filter->insert(first, 1));
+  EXPECT_EQ(1, filter->rejectedCount());
+}
+
+/**
+ * @given filter with a hash
+ * @when expiration time passes
+ * @then the hash is accepted again
+ */
+TEST_F(DuplicateBatchFilterTest, HashExpires) {
+  EXPECT_TRUE(filter->insert(first, 1));
+  advance(expiration);
+
+  EXPECT_TRUE(filter->insert(first, 1));
+  EXPECT_EQ(1, filter->size());
+}
+
+/**
+ * @given filter with a hash which is proposed later
+ * @when expiration time passes since the hash was received, but not since it
+ * was proposed
+ * @then the hash is still rejected
+ */
+TEST_F(DuplicateBatchFilterTest, ProposalProlongsHash) {
+  EXPECT_CALL(*sink, onCounter(_, _));
+
+  EXPECT_TRUE(filter->insert(first, 1));
+  advance(expiration / 2);
+  EXPECT_TRUE(filter->proposed(first, 1));
+  advance(expiration / 2);
+
+  EXPECT_FALSE(filter->insert(first, 1));
+
+  advance(expiration / 2);
+  EXPECT_TRUE(filter->insert(first, 1));
+}
+
+/**
+ * @given filter with a hash
+ * @when the hash is forgotten, because the batch is forwarded to another peer
+ * @then the hash is accepted again and is not expired by the old entry
+ */
+TEST_F(DuplicateBatchFilterTest, ForgottenHashAccepted) {
+  EXPECT_CALL(*sink,
+              onCounter(StrEq(DuplicateBatchFilter::kRejectedCounter), 1));
+
+  EXPECT_TRUE(filter->insert(first, 1));
+  filter->forget(first);
+  EXPECT_EQ(0, filter->size());
+
+  advance(expiration / 2);
+  EXPECT_TRUE(filter->insert(first, 1));
+  advance(expiration / 2);
+  EXPECT_FALSE(filter->insert(first, 1));
+  EXPECT_EQ(1, filter->rejectedCount());
+}
+
+/**
+ * @given filter with a hash of a batch
+ * @when a copy of the batch with more signatures is inserted
+ * @then it is accepted
+ * @and the previous copy is not proposed, while the new one is
+ * @and a copy with fewer signatures is rejected
+ */
+TEST_F(DuplicateBatchFilterTest, MoreSignaturesSupersede) {
+  EXPECT_CALL(*sink,
+              onCounter(StrEq(DuplicateBatchFilter::kRejectedCounter), 1));
+
+  EXPECT_TRUE(filter->insert(first, 1));
+  EXPECT_TRUE(filter->insert(first, 2));
+  EXPECT_EQ(1, filter->size());
+
+  EXPECT_FALSE(filter->proposed(first, 1));
+  EXPECT_TRUE(filter->proposed(first, 2));
+  EXPECT_FALSE(filter->insert(first, 1));
+  EXPECT_EQ(1, filter->rejectedCount());
+}
@@ -27,6 +27,7 @@
 #include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
 #include "ordering/impl/ordering_gate_impl.hpp"
 #include "ordering/impl/ordering_gate_transport_grpc.hpp"
+#include "ordering/impl/ordering_service_transport_grpc.hpp"
 
 using namespace iroha;
 using namespace iroha::ordering;
@@ -35,6 +36,7 @@ using namespace framework::test_subscriber;
 using namespace std::chrono_literals;
 
 using ::testing::_;
+using ::testing::Invoke;
 using ::testing::InvokeWithoutArgs;
 using ::testing::Return;
 
@@ -162,6 +164,83 @@ TEST_F(OrderingGateTest, ProposalReceivedByGateWhenSent) {
   ASSERT_TRUE(wrapper.validate());
 }
 
+class MockOrderingServiceNotification : public OrderingServiceNotification {
+ public:
+  void onBatch(shared_model::interface::TransactionBatch &&batch) override {
+    onBatchProxy(batch);
+  }
+
+  MOCK_METHOD1(onBatchProxy,
+               void(const shared_model::interface::TransactionBatch &));
+};
+
+class OrderingGateCoalescingTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    service_transport = std::make_shared<OrderingServiceTransportGrpc>();
+    notification = std::make_shared<MockOrderingServiceNotification>();
+    service_transport->subscribe(notification);
+
+    grpc::ServerBuilder builder;
+    int port = 0;
+    builder.AddListeningPort(
+        "0.0.0.0:0", grpc::InsecureServerCredentials(), &port);
+    builder.RegisterService(service_transport.get());
+    server = builder.BuildAndStart();
+    ASSERT_TRUE(server);
+    ASSERT_NE(port, 0);
+
+    transport = std::make_shared<OrderingGateTransportGrpc>(
+        "0.0.0.0:" + std::to_string(port), nullptr, 10, 500us);
+  }
+
+  void TearDown() override {
+    server->Shutdown();
+  }
+
+  std::shared_ptr<OrderingServiceTransportGrpc> service_transport;
+  std::shared_ptr<MockOrderingServiceNotification> notification;
+  std::unique_ptr<grpc::Server> server;
+  std::shared_ptr<OrderingGateTransportGrpc> transport;
+  std::condition_variable cv;
+  std::mutex m;
+};
+
+/**
+ * @given ordering gate transport, which coalesces transactions, and ordering
+ * service transport
+ * @when a transaction, which does not belong to a batch, is propagated
+ * @then it reaches the ordering service as a batch of one
+ */
+TEST_F(OrderingGateCoalescingTest, SingleTransactionReachesService) {
+  auto tx = std::make_shared<shared_model::proto::Transaction>(
+      shared_model::proto::TransactionBuilder()
+          .createdTime(iroha::time::now())
+          .creatorAccountId("admin@ru")
+          .addAssetQuantity("coin#coin", "1.0")
+          .quorum(1)
+          .build()
+          .signAndAddSignature(
+              shared_model::crypto::DefaultCryptoAlgorithmType::
+                  generateKeypair())
+          .finish());
+
+  bool received = false;
+  EXPECT_CALL(*notification, onBatchProxy(_))
+      .WillOnce(Invoke([&](const auto &batch) {
+        ASSERT_EQ(1, batch.transactions().size());
+        EXPECT_EQ(tx->hash(), batch.transactions().front()->hash());
+        std::lock_guard<std::mutex> lock(m);
+        received = true;
+        cv.notify_one();
+      }));
+
+  transport->propagateTransaction(tx);
+
+  std::unique_lock<std::mutex> lock(m);
+  ASSERT_TRUE(cv.wait_for(lock, 10s, [&] { return received; }));
+}
+
 class QueueBehaviorTest : public ::testing::Test {
  public:
   QueueBehaviorTest() : ordering_gate(transport, 1, false){};
@@ -358,3 +437,70 @@ TEST_F(QueueBehaviorTest, CommitNewerThanAllProposals) {
   EXPECT_EQ(1, messages.size());
   EXPECT_EQ(2, messages.at(0)->height());
 }
+
+/**
+ * @given Initialized OrderingGate
+ * AND MockPeerCommunicationService
+ * @when two proposals of the same height are received
+ * @then only the first one is passed to the pipeline
+ */
+TEST_F(QueueBehaviorTest, OneProposalPerHeight) {
+  pushProposal(2);
+  pushProposal(2);
+
+  pushCommit(2);
+  pushProposal(3);
+  pushProposal(3);
+
+  ASSERT_EQ(2, messages.size());
+  EXPECT_EQ(2, messages.at(0)->height());
+  EXPECT_EQ(3, messages.at(1)->height());
+}
+
+/**
+ * @given OrderingGate with round timeout and the top block of height 1
+ * @when no proposal of height 2 is received within the timeout
+ * @then the gate passes an empty proposal of height 2, which is created at
+ * the time of the top block plus the timeout
+ * @and the proposal of height 2 received later is discarded
+ */
+TEST(OrderingGateRoundTimeoutTest, EmptyProposalAfterRoundTimeout) {
+  const shared_model::interface::types::TimestampType top_block_time = 1000;
+  const auto round_timeout = 10ms;
+  std::mutex m;
+  std::condition_variable cv;
+  std::vector<std::shared_ptr<shared_model::interface::Proposal>> messages;
+  rxcpp::subjects::subject<Commit> commit_subject;
+  auto pcs = std::make_shared<MockPeerCommunicationService>();
+  EXPECT_CALL(*pcs, on_commit())
+      .WillOnce(Return(commit_subject.get_observable()));
+
+  OrderingGateImpl ordering_gate(std::make_shared<MockOrderingGateTransport>(),
+                                 1,
+                                 false,
+                                 nullptr,
+                                 nullptr,
+                                 round_timeout,
+                                 top_block_time);
+  ordering_gate.on_proposal().subscribe([&](auto proposal) {
+    std::lock_guard<std::mutex> lock(m);
+    messages.push_back(proposal);
+    cv.notify_one();
+  });
+  ordering_gate.setPcs(*pcs);
+
+  {
+    std::unique_lock<std::mutex> lock(m);
+    ASSERT_TRUE(cv.wait_for(lock, 10s, [&] { return not messages.empty(); }));
+    EXPECT_EQ(2, messages.front()->height());
+    EXPECT_EQ(top_block_time + round_timeout.count(),
+              messages.front()->createdTime());
+    EXPECT_TRUE(messages.front()->transactions().empty());
+  }
+
+  ordering_gate.onProposal(std::make_shared<shared_model::proto::Proposal>(
+      TestProposalBuilder().height(2).build()));
+
+  std::lock_guard<std::mutex> lock(m);
+  EXPECT_EQ(1, messages.size());
+}
@@ -0,0 +1,130 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ordering/impl/ordering_peer_rotation.hpp"
+
+#include <gtest/gtest.h>
+
+#include "builders/protobuf/common_objects/proto_peer_builder.hpp"
+#include "module/irohad/ametsuchi/ametsuchi_mocks.hpp"
+
+using namespace iroha::ordering;
+using namespace iroha::ametsuchi;
+
+using ::testing::Return;
+
+class OrderingPeerRotationTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    for (char i = 0; i < 3; ++i) {
+      peers.push_back(makePeer(i));
+    }
+    wsv = std::make_shared<MockPeerQuery>();
+  }
+
+  static OrderingPeerRotation::PeerPtr makePeer(char index) {
+    return clone(shared_model::proto::PeerBuilder()
+                     .address("127.0.0." + std::to_string(index) + ":10001")
+                     .pubkey(shared_model::interface::types::PubkeyType(
+                         std::string(32, 'a' + index)))
+                     .build());
+  }
+
+  std::vector<OrderingPeerRotation::PeerPtr> peers;
+  std::shared_ptr<MockPeerQuery> wsv;
+};
+
+/**
+ * @given rotation of three peers at height 4
+ * @when ordering peers of consecutive heights are requested
+ * @then peers take turns in the ledger order, starting with the one which
+ * creates the next proposal
+ */
+TEST_F(OrderingPeerRotationTest, PeersTakeTurns) {
+  EXPECT_CALL(*wsv, getLedgerPeers()).WillOnce(Return(peers));
+  OrderingPeerRotation rotation(wsv, peers.at(2)->pubkey(), 4);
+
+  EXPECT_EQ(*peers.at(2), **rotation.currentOrderingPeer());
+  EXPECT_EQ(*peers.at(0), **rotation.orderingPeer(6));
+  EXPECT_EQ(*peers.at(1), **rotation.orderingPeer(7));
+  EXPECT_TRUE(rotation.isOrderingPeer(5));
+  EXPECT_FALSE(rotation.isOrderingPeer(6));
+}
+
+/**
+ * @given rotation at height 4
+ * @when blocks are committed, including an old one, and the peers change
+ * @then the round follows the highest committed block and the new peers
+ */
+TEST_F(OrderingPeerRotationTest, CommitMovesRound) {
+  auto new_peers = peers;
+  new_peers.push_back(makePeer(3));
+  EXPECT_CALL(*wsv, getLedgerPeers())
+      .WillOnce(Return(peers))
+      .WillOnce(Return(new_peers))
+      .WillOnce(Return(new_peers));
+  OrderingPeerRotation rotation(wsv, peers.at(0)->pubkey(), 4);
+
+  rotation.onCommit(6);
+  EXPECT_EQ(6, rotation.topHeight());
+  EXPECT_EQ(*new_peers.at(3), **rotation.currentOrderingPeer());
+
+  rotation.onCommit(5);
+  EXPECT_EQ(6, rotation.topHeight());
+}
+
+/**
+ * @given rotation with peers
+ * @when the peer list cannot be fetched on commit
+ * @then the previous list is kept
+ */
+TEST_F(OrderingPeerRotationTest, PeersKeptOnError) {
+  EXPECT_CALL(*wsv, getLedgerPeers())
+      .WillOnce(Return(peers))
+      .WillOnce(Return(boost::none));
+  OrderingPeerRotation rotation(wsv, peers.at(0)->pubkey(), 1);
+
+  rotation.onCommit(2);
+  EXPECT_EQ(*peers.at(0), **rotation.currentOrderingPeer());
+}
+
+/**
+ * @given ledger which returns peers out of the order of public keys
+ * @when ordering peers are requested
+ * @then the schedule is the same as for sorted peers
+ */
+TEST_F(OrderingPeerRotationTest, PeersSortedByKey) {
+  EXPECT_CALL(*wsv, getLedgerPeers())
+      .WillOnce(Return(std::vector<OrderingPeerRotation::PeerPtr>{
+          peers.at(2), peers.at(0), peers.at(1)}));
+  OrderingPeerRotation rotation(wsv, peers.at(0)->pubkey(), 4);
+
+  EXPECT_EQ(*peers.at(0), **rotation.orderingPeer(6));
+  EXPECT_EQ(*peers.at(1), **rotation.orderingPeer(7));
+  EXPECT_EQ(*peers.at(2), **rotation.orderingPeer(8));
+}
+
+/**
+ * @given rotation of three peers at height 4, where the ordering peer of
+ * height 5 is silent
+ * @when the empty block of height 5 is committed after the round timeout
+ * @then the next peer orders height 6, and the late commit of a lower
+ * height does not move the turn back
+ */
+TEST_F(OrderingPeerRotationTest, EmptyBlockMovesToNextPeer) {
+  EXPECT_CALL(*wsv, getLedgerPeers()).WillRepeatedly(Return(peers));
+  OrderingPeerRotation rotation(wsv, peers.at(0)->pubkey(), 4);
+
+  EXPECT_EQ(*peers.at(2), **rotation.currentOrderingPeer());
+  EXPECT_FALSE(rotation.isOrderingPeer(5));
+
+  rotation.onCommit(5);
+  EXPECT_EQ(*peers.at(0), **rotation.currentOrderingPeer());
+  EXPECT_TRUE(rotation.isOrderingPeer(6));
+
+  rotation.onCommit(4);
+  EXPECT_EQ(6, rotation.topHeight() + 1);
+  EXPECT_EQ(*peers.at(0), **rotation.currentOrderingPeer());
+}
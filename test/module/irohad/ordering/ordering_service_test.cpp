@@ -3,6 +3,7 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <boost/range/size.hpp>
 #include <grpc++/grpc++.h>
 
 #include "backend/protobuf/common_objects/peer.hpp"
@@ -12,6 +13,7 @@
 #include "interfaces/iroha_internal/transaction_batch.hpp"
 #include "logger/logger.hpp"
 #include "module/irohad/ametsuchi/ametsuchi_mocks.hpp"
+#include "module/irohad/metrics/metrics_mocks.hpp"
 #include "module/irohad/network/network_mocks.hpp"
 #include "module/irohad/ordering/mock_ordering_service_persistent_state.hpp"
 #include "module/shared_model/builders/protobuf/test_proposal_builder.hpp"
@@ -30,6 +32,7 @@ using ::testing::DoAll;
 using ::testing::Invoke;
 using ::testing::InvokeWithoutArgs;
 using ::testing::Return;
+using ::testing::StrEq;
 
 class MockOrderingServiceTransport : public network::OrderingServiceTransport {
  public:
@@ -48,6 +51,15 @@ class MockOrderingServiceTransport : public network::OrderingServiceTransport {
                void(shared_model::interface::Proposal *proposal,
                     const std::vector<std::string> &peers));
 
+  MOCK_METHOD2(forwardBatch,
+               void(const shared_model::interface::TransactionBatch &batch,
+                    const std::string &peer));
+
+  MOCK_METHOD3(publishQueueState,
+               void(bool overloaded,
+                    size_t size,
+                    const std::vector<std::string> &peers));
+
   std::weak_ptr<network::OrderingServiceNotification> subscriber_;
 };
 
@@ -70,7 +82,8 @@ class OrderingServiceTest : public ::testing::Test {
         shared_model::validation::AlwaysValidValidator>>();
   }
 
-  auto initOs(size_t max_proposal) {
+  auto initOs(size_t max_proposal,
+              std::shared_ptr<DuplicateBatchFilter> duplicate_filter = nullptr) {
     return std::make_shared<OrderingServiceImpl>(
         wsv,
         max_proposal,
@@ -78,7 +91,8 @@ class OrderingServiceTest : public ::testing::Test {
         fake_transport,
         fake_persistent_state,
         std::move(factory),
-        false);
+        false,
+        std::move(duplicate_filter));
   }
 
   void makeProposalTimeout() {
@@ -327,3 +341,498 @@ TEST_F(OrderingServiceTest, BatchesProceed) {
   ordering_service->onBatch(std::move(batch_one));
   ordering_service->onBatch(std::move(batch_two));
 }
+
+/**
+ * @given ordering service with duplicate filter
+ * @when the same batch is received twice before and once after proposal
+ * @then proposal contains the batch only once
+ * @and both copies are counted as rejected duplicates
+ */
+TEST_F(OrderingServiceTest, DuplicateBatchesDropped) {
+  const auto max_proposal = 100;
+  auto duplicate_filter = std::make_shared<DuplicateBatchFilter>(1h);
+  auto batch = framework::batch::createValidBatch(1);
+
+  EXPECT_CALL(*fake_persistent_state, loadProposalHeight())
+      .WillOnce(Return(boost::optional<size_t>(1)));
+  EXPECT_CALL(*fake_persistent_state, saveProposalHeight(_))
+      .WillOnce(Return(true));
+  EXPECT_CALL(*wsv, getLedgerPeers())
+      .WillRepeatedly(Return(std::vector<decltype(peer)>{peer}));
+  EXPECT_CALL(*fake_transport, publishProposalProxy(_, _))
+      .WillOnce(Invoke([](auto proposal, auto) {
+        EXPECT_EQ(1, boost::size(proposal->transactions()));
+      }));
+
+  auto ordering_service = initOs(max_proposal, duplicate_filter);
+  fake_transport->subscribe(ordering_service);
+
+  auto copy = batch;
+  ordering_service->onBatch(std::move(copy));
+  copy = batch;
+  ordering_service->onBatch(std::move(copy));
+  makeProposalTimeout();
+
+  copy = batch;
+  ordering_service->onBatch(std::move(copy));
+  makeProposalTimeout();
+
+  EXPECT_EQ(2, duplicate_filter->rejectedCount());
+}
+
+/**
+ * @given ordering service with duplicate filter and a queued batch
+ * @when a copy of the batch with one more signature is received
+ * @then proposal contains only the copy with more signatures
+ */
+TEST_F(OrderingServiceTest, BatchWithMoreSignaturesSupersedes) {
+  using namespace shared_model::validation;
+  using TxsValidator = UnsignedTransactionsCollectionValidator<
+      TransactionValidator<FieldValidator,
+                           CommandValidatorVisitor<FieldValidator>>,
+      BatchOrderValidator>;
+
+  const auto max_proposal = 100;
+  auto duplicate_filter = std::make_shared<DuplicateBatchFilter>(1h);
+  auto batch = framework::batch::createValidBatch(1);
+
+  auto txs = batch.transactions();
+  txs.front() = clone(*txs.front());
+  txs.front()->addSignature(
+      shared_model::crypto::Signed(std::string(64, '1')),
+      shared_model::crypto::PublicKey(std::string(32, '1')));
+  auto more_signed = framework::expected::val(
+                         shared_model::interface::TransactionBatch::
+                             createTransactionBatch(txs, TxsValidator()))
+                         .value()
+                         .value;
+
+  EXPECT_CALL(*fake_persistent_state, loadProposalHeight())
+      .WillOnce(Return(boost::optional<size_t>(1)));
+  EXPECT_CALL(*fake_persistent_state, saveProposalHeight(_))
+      .WillOnce(Return(true));
+  EXPECT_CALL(*wsv, getLedgerPeers())
+      .WillRepeatedly(Return(std::vector<decltype(peer)>{peer}));
+  EXPECT_CALL(*fake_transport, publishProposalProxy(_, _))
+      .WillOnce(Invoke([](auto proposal, auto) {
+        ASSERT_EQ(1, boost::size(proposal->transactions()));
+        const auto &tx = proposal->transactions().front();
+        EXPECT_EQ(2, boost::size(tx.signatures()));
+      }));
+
+  auto ordering_service = initOs(max_proposal, duplicate_filter);
+  fake_transport->subscribe(ordering_service);
+
+  ordering_service->onBatch(std::move(batch));
+  ordering_service->onBatch(std::move(more_signed));
+  makeProposalTimeout();
+
+  EXPECT_EQ(0, duplicate_filter->rejectedCount());
+}
+
+/**
+ * @given ordering service which cuts proposals in a separate thread
+ * @when number of received transactions reaches proposal size without timer
+ * events
+ * @then proposal is published
+ */
+TEST_F(OrderingServiceTest, AsyncProposalOnSize) {
+  const auto max_proposal = 5;
+
+  EXPECT_CALL(*fake_persistent_state, loadProposalHeight())
+      .WillOnce(Return(boost::optional<size_t>(1)));
+  EXPECT_CALL(*fake_persistent_state, saveProposalHeight(_))
+      .WillOnce(Return(true));
+  EXPECT_CALL(*wsv, getLedgerPeers())
+      .WillRepeatedly(Return(std::vector<decltype(peer)>{peer}));
+
+  bool published = false;
+  EXPECT_CALL(*fake_transport, publishProposalProxy(_, _))
+      .WillOnce(Invoke([&](auto proposal, auto) {
+        EXPECT_EQ(max_proposal, boost::size(proposal->transactions()));
+        std::lock_guard<std::mutex> lock(m);
+        published = true;
+        cv.notify_one();
+      }));
+
+  auto ordering_service =
+      std::make_shared<OrderingServiceImpl>(wsv,
+                                            max_proposal,
+                                            proposal_timeout.get_observable(),
+                                            fake_transport,
+                                            fake_persistent_state,
+                                            std::move(factory),
+                                            true);
+
+  for (size_t i = 0; i < max_proposal; ++i) {
+    ordering_service->onBatch(framework::batch::createValidBatch(1));
+  }
+
+  std::unique_lock<std::mutex> lock(m);
+  ASSERT_TRUE(cv.wait_for(lock, 5s, [&] { return published; }));
+}
+
+/**
+ * @given ordering service with byte limit of two and a half transactions
+ * @when four transactions are received and timer is triggered
+ * @then two proposals of two transactions are published: the third
+ * transaction does not fit the first one
+ */
+TEST_F(OrderingServiceTest, ProposalByteLimit) {
+  const auto max_proposal = 100;
+  std::vector<shared_model::interface::TransactionBatch> batches;
+  for (int i = 0; i < 4; ++i) {
+    batches.push_back(framework::batch::createValidBatch(1));
+  }
+  auto tx_bytes = batches.front().transactions().front()->blob().size();
+
+  EXPECT_CALL(*fake_persistent_state, loadProposalHeight())
+      .WillOnce(Return(boost::optional<size_t>(1)));
+  EXPECT_CALL(*fake_persistent_state, saveProposalHeight(_))
+      .Times(2)
+      .WillRepeatedly(Return(true));
+  EXPECT_CALL(*wsv, getLedgerPeers())
+      .WillRepeatedly(Return(std::vector<decltype(peer)>{peer}));
+  EXPECT_CALL(*fake_transport, publishProposalProxy(_, _))
+      .Times(2)
+      .WillRepeatedly(Invoke([](auto proposal, auto) {
+        EXPECT_EQ(2, boost::size(proposal->transactions()));
+      }));
+
+  auto ordering_service =
+      std::make_shared<OrderingServiceImpl>(wsv,
+                                            max_proposal,
+                                            proposal_timeout.get_observable(),
+                                            fake_transport,
+                                            fake_persistent_state,
+                                            std::move(factory),
+                                            false,
+                                            nullptr,
+                                            tx_bytes * 5 / 2);
+  fake_transport->subscribe(ordering_service);
+
+  for (auto &batch : batches) {
+    ordering_service->onBatch(std::move(batch));
+  }
+  makeProposalTimeout();
+}
+
+/**
+ * @given ordering service with rotation of two peers, where this peer orders
+ * even heights and the ledger is at height 2
+ * @when batches are received and timer is triggered
+ * @then they are forwarded to the other peer and no proposal is published
+ */
+TEST_F(OrderingServiceTest, RotationForwardsOutOfTurn) {
+  auto other = clone(shared_model::proto::PeerBuilder()
+                         .address("127.0.0.1:50051")
+                         .pubkey(shared_model::interface::types::PubkeyType(
+                             std::string(32, '1')))
+                         .build());
+  EXPECT_CALL(*wsv, getLedgerPeers())
+      .WillRepeatedly(Return(std::vector<decltype(peer)>{peer, other}));
+  EXPECT_CALL(*fake_persistent_state, loadProposalHeight()).Times(0);
+  EXPECT_CALL(*fake_transport, publishProposalProxy(_, _)).Times(0);
+  EXPECT_CALL(*fake_transport, forwardBatch(_, other->address())).Times(2);
+
+  auto rotation =
+      std::make_shared<OrderingPeerRotation>(wsv, peer->pubkey(), 2);
+  auto ordering_service =
+      std::make_shared<OrderingServiceImpl>(wsv,
+                                            10,
+                                            proposal_timeout.get_observable(),
+                                            fake_transport,
+                                            fake_persistent_state,
+                                            std::move(factory),
+                                            false,
+                                            nullptr,
+                                            std::numeric_limits<size_t>::max(),
+                                            nullptr,
+                                            rotation);
+
+  ordering_service->onBatch(framework::batch::createValidBatch(1));
+  ordering_service->onBatch(framework::batch::createValidBatch(2));
+  makeProposalTimeout();
+}
+
+/**
+ * @given ordering service with rotation of two peers, where this peer orders
+ * even heights and the ledger is at height 1
+ * @when proposal is created, more batches are received and the ledger
+ * reaches height 2
+ * @then proposal of height 2 is published, the batches wait until the round
+ * ends and then are forwarded to the ordering peer of height 3
+ */
+TEST_F(OrderingServiceTest, RotationProposesOncePerOwnRound) {
+  auto other = clone(shared_model::proto::PeerBuilder()
+                         .address("127.0.0.1:50051")
+                         .pubkey(shared_model::interface::types::PubkeyType(
+                             std::string(32, '1')))
+                         .build());
+  EXPECT_CALL(*wsv, getLedgerPeers())
+      .WillRepeatedly(Return(std::vector<decltype(peer)>{peer, other}));
+  EXPECT_CALL(*fake_persistent_state, saveProposalHeight(_)).Times(0);
+  EXPECT_CALL(*fake_transport, forwardBatch(_, _)).Times(0);
+  EXPECT_CALL(*fake_transport, publishProposalProxy(_, _))
+      .WillOnce(Invoke([](auto proposal, auto) {
+        EXPECT_EQ(2, proposal->height());
+        EXPECT_EQ(1, boost::size(proposal->transactions()));
+      }));
+
+  auto rotation =
+      std::make_shared<OrderingPeerRotation>(wsv, peer->pubkey(), 1);
+  auto ordering_service =
+      std::make_shared<OrderingServiceImpl>(wsv,
+                                            10,
+                                            proposal_timeout.get_observable(),
+                                            fake_transport,
+                                            fake_persistent_state,
+                                            std::move(factory),
+                                            false,
+                                            nullptr,
+                                            std::numeric_limits<size_t>::max(),
+                                            nullptr,
+                                            rotation);
+
+  ordering_service->onBatch(framework::batch::createValidBatch(1));
+  makeProposalTimeout();
+
+  ordering_service->onBatch(framework::batch::createValidBatch(1));
+  makeProposalTimeout();
+
+  rotation->onCommit(2);
+  EXPECT_CALL(*fake_transport, forwardBatch(_, other->address()));
+  makeProposalTimeout();
+}
+
+/**
+ * @given ordering service with rotation of two peers, where the other peer
+ * orders height 3 and the ledger is at height 2
+ * @when the other peer is silent, and the empty block of height 3 is
+ * committed after the round timeout
+ * @then this peer creates proposal of height 4 from the batches received
+ * after the forward, and only once per height
+ */
+TEST_F(OrderingServiceTest, RotationProposesAfterEmptyBlockOfSilentPeer) {
+  auto other = clone(shared_model::proto::PeerBuilder()
+                         .address("127.0.0.1:50051")
+                         .pubkey(shared_model::interface::types::PubkeyType(
+                             std::string(32, '1')))
+                         .build());
+  EXPECT_CALL(*wsv, getLedgerPeers())
+      .WillRepeatedly(Return(std::vector<decltype(peer)>{peer, other}));
+  EXPECT_CALL(*fake_transport, forwardBatch(_, other->address())).Times(1);
+  EXPECT_CALL(*fake_transport, publishProposalProxy(_, _))
+      .WillOnce(Invoke([](auto proposal, auto) {
+        EXPECT_EQ(4, proposal->height());
+        EXPECT_EQ(1, boost::size(proposal->transactions()));
+      }));
+
+  auto rotation =
+      std::make_shared<OrderingPeerRotation>(wsv, peer->pubkey(), 2);
+  auto ordering_service =
+      std::make_shared<OrderingServiceImpl>(wsv,
+                                            10,
+                                            proposal_timeout.get_observable(),
+                                            fake_transport,
+                                            fake_persistent_state,
+                                            std::move(factory),
+                                            false,
+                                            nullptr,
+                                            std::numeric_limits<size_t>::max(),
+                                            nullptr,
+                                            rotation);
+
+  ordering_service->onBatch(framework::batch::createValidBatch(1));
+  makeProposalTimeout();
+
+  rotation->onCommit(3);
+  ordering_service->onBatch(framework::batch::createValidBatch(1));
+  makeProposalTimeout();
+
+  ordering_service->onBatch(framework::batch::createValidBatch(1));
+  makeProposalTimeout();
+}
+
+/**
+ * @given ordering service with high-water mark of three transactions
+ * @when four batches are received and timer is triggered
+ * @then overload is reported when the queue reaches the mark
+ * @and the fourth batch is rejected
+ * @and end of overload is reported when the proposal is created
+ */
+TEST_F(OrderingServiceTest, HighWaterMarkRejectsBatches) {
+  const auto max_proposal = 100;
+  const auto high_water_mark = 3;
+
+  EXPECT_CALL(*fake_persistent_state, loadProposalHeight())
+      .WillOnce(Return(boost::optional<size_t>(1)));
+  EXPECT_CALL(*fake_persistent_state, saveProposalHeight(_))
+      .WillOnce(Return(true));
+  EXPECT_CALL(*wsv, getLedgerPeers())
+      .WillRepeatedly(Return(std::vector<decltype(peer)>{peer}));
+  ::testing::InSequence sequence;
+  EXPECT_CALL(*fake_transport, publishQueueState(true, high_water_mark, _));
+  EXPECT_CALL(*fake_transport, publishQueueState(false, 0, _));
+  EXPECT_CALL(*fake_transport, publishProposalProxy(_, _))
+      .WillOnce(Invoke([&](auto proposal, auto) {
+        EXPECT_EQ(high_water_mark, boost::size(proposal->transactions()));
+      }));
+
+  auto ordering_service =
+      std::make_shared<OrderingServiceImpl>(wsv,
+                                            max_proposal,
+                                            proposal_timeout.get_observable(),
+                                            fake_transport,
+                                            fake_persistent_state,
+                                            std::move(factory),
+                                            false,
+                                            nullptr,
+                                            std::numeric_limits<size_t>::max(),
+                                            nullptr,
+                                            nullptr,
+                                            high_water_mark);
+
+  for (int i = 0; i < high_water_mark + 1; ++i) {
+    ordering_service->onBatch(framework::batch::createValidBatch(1));
+  }
+  makeProposalTimeout();
+}
+
+/**
+ * @given ordering service with high-water mark of two transactions and
+ * duplicate filter
+ * @when a batch of two transactions is received while the queue has one
+ * @then the batch is rejected and counted as dropped
+ * @and the batch is accepted when it is sent again after the proposal
+ */
+TEST_F(OrderingServiceTest, DroppedBatchIsReportedAndForgotten) {
+  const auto max_proposal = 100;
+  const auto high_water_mark = 2;
+  auto duplicate_filter = std::make_shared<DuplicateBatchFilter>(1h);
+  auto sink = std::make_shared<iroha::metrics::MockMetricsSink>();
+  auto dropped = framework::batch::createValidBatch(2);
+
+  EXPECT_CALL(*fake_persistent_state, loadProposalHeight())
+      .WillOnce(Return(boost::optional<size_t>(1)));
+  EXPECT_CALL(*fake_persistent_state, saveProposalHeight(_))
+      .Times(2)
+      .WillRepeatedly(Return(true));
+  EXPECT_CALL(*wsv, getLedgerPeers())
+      .WillRepeatedly(Return(std::vector<decltype(peer)>{peer}));
+  EXPECT_CALL(*fake_transport, publishQueueState(_, _, _)).Times(AtLeast(1));
+  EXPECT_CALL(*sink, onCounter(StrEq(OrderingServiceImpl::kDroppedCounter), 1));
+  EXPECT_CALL(*fake_transport, publishProposalProxy(_, _))
+      .WillOnce(Invoke([](auto proposal, auto) {
+        EXPECT_EQ(1, boost::size(proposal->transactions()));
+      }))
+      .WillOnce(Invoke([](auto proposal, auto) {
+        EXPECT_EQ(2, boost::size(proposal->transactions()));
+      }));
+
+  auto ordering_service =
+      std::make_shared<OrderingServiceImpl>(wsv,
+                                            max_proposal,
+                                            proposal_timeout.get_observable(),
+                                            fake_transport,
+                                            fake_persistent_state,
+                                            std::move(factory),
+                                            false,
+                                            duplicate_filter,
+                                            std::numeric_limits<size_t>::max(),
+                                            nullptr,
+                                            nullptr,
+                                            high_water_mark,
+                                            sink);
+
+  ordering_service->onBatch(framework::batch::createValidBatch(1));
+  auto copy = dropped;
+  ordering_service->onBatch(std::move(copy));
+  makeProposalTimeout();
+
+  ordering_service->onBatch(std::move(dropped));
+  makeProposalTimeout();
+
+  EXPECT_EQ(0, duplicate_filter->rejectedCount());
+}
+
+/**
+ * @given ordering service with proposals of one transaction and without
+ * configured queue limit
+ * @when more batches are received than 16 proposals hold
+ * @then none of them is rejected and the queue is not reported overloaded
+ */
+TEST_F(OrderingServiceTest, DefaultQueueLimitIsNotTiedToProposalSize) {
+  const auto max_proposal = 1;
+  auto sink = std::make_shared<iroha::metrics::MockMetricsSink>();
+
+  EXPECT_CALL(*fake_persistent_state, loadProposalHeight())
+      .WillOnce(Return(boost::optional<size_t>(1)));
+  EXPECT_CALL(*fake_transport, publishQueueState(_, _, _)).Times(0);
+  EXPECT_CALL(*sink, onCounter(_, _)).Times(0);
+
+  auto ordering_service =
+      std::make_shared<OrderingServiceImpl>(wsv,
+                                            max_proposal,
+                                            proposal_timeout.get_observable(),
+                                            fake_transport,
+                                            fake_persistent_state,
+                                            std::move(factory),
+                                            false,
+                                            nullptr,
+                                            std::numeric_limits<size_t>::max(),
+                                            nullptr,
+                                            nullptr,
+                                            boost::none,
+                                            sink);
+
+  for (auto i = 0; i < 100; ++i) {
+    ordering_service->onBatch(framework::batch::createValidBatch(1));
+  }
+}
+
+/**
+ * @given ordering service which cuts proposals in a separate thread, with
+ * high-water mark of one transaction
+ * @when the queue reaches the mark
+ * @then overload is published by the cutting thread, not by the thread which
+ * has passed the batch
+ */
+TEST_F(OrderingServiceTest, AsyncQueueStatePublishedByCutter) {
+  const auto max_proposal = 100;
+  const auto high_water_mark = 1;
+
+  EXPECT_CALL(*fake_persistent_state, loadProposalHeight())
+      .WillOnce(Return(boost::optional<size_t>(1)));
+  EXPECT_CALL(*wsv, getLedgerPeers())
+      .WillRepeatedly(Return(std::vector<decltype(peer)>{peer}));
+
+  auto caller = std::this_thread::get_id();
+  bool published = false;
+  EXPECT_CALL(*fake_transport, publishQueueState(true, high_water_mark, _))
+      .WillOnce(InvokeWithoutArgs([&] {
+        EXPECT_NE(caller, std::this_thread::get_id());
+        std::lock_guard<std::mutex> lock(m);
+        published = true;
+        cv.notify_one();
+      }));
+
+  auto ordering_service =
+      std::make_shared<OrderingServiceImpl>(wsv,
+                                            max_proposal,
+                                            proposal_timeout.get_observable(),
+                                            fake_transport,
+                                            fake_persistent_state,
+                                            std::move(factory),
+                                            true,
+                                            nullptr,
+                                            std::numeric_limits<size_t>::max(),
+                                            nullptr,
+                                            nullptr,
+                                            high_water_mark);
+
+  ordering_service->onBatch(framework::batch::createValidBatch(1));
+
+  std::unique_lock<std::mutex> lock(m);
+  ASSERT_TRUE(cv.wait_for(lock, 5s, [&] { return published; }));
+}
@@ -17,6 +17,8 @@
 
 #include <vector>
 
+#include "backend/protobuf/block.hpp"
+#include "backend/protobuf/proto_proposal_factory.hpp"
 #include "backend/protobuf/transaction.hpp"
 #include "builders/protobuf/proposal.hpp"
 #include "builders/protobuf/transaction.hpp"
@@ -28,7 +30,9 @@
 #include "module/shared_model/builders/protobuf/test_block_builder.hpp"
 #include "module/shared_model/builders/protobuf/test_proposal_builder.hpp"
 #include "module/shared_model/cryptography/crypto_model_signer_mock.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
 #include "simulator/impl/simulator.hpp"
+#include "validators/default_validator.hpp"
 
 using namespace iroha;
 using namespace iroha::validation;
@@ -39,6 +43,7 @@ using namespace framework::test_subscriber;
 
 using ::testing::_;
 using ::testing::A;
+using ::testing::Invoke;
 using ::testing::Return;
 using ::testing::ReturnArg;
 
@@ -62,9 +67,14 @@ class SimulatorTest : public ::testing::Test {
     shared_model::crypto::crypto_signer_expecter.reset();
   }
 
-  void init() {
-    simulator = std::make_shared<Simulator>(
-        ordering_gate, validator, factory, query, crypto_signer);
+  void init(bool prepare_blocks = false) {
+    simulator = std::make_shared<Simulator>(ordering_gate,
+                                            validator,
+                                            factory,
+                                            query,
+                                            crypto_signer,
+                                            nullptr,
+                                            prepare_blocks);
   }
 
   std::shared_ptr<MockStatefulValidator> validator;
@@ -76,6 +86,40 @@ class SimulatorTest : public ::testing::Test {
   std::shared_ptr<Simulator> simulator;
 };
 
+/**
+ * Expect one round of the simulator on top of the block, in which the
+ * validator verifies the given proposal, and the given number of blocks is
+ * signed
+ */
+void expectRound(SimulatorTest &test,
+                 const shared_model::proto::Block &top_block,
+                 std::shared_ptr<shared_model::interface::Proposal> verified,
+                 int signed_blocks = 1) {
+  EXPECT_CALL(*test.factory, createTemporaryWsv()).Times(1);
+  EXPECT_CALL(*test.query, getTopBlock())
+      .WillOnce(Return(expected::makeValue(wBlock(clone(top_block)))));
+  EXPECT_CALL(*test.validator, validate(_, _))
+      .WillOnce(Return(std::make_pair(
+          std::move(verified), iroha::validation::TransactionsErrors{})));
+  EXPECT_CALL(*test.ordering_gate, on_proposal())
+      .WillOnce(Return(rxcpp::observable<>::empty<
+                       std::shared_ptr<shared_model::interface::Proposal>>()));
+  EXPECT_CALL(*shared_model::crypto::crypto_signer_expecter,
+              sign(A<shared_model::interface::Block &>()))
+      .Times(signed_blocks);
+}
+
+/**
+ * @return block of the simulator
+ */
+std::shared_ptr<shared_model::interface::Block> getBlock(
+    const shared_model::interface::BlockVariant &block_variant) {
+  return boost::apply_visitor(
+      framework::SpecifiedVisitor<
+          std::shared_ptr<shared_model::interface::Block>>(),
+      block_variant);
+}
+
 shared_model::proto::Block makeBlock(int height) {
   return TestBlockBuilder()
       .transactions(std::vector<shared_model::proto::Transaction>())
@@ -138,8 +182,6 @@ TEST_F(SimulatorTest, ValidWhenPreviousBlock) {
   EXPECT_CALL(*query, getTopBlock())
       .WillOnce(Return(expected::makeValue(wBlock(clone(block)))));
 
-  EXPECT_CALL(*query, getTopBlockHeight()).WillOnce(Return(1));
-
   EXPECT_CALL(*validator, validate(_, _))
       .WillOnce(Return(
           std::make_pair(proposal, iroha::validation::TransactionsErrors{})));
@@ -299,8 +341,6 @@ TEST_F(SimulatorTest, RightNumberOfFailedTxs) {
   EXPECT_CALL(*query, getTopBlock())
       .WillOnce(Return(expected::makeValue(wBlock(clone(block)))));
 
-  EXPECT_CALL(*query, getTopBlockHeight()).WillOnce(Return(2));
-
   EXPECT_CALL(*validator, validate(_, _))
       .WillOnce(Return(std::make_pair(verified_proposal, tx_errors)));
 
@@ -329,3 +369,162 @@ TEST_F(SimulatorTest, RightNumberOfFailedTxs) {
 
   ASSERT_TRUE(proposal_wrapper.validate());
 }
+
+/**
+ * @given simulator which prepares blocks
+ * @when proposal is validated and block is created from it
+ * @then state of the validation is passed to the storage together with hashes
+ * of the created block and the block it is built upon
+ */
+TEST_F(SimulatorTest, PreparesBlockFromValidatedState) {
+  auto proposal =
+      std::make_shared<shared_model::proto::Proposal>(makeProposal(2));
+  shared_model::proto::Block block = makeBlock(proposal->height() - 1);
+
+  EXPECT_CALL(*factory, createTemporaryWsv()).WillOnce(Invoke([] {
+    return expected::Result<std::unique_ptr<TemporaryWsv>, std::string>(
+        expected::makeValue<std::unique_ptr<TemporaryWsv>>(
+            std::make_unique<MockTemporaryWsv>()));
+  }));
+  EXPECT_CALL(*query, getTopBlock())
+      .WillOnce(Return(expected::makeValue(wBlock(clone(block)))));
+  EXPECT_CALL(*validator, validate(_, _))
+      .WillOnce(Return(
+          std::make_pair(proposal, iroha::validation::TransactionsErrors{})));
+  EXPECT_CALL(*ordering_gate, on_proposal())
+      .WillOnce(Return(rxcpp::observable<>::empty<
+                       std::shared_ptr<shared_model::interface::Proposal>>()));
+  EXPECT_CALL(*shared_model::crypto::crypto_signer_expecter,
+              sign(A<shared_model::interface::Block &>()))
+      .Times(1);
+
+  boost::optional<shared_model::crypto::Hash> prepared_hash;
+  EXPECT_CALL(*factory, prepareBlock_(_, _, block.hash()))
+      .WillOnce(Invoke([&prepared_hash](auto &wsv, auto &block_hash, auto &) {
+        ASSERT_TRUE(wsv);
+        prepared_hash = block_hash;
+      }));
+
+  init(true);
+
+  auto block_wrapper =
+      make_test_subscriber<CallExact>(simulator->on_block(), 1);
+  block_wrapper.subscribe([&prepared_hash](const auto &block_variant) {
+    ASSERT_TRUE(prepared_hash);
+    ASSERT_EQ(block_variant.hash(), *prepared_hash);
+  });
+
+  simulator->process_proposal(*proposal);
+
+  ASSERT_TRUE(block_wrapper.validate());
+}
+
+/**
+ * @given verified proposal allocated in an arena
+ * @when block is created from it
+ * @then the block shares the arena, transports and hashes of transactions with
+ * the proposal
+ */
+TEST_F(SimulatorTest, BlockSharesTransportsOfVerifiedProposal) {
+  auto proposal = makeProposal(2);
+  std::shared_ptr<shared_model::interface::Proposal> verified =
+      shared_model::proto::ProtoProposalFactory<
+          shared_model::validation::DefaultProposalValidator>()
+          .unsafeCreateProposal(proposal.height(),
+                                proposal.createdTime(),
+                                proposal.transactions());
+  expectRound(*this, makeBlock(proposal.height() - 1), verified);
+
+  init();
+
+  auto block_wrapper =
+      make_test_subscriber<CallExact>(simulator->on_block(), 1);
+  block_wrapper.subscribe([&verified](const auto &block_variant) {
+    auto block_ptr = getBlock(block_variant);
+    const auto &block =
+        static_cast<const shared_model::proto::Block &>(*block_ptr);
+    const auto &proto_verified =
+        static_cast<const shared_model::proto::Proposal &>(*verified);
+    ASSERT_EQ(block.getArena(), proto_verified.getArena());
+    ASSERT_EQ(block.getTransport().payload().transactions_size(),
+              proto_verified.getTransport().transactions_size());
+    for (int i = 0; i < proto_verified.getTransport().transactions_size();
+         ++i) {
+      EXPECT_EQ(&block.getTransport().payload().transactions(i),
+                &proto_verified.getTransport().transactions(i));
+      EXPECT_EQ(std::next(block.transactions().begin(), i)->hash(),
+                std::next(verified->transactions().begin(), i)->hash());
+    }
+  });
+
+  simulator->process_proposal(proposal);
+
+  ASSERT_TRUE(block_wrapper.validate());
+}
+
+/**
+ * @given verified proposal allocated on the heap
+ * @when block is created from it
+ * @then the block has copies of the transactions and passes block validation
+ */
+TEST_F(SimulatorTest, HeapProposalMakesBlock) {
+  auto proposal =
+      std::make_shared<shared_model::proto::Proposal>(makeProposal(2));
+  auto top_block = makeBlock(proposal->height() - 1);
+  expectRound(*this, top_block, proposal);
+
+  init();
+
+  auto block_wrapper =
+      make_test_subscriber<CallExact>(simulator->on_block(), 1);
+  block_wrapper.subscribe([&](const auto &block_variant) {
+    auto block = getBlock(block_variant);
+    EXPECT_EQ(block->transactions(), proposal->transactions());
+    EXPECT_EQ(block->height(), proposal->height());
+    EXPECT_EQ(block->prevHash(), top_block.hash());
+    EXPECT_EQ(block->createdTime(), proposal->createdTime());
+    EXPECT_EQ(block->txsNumber(), boost::size(proposal->transactions()));
+    auto answer =
+        shared_model::validation::DefaultUnsignedBlockValidator().validate(
+            *block);
+    EXPECT_FALSE(answer.hasErrors()) << answer.reason();
+  });
+
+  simulator->process_proposal(*proposal);
+
+  ASSERT_TRUE(block_wrapper.validate());
+}
+
+/**
+ * @given verified proposal with a transaction, which is too old for the block
+ * validator
+ * @when block is created from it
+ * @then the block is neither signed nor sent
+ */
+TEST_F(SimulatorTest, InvalidBlockIsNotSent) {
+  auto old_time = iroha::time::now()
+      - 2 * shared_model::validation::FieldValidator::kMaxDelay;
+  auto tx = TestTransactionBuilder()
+                .createdTime(old_time)
+                .creatorAccountId("admin@ru")
+                .addAssetQuantity("coin#coin", "1.0")
+                .quorum(1)
+                .build();
+  auto proposal = std::make_shared<shared_model::proto::Proposal>(
+      TestProposalBuilder()
+          .height(2)
+          .createdTime(iroha::time::now())
+          .transactions(std::vector<shared_model::proto::Transaction>{tx})
+          .build());
+  expectRound(*this, makeBlock(proposal->height() - 1), proposal, 0);
+
+  init();
+
+  auto block_wrapper =
+      make_test_subscriber<CallExact>(simulator->on_block(), 0);
+  block_wrapper.subscribe();
+
+  simulator->process_proposal(*proposal);
+
+  ASSERT_TRUE(block_wrapper.validate());
+}
@@ -102,6 +102,7 @@ class ToriiServiceTest : public testing::Test {
     wsv_query = std::make_shared<MockWsvQuery>();
     block_query = std::make_shared<MockBlockQuery>();
     storage = std::make_shared<MockStorage>();
+    ordering_load = std::make_shared<iroha::network::OrderingLoad>();
 
     EXPECT_CALL(*mst, onPreparedTransactionsImpl())
         .WillRepeatedly(Return(mst_prepared_notifier.get_observable()));
@@ -123,7 +124,8 @@ class ToriiServiceTest : public testing::Test {
                                                          storage,
                                                          status_bus,
                                                          initial_timeout,
-                                                         nonfinal_timeout))
+                                                         nonfinal_timeout,
+                                                         ordering_load))
         .run()
         .match(
             [this](iroha::expected::Value<int> port) {
@@ -141,6 +143,7 @@ class ToriiServiceTest : public testing::Test {
   std::shared_ptr<MockWsvQuery> wsv_query;
   std::shared_ptr<MockBlockQuery> block_query;
   std::shared_ptr<MockStorage> storage;
+  std::shared_ptr<iroha::network::OrderingLoad> ordering_load;
 
   rxcpp::subjects::subject<std::shared_ptr<shared_model::interface::Proposal>>
       prop_notifier_;
@@ -597,3 +600,58 @@ TEST_F(ToriiServiceTest, FailedListOfTxs) {
         ASSERT_EQ(error_beginning, error_msg_beginning);
       });
 }
+
+/**
+ * @given torii service and overloaded ordering service
+ * @when transaction is sent before and after the overload ends
+ * @then its status is OVERLOADED first, and the second attempt passes
+ * stateless validation
+ */
+TEST_F(ToriiServiceTest, RejectedWhileOrderingOverloaded) {
+  auto tx = TestTransactionBuilder().creatorAccountId("a@domain").build();
+  iroha::protocol::TxStatusRequest tx_request;
+  tx_request.set_tx_hash(shared_model::crypto::toBinaryString(tx.hash()));
+  iroha::protocol::ToriiResponse torii_response;
+  auto client = torii::CommandSyncClient(ip, port);
+
+  ordering_load->update(true);
+  ASSERT_TRUE(client.Torii(tx.getTransport()).ok());
+  client.Status(tx_request, torii_response);
+  ASSERT_EQ(torii_response.tx_status(), iroha::protocol::TxStatus::OVERLOADED);
+
+  ordering_load->update(false);
+  ASSERT_TRUE(client.Torii(tx.getTransport()).ok());
+  client.Status(tx_request, torii_response);
+  ASSERT_EQ(torii_response.tx_status(),
+            iroha::protocol::TxStatus::STATELESS_VALIDATION_SUCCESS);
+}
+
+/**
+ * @given torii service and a transaction which has passed stateless
+ * validation
+ * @when the transaction is sent again, as a single one and in a list, while
+ * the ordering service is overloaded
+ * @then its status is not replaced with OVERLOADED
+ */
+TEST_F(ToriiServiceTest, OverloadKeepsKnownStatus) {
+  auto tx = TestTransactionBuilder()
+                .creatorAccountId("a@domain")
+                .quorum(2)
+                .build();
+  iroha::protocol::TxStatusRequest tx_request;
+  tx_request.set_tx_hash(shared_model::crypto::toBinaryString(tx.hash()));
+  iroha::protocol::ToriiResponse torii_response;
+  auto client = torii::CommandSyncClient(ip, port);
+
+  ASSERT_TRUE(client.Torii(tx.getTransport()).ok());
+
+  ordering_load->update(true);
+  ASSERT_TRUE(client.Torii(tx.getTransport()).ok());
+  iroha::protocol::TxList tx_list;
+  *tx_list.add_transactions() = tx.getTransport();
+  ASSERT_TRUE(client.ListTorii(tx_list).ok());
+
+  client.Status(tx_request, torii_response);
+  ASSERT_EQ(torii_response.tx_status(),
+            iroha::protocol::TxStatus::STATELESS_VALIDATION_SUCCESS);
+}
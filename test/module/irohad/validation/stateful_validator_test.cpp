@@ -15,6 +15,7 @@
 #include "module/shared_model/builders/protobuf/test_proposal_builder.hpp"
 #include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
 #include "module/shared_model/interface_mocks.hpp"
+#include "validation/impl/conflict_groups.hpp"
 #include "validation/impl/stateful_validator_impl.hpp"
 #include "validation/stateful_validator.hpp"
 #include "validation/utils.hpp"
@@ -28,6 +29,7 @@ using ::testing::A;
 using ::testing::ByMove;
 using ::testing::ByRef;
 using ::testing::Eq;
+using ::testing::Invoke;
 using ::testing::Return;
 using ::testing::ReturnArg;
 
@@ -273,3 +275,106 @@ TEST_F(Validator, Batches) {
   ASSERT_EQ(verified_proposal_and_errors.first->transactions().size(), 5);
   ASSERT_EQ(verified_proposal_and_errors.second.size(), 1);
 }
+
+/**
+ * @given validation units, some of which access common keys directly or
+ * through other units
+ * @when splitting them into conflict groups
+ * @then units with common keys are in the same group in their order @and
+ * groups are ordered by their first units
+ */
+TEST(ConflictGroupsTest, GroupsUnitsWithCommonKeys) {
+  auto groups = conflictGroups({{"account:a", "asset:coin"},
+                                {"account:b"},
+                                {"account:c", "account:d"},
+                                {"account:d", "asset:coin"},
+                                {"account:e"},
+                                {"account:b"}});
+  std::vector<std::vector<size_t>> expected{{0, 2, 3}, {1, 5}, {4}};
+  ASSERT_EQ(groups, expected);
+}
+
+/**
+ * @given transfer transaction created by a third account
+ * @when getting keys accessed by it
+ * @then keys contain creator, source and destination accounts and the asset
+ */
+TEST(ConflictGroupsTest, TransferKeys) {
+  auto tx = TestTransactionBuilder()
+                .creatorAccountId("admin@test")
+                .createdTime(iroha::time::now())
+                .quorum(1)
+                .transferAsset("alice@test", "bob@test", "coin#test", "", "1.0")
+                .build();
+  auto keys = accessedStateKeys(tx);
+  std::sort(keys.begin(), keys.end());
+  std::vector<std::string> expected{"account:admin@test",
+                                    "account:alice@test",
+                                    "account:bob@test",
+                                    "asset:coin#test"};
+  ASSERT_EQ(keys, expected);
+}
+
+/**
+ * @given validator with several threads @and transactions, some of which
+ * transfer assets between the same accounts
+ * @when one of independent transactions fails
+ * @then verified proposal has the valid transactions in the order of the
+ * proposal @and only the failed transaction is in errors, as it would be
+ * after sequential validation
+ */
+TEST_F(Validator, ParallelValidationKeepsOrder) {
+  auto transfer = [](const std::string &src, const std::string &dest) {
+    return TestTransactionBuilder()
+        .creatorAccountId(src)
+        .createdTime(iroha::time::now())
+        .quorum(1)
+        .transferAsset(src, dest, "coin#test", "", "1.0")
+        .build();
+  };
+  std::vector<shared_model::proto::Transaction> txs{
+      transfer("alice@test", "bob@test"),
+      transfer("carol@test", "dave@test"),
+      transfer("bob@test", "alice@test"),
+      transfer("eve@test", "frank@test")};
+  auto proposal = TestProposalBuilder()
+                      .createdTime(iroha::time::now())
+                      .height(3)
+                      .transactions(txs)
+                      .build();
+
+  auto expect_apply = [&txs](iroha::ametsuchi::MockTemporaryWsv &wsv) {
+    EXPECT_CALL(wsv, apply(_, _))
+        .WillRepeatedly(Return(iroha::expected::Value<void>({})));
+    EXPECT_CALL(wsv, apply(Eq(ByRef(txs[1])), _))
+        .WillRepeatedly(Return(iroha::expected::Error<CommandError>({})));
+  };
+  expect_apply(*temp_wsv_mock);
+  auto temporary_factory =
+      std::make_shared<iroha::ametsuchi::MockTemporaryFactory>();
+  EXPECT_CALL(*temporary_factory, createTemporaryWsv())
+      .WillRepeatedly(Invoke([&expect_apply] {
+        auto wsv = std::make_unique<iroha::ametsuchi::MockTemporaryWsv>();
+        expect_apply(*wsv);
+        return iroha::expected::Result<
+            std::unique_ptr<iroha::ametsuchi::TemporaryWsv>,
+            std::string>(
+            iroha::expected::makeValue<
+                std::unique_ptr<iroha::ametsuchi::TemporaryWsv>>(
+                std::move(wsv)));
+      }));
+  sfv = std::make_shared<StatefulValidatorImpl>(
+      std::make_unique<shared_model::proto::ProtoProposalFactory<
+          shared_model::validation::DefaultProposalValidator>>(),
+      temporary_factory,
+      3);
+
+  auto verified_proposal_and_errors = sfv->validate(proposal, *temp_wsv_mock);
+  auto verified_txs = verified_proposal_and_errors.first->transactions();
+  ASSERT_EQ(verified_txs.size(), 3);
+  ASSERT_EQ(verified_txs[0], txs[0]);
+  ASSERT_EQ(verified_txs[1], txs[2]);
+  ASSERT_EQ(verified_txs[2], txs[3]);
+  ASSERT_EQ(verified_proposal_and_errors.second.size(), 1);
+  ASSERT_EQ(verified_proposal_and_errors.second[0].second, txs[1].hash());
+}
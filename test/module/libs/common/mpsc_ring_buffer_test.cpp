@@ -0,0 +1,83 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "common/mpsc_ring_buffer.hpp"
+
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using iroha::MpscRingBuffer;
+
+/**
+ * @given queue of capacity 3
+ * @when elements are pushed until the queue is full and then popped
+ * @then capacity is rounded to 4 and elements are popped in push order
+ */
+TEST(MpscRingBufferTest, FifoUpToCapacity) {
+  MpscRingBuffer<std::unique_ptr<int>> queue(3);
+  ASSERT_EQ(4, queue.capacity());
+
+  for (int i = 0; i < 4; ++i) {
+    ASSERT_TRUE(queue.tryPush(std::make_unique<int>(i)));
+  }
+  auto extra = std::make_unique<int>(4);
+  ASSERT_FALSE(queue.tryPush(std::move(extra)));
+  ASSERT_TRUE(extra);
+
+  std::unique_ptr<int> value;
+  for (int i = 0; i < 4; ++i) {
+    ASSERT_TRUE(queue.tryPop(value));
+    ASSERT_EQ(i, *value);
+  }
+  ASSERT_FALSE(queue.tryPop(value));
+
+  // cells are reused after wrap around
+  ASSERT_TRUE(queue.tryPush(std::move(extra)));
+  ASSERT_TRUE(queue.tryPop(value));
+  ASSERT_EQ(4, *value);
+}
+
+/**
+ * @given queue smaller than the number of elements
+ * @when several producers push concurrently while consumer pops
+ * @then every element is popped exactly once, in order of each producer
+ */
+TEST(MpscRingBufferTest, ConcurrentProducers) {
+  constexpr int kProducers = 4;
+  constexpr int kElements = 10000;
+  MpscRingBuffer<int> queue(64);
+
+  std::vector<std::thread> producers;
+  for (int p = 0; p < kProducers; ++p) {
+    producers.emplace_back([&queue, p] {
+      for (int i = 0; i < kElements; ++i) {
+        int value = p * kElements + i;
+        while (not queue.tryPush(std::move(value))) {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+
+  std::vector<int> last(kProducers, -1);
+  for (int popped = 0; popped < kProducers * kElements;) {
+    int value;
+    if (queue.tryPop(value)) {
+      auto producer = value / kElements;
+      ASSERT_LT(last[producer], value % kElements);
+      last[producer] = value % kElements;
+      ++popped;
+    }
+  }
+
+  for (auto &producer : producers) {
+    producer.join();
+  }
+  for (auto value : last) {
+    ASSERT_EQ(kElements - 1, value);
+  }
+}
@@ -0,0 +1,66 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "common/thread_pool.hpp"
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using iroha::ThreadPool;
+
+/**
+ * @given pool of 3 threads
+ * @when loops of different sizes are run
+ * @then function is called exactly once for each index
+ */
+TEST(ThreadPoolTest, EachIndexOnce) {
+  ThreadPool pool(3);
+  for (size_t count : {0, 1, 2, 1000}) {
+    std::vector<std::atomic<int>> calls(count);
+    for (auto &call : calls) {
+      call = 0;
+    }
+    pool.parallelFor(count, [&calls](size_t i) { ++calls[i]; });
+    for (auto &call : calls) {
+      ASSERT_EQ(1, call);
+    }
+  }
+}
+
+/**
+ * @given pool without threads
+ * @when loop is run
+ * @then it is done by the calling thread
+ */
+TEST(ThreadPoolTest, NoThreads) {
+  ThreadPool pool(0);
+  size_t sum = 0;
+  pool.parallelFor(10, [&sum](size_t i) { sum += i; });
+  ASSERT_EQ(45, sum);
+}
+
+/**
+ * @given pool of 2 threads
+ * @when function throws for some index
+ * @then the exception is rethrown by the calling thread
+ * @and the pool runs following loops
+ */
+TEST(ThreadPoolTest, ExceptionIsRethrown) {
+  ThreadPool pool(2);
+  ASSERT_THROW(pool.parallelFor(100,
+                                [](size_t i) {
+                                  if (i == 50) {
+                                    throw std::runtime_error("failed");
+                                  }
+                                }),
+               std::runtime_error);
+
+  std::atomic<size_t> calls{0};
+  pool.parallelFor(100, [&calls](size_t) { ++calls; });
+  ASSERT_EQ(100, calls);
+}
@@ -72,3 +72,88 @@ TEST_F(ProposalFactoryTest, InvalidProposalTest) {
       },
       [](const ErrorOf<decltype(proposal)> &) { SUCCEED(); });
 }
+
+/**
+ * @given transactions with known hashes
+ * @when proposal is created from them
+ * @then transactions of the proposal have the same hashes
+ */
+TEST_F(ProposalFactoryTest, TransactionHashesAreCarried) {
+  crypto::Hash known_hash(std::string(32, 'h'));
+  std::vector<proto::Transaction> txs;
+  txs.emplace_back(iroha::protocol::Transaction{}, known_hash);
+
+  auto proposal = valid_factory.unsafeCreateProposal(height, time, txs);
+
+  ASSERT_EQ(proposal->transactions().size(), 1);
+  EXPECT_EQ(proposal->transactions().front().hash(), known_hash);
+}
+
+/**
+ * @given proposal factory
+ * @when proposal is created from transactions or from a transport
+ * @then transport of the proposal is allocated in its arena
+ */
+TEST_F(ProposalFactoryTest, ProposalIsAllocatedInArena) {
+  auto is_in_arena = [](const interface::Proposal &proposal) {
+    const auto &proto_proposal = static_cast<const proto::Proposal &>(proposal);
+    return proto_proposal.getArena()
+        and proto_proposal.getTransport().GetArena()
+        == proto_proposal.getArena().get();
+  };
+
+  auto proposal = valid_factory.unsafeCreateProposal(height, time, txs);
+  EXPECT_TRUE(is_in_arena(*proposal));
+
+  auto copy = valid_factory.createProposal(
+      static_cast<const proto::Proposal &>(*proposal).getTransport());
+  copy.match(
+      [&](const ValueOf<decltype(copy)> &v) {
+        EXPECT_TRUE(is_in_arena(*v.value));
+        EXPECT_EQ(v.value->transactions(), proposal->transactions());
+      },
+      [](const ErrorOf<decltype(copy)> &e) { FAIL() << e.error; });
+}
+
+/**
+ * @given proposal allocated in an arena
+ * @when another proposal is made of its transactions
+ * @then the proposals share the arena and transports of the transactions
+ */
+TEST_F(ProposalFactoryTest, TransactionsAreSharedInArena) {
+  auto proposal = valid_factory.unsafeCreateProposal(height, time, txs);
+  auto verified = valid_factory.unsafeCreateProposal(
+      height, time, proposal->transactions());
+
+  const auto &proto_proposal = static_cast<const proto::Proposal &>(*proposal);
+  const auto &proto_verified = static_cast<const proto::Proposal &>(*verified);
+  EXPECT_EQ(proto_verified.getArena(), proto_proposal.getArena());
+  ASSERT_EQ(proto_verified.getTransport().transactions_size(), 1);
+  EXPECT_EQ(&proto_verified.getTransport().transactions(0),
+            &proto_proposal.getTransport().transactions(0));
+}
+
+/**
+ * @given proposal allocated in an arena
+ * @when a signature is added to its transaction and to a clone of it
+ * @then the transaction of the proposal and its transport are not changed
+ * @and the clone accepts the signature
+ */
+TEST_F(ProposalFactoryTest, SharedTransactionsAreReadOnly) {
+  auto proposal = valid_factory.unsafeCreateProposal(height, time, txs);
+  const auto &proto_proposal = static_cast<const proto::Proposal &>(*proposal);
+  auto tx = static_cast<const proto::Transaction &>(
+      *proto_proposal.transactions().begin());
+
+  crypto::Signed signed_blob(std::string(64, 's'));
+  crypto::PublicKey public_key(std::string(32, 'k'));
+  EXPECT_FALSE(tx.addSignature(signed_blob, public_key));
+  EXPECT_EQ(proto_proposal.getTransport().transactions(0).signatures_size(),
+            0);
+
+  auto copy = clone(tx);
+  EXPECT_TRUE(copy->addSignature(signed_blob, public_key));
+  EXPECT_EQ(boost::size(copy->signatures()), 1);
+  EXPECT_EQ(proto_proposal.getTransport().transactions(0).signatures_size(),
+            0);
+}
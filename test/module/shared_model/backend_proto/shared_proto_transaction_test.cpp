@@ -114,3 +114,23 @@ TEST(ProtoTransaction, BuilderWithInvalidTx) {
                    .build(),
                std::invalid_argument);
 }
+
+/**
+ * @given transaction created with a known hash
+ * @when it is copied and moved
+ * @then the copies have the same hash, which is not computed again
+ */
+TEST(ProtoTransaction, KnownHashIsCopied) {
+  shared_model::crypto::Hash known_hash(std::string(32, 'h'));
+  const shared_model::proto::Transaction tx(generateEmptyTransaction(),
+                                           known_hash);
+
+  shared_model::proto::Transaction copy(tx);
+  shared_model::proto::Transaction moved(std::move(copy));
+
+  EXPECT_EQ(tx.hash(), known_hash);
+  EXPECT_EQ(moved.hash(), known_hash);
+  EXPECT_NE(
+      shared_model::proto::Transaction(generateEmptyTransaction()).hash(),
+      known_hash);
+}
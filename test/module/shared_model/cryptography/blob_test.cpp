@@ -55,3 +55,21 @@ TEST_F(BlobMock, BlobIsString) {
     ASSERT_EQ(binary[i], bin_str[i]);
   }
 }
+
+/**
+ * @given blob, which hex was requested
+ * @when another blob is assigned to it, or it is copied and moved
+ * @then hex of every blob corresponds to its data
+ */
+TEST_F(BlobMock, HexFollowsAssignment) {
+  ASSERT_EQ("48656c6c6f2000576f726c64", blob->hex());
+
+  Blob copy(*blob);
+  Blob moved(std::move(copy));
+  ASSERT_EQ(blob->hex(), moved.hex());
+
+  *blob = Blob("\x01\xff"s);
+  ASSERT_EQ("01ff", blob->hex());
+  moved = std::move(*blob);
+  ASSERT_EQ("01ff", moved.hex());
+}
@@ -101,6 +101,23 @@ TEST_F(CryptoUsageTest, RawSignAndVerifyTest) {
   ASSERT_TRUE(verified);
 }
 
+/**
+ * @given data signed with a keypair
+ * @when signature is verified on bytes of the data, which are not in a blob
+ * @then signature is valid for the same bytes
+ * @and signature of a wrong size is rejected without an exception
+ */
+TEST_F(CryptoUsageTest, VerifyRawBytes) {
+  auto signed_blob = DefaultCryptoAlgorithmType::sign(data, keypair);
+  const auto &bytes = data.blob();
+  ASSERT_TRUE(CryptoVerifier<>::verify(
+      signed_blob, bytes.data(), bytes.size(), keypair.publicKey()));
+  ASSERT_FALSE(CryptoVerifier<>::verify(
+      signed_blob, bytes.data(), bytes.size() - 1, keypair.publicKey()));
+  ASSERT_FALSE(CryptoVerifier<>::verify(
+      Signed("short"), bytes.data(), bytes.size(), keypair.publicKey()));
+}
+
 /**
  * @given unsigned block
  * @when verify block
@@ -0,0 +1,176 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "validators/field_matchers.hpp"
+
+#include <functional>
+#include <random>
+#include <regex>
+
+#include <gtest/gtest.h>
+#include "validators/field_validator.hpp"
+
+namespace shared_model {
+  namespace validation {
+    class FieldMatchersTest;
+  }  // namespace validation
+}  // namespace shared_model
+
+using namespace shared_model::validation;
+
+/**
+ * Checks that a matcher accepts the same strings as the pattern it replaces.
+ * Strings are random mutations of valid samples, so that both sides of the
+ * patterns' boundaries are reached. The fixture is declared in the namespace
+ * of FieldValidator, which is its friend
+ */
+class shared_model::validation::FieldMatchersTest : public ::testing::Test {
+ public:
+  void checkEquivalence(const std::string &pattern,
+                        const std::function<bool(const std::string &)> &matcher,
+                        const std::function<std::string()> &sample) {
+    const std::regex regex(pattern);
+    for (size_t i = 0; i < kIterations; ++i) {
+      auto value = mutate(sample());
+      ASSERT_EQ(std::regex_match(value, regex), matcher(value))
+          << "value: '" << value << "', pattern: " << pattern;
+    }
+  }
+
+  std::string mutate(std::string value) {
+    auto mutations = uniform(0, 3);
+    for (size_t i = 0; i < mutations; ++i) {
+      auto pos = uniform(0, value.size());
+      switch (uniform(0, 3)) {
+        case 0:
+          value.insert(pos, 1, randomChar());
+          break;
+        case 1:
+          if (pos < value.size()) {
+            value.erase(pos, 1);
+          }
+          break;
+        case 2:
+          if (pos < value.size()) {
+            value[pos] = randomChar();
+          }
+          break;
+        default:
+          // valid samples are kept unchanged as well
+          break;
+      }
+    }
+    return value;
+  }
+
+  std::string name() {
+    return repeat(uniform(0, 34), "abcxyz_0189");
+  }
+
+  std::string label() {
+    return repeat(uniform(0, 65), "aZ-09");
+  }
+
+  std::string domain() {
+    auto result = label();
+    for (auto labels = uniform(0, 3); labels > 0; --labels) {
+      result += "." + label();
+    }
+    return result;
+  }
+
+  std::string number(size_t max) {
+    static const std::vector<size_t> boundaries{
+        0, 1, 9, 10, 99, 100, 199, 200, 249, 250, 255, 256, 999,
+        1000, 6553, 9999, 10000, 59999, 60000, 64999, 65000, 65499,
+        65500, 65529, 65530, 65535, 65536, 99999, 100000};
+    auto value = uniform(0, 1) ? boundaries[uniform(0, boundaries.size() - 1)]
+                               : uniform(0, max);
+    return (uniform(0, 9) == 0 ? "0" : "") + std::to_string(value);
+  }
+
+  std::string host() {
+    if (uniform(0, 1)) {
+      return domain();
+    }
+    return number(300) + "." + number(300) + "." + number(300) + "."
+        + number(300);
+  }
+
+  std::string repeat(size_t count, const std::string &alphabet) {
+    std::string result;
+    for (size_t i = 0; i < count; ++i) {
+      result += alphabet[uniform(0, alphabet.size() - 1)];
+    }
+    return result;
+  }
+
+  char randomChar() {
+    static const std::string alphabet = "aAzZ09_-.@#: \n\x80";
+    return alphabet[uniform(0, alphabet.size() - 1)];
+  }
+
+  size_t uniform(size_t from, size_t to) {
+    return std::uniform_int_distribution<size_t>(from, to)(engine_);
+  }
+
+  static constexpr size_t kIterations = 20000;
+
+  // private patterns of the validator, which the fixture is a friend of
+  const std::string &account_name_pattern =
+      FieldValidator::account_name_pattern_;
+  const std::string &asset_name_pattern = FieldValidator::asset_name_pattern_;
+  const std::string &role_id_pattern = FieldValidator::role_id_pattern_;
+  const std::string &domain_pattern = FieldValidator::domain_pattern_;
+  const std::string &account_id_pattern = FieldValidator::account_id_pattern_;
+  const std::string &asset_id_pattern = FieldValidator::asset_id_pattern_;
+  const std::string &peer_address_pattern =
+      FieldValidator::peer_address_pattern_;
+  const std::string &detail_key_pattern = FieldValidator::detail_key_pattern_;
+
+ private:
+  std::mt19937 engine_{42};
+};
+
+constexpr size_t FieldMatchersTest::kIterations;
+
+TEST_F(FieldMatchersTest, Names) {
+  checkEquivalence(account_name_pattern,
+                   matchers::accountName,
+                   [this] { return name(); });
+  checkEquivalence(asset_name_pattern,
+                   matchers::assetName,
+                   [this] { return name(); });
+  checkEquivalence(role_id_pattern,
+                   matchers::roleId,
+                   [this] { return name(); });
+}
+
+TEST_F(FieldMatchersTest, Domain) {
+  checkEquivalence(domain_pattern,
+                   matchers::domain,
+                   [this] { return domain(); });
+}
+
+TEST_F(FieldMatchersTest, AccountAndAssetIds) {
+  checkEquivalence(account_id_pattern,
+                   matchers::accountId,
+                   [this] { return name() + "@" + domain(); });
+  checkEquivalence(asset_id_pattern,
+                   matchers::assetId,
+                   [this] { return name() + "#" + domain(); });
+}
+
+TEST_F(FieldMatchersTest, PeerAddress) {
+  checkEquivalence(peer_address_pattern,
+                   matchers::peerAddress,
+                   [this] { return host() + ":" + number(70000); });
+}
+
+TEST_F(FieldMatchersTest, DetailKey) {
+  checkEquivalence(detail_key_pattern,
+                   matchers::detailKey,
+                   [this] { return repeat(uniform(0, 66), "aZ09_"); });
+}
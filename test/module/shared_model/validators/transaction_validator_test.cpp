@@ -22,7 +22,10 @@
 
 #include <type_traits>
 #include "builders/protobuf/transaction.hpp"
+#include "cryptography/crypto_provider/crypto_defaults.hpp"
+#include "module/shared_model/builders/protobuf/test_proposal_builder.hpp"
 #include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+#include "validators/default_validator.hpp"
 
 using namespace shared_model;
 
@@ -190,3 +193,106 @@ TEST_F(TransactionValidatorTest, BatchValidTest) {
             static_cast<int>(interface::types::BatchType::ATOMIC));
 }
 
+/**
+ * @given signed transaction, which passed validation
+ * @when its payload is changed and the transaction is validated again
+ * @then the signature is rejected
+ * @and the original transaction is still valid
+ */
+TEST_F(TransactionValidatorTest, SignatureVerdictIsBoundToPayload) {
+  auto keypair = crypto::DefaultCryptoAlgorithmType::generateKeypair();
+  auto tx = TestUnsignedTransactionBuilder()
+                .creatorAccountId("admin@test")
+                .createdTime(created_time)
+                .quorum(1)
+                .createDomain("test", "test")
+                .build()
+                .signAndAddSignature(keypair)
+                .finish();
+  shared_model::validation::DefaultSignedTransactionValidator validator;
+  ASSERT_FALSE(validator.validate(tx).hasErrors());
+
+  auto changed = tx.getTransport();
+  changed.mutable_payload()->mutable_reduced_payload()->set_created_time(
+      created_time + 1);
+  auto answer = validator.validate(proto::Transaction(std::move(changed)));
+  ASSERT_EQ(answer.getReasonsMap().count("Signature"), 1);
+
+  ASSERT_FALSE(validator.validate(tx).hasErrors());
+}
+
+/**
+ * @given transaction signed by several keys, one of which signed other data
+ * @when the transaction is validated
+ * @then only the signature of other data is rejected
+ */
+TEST_F(TransactionValidatorTest, SeveralSignaturesAreVerified) {
+  auto unsigned_tx = TestUnsignedTransactionBuilder()
+                         .creatorAccountId("admin@test")
+                         .createdTime(created_time)
+                         .quorum(1)
+                         .createDomain("test", "test")
+                         .build();
+  for (size_t i = 0; i < 8; ++i) {
+    unsigned_tx.signAndAddSignature(
+        crypto::DefaultCryptoAlgorithmType::generateKeypair());
+  }
+  auto transport = unsigned_tx.finish().getTransport();
+  auto wrong = crypto::DefaultCryptoAlgorithmType::generateKeypair();
+  auto signature = transport.add_signatures();
+  signature->set_pubkey(crypto::toBinaryString(wrong.publicKey()));
+  signature->set_signature(crypto::toBinaryString(
+      crypto::CryptoSigner<>::sign(crypto::Blob("other data"), wrong)));
+
+  shared_model::validation::DefaultSignedTransactionValidator validator;
+  auto reasons = validator.validate(proto::Transaction(std::move(transport)))
+                     .getReasonsMap();
+  ASSERT_EQ(reasons.count("Signature"), 1);
+  ASSERT_EQ(reasons["Signature"].size(), 1);
+  ASSERT_NE(reasons["Signature"][0].find(wrong.publicKey().hex()),
+            std::string::npos);
+}
+
+/**
+ * @given proposal with several transactions with invalid commands
+ * @when the proposal is validated several times
+ * @then reasons of every transaction are the ones of the transaction alone,
+ * with commands numbered from zero, in order of the transactions, and they are
+ * the same every time
+ */
+TEST_F(TransactionValidatorTest, ReasonsOfProposalAreDeterministic) {
+  std::vector<proto::Transaction> txs;
+  for (size_t i = 0; i < 8; ++i) {
+    txs.push_back(TestTransactionBuilder()
+                      .creatorAccountId("admin@test")
+                      .createdTime(created_time + i)
+                      .quorum(1)
+                      .addAssetQuantity("invalid asset", "1.0")
+                      .transferAsset(
+                          "admin@test", "admin@test", "coin#test", "", "1.0")
+                      .build());
+  }
+  auto proposal = TestProposalBuilder()
+                      .height(2)
+                      .createdTime(created_time)
+                      .transactions(txs)
+                      .build();
+
+  shared_model::validation::DefaultProposalValidator validator;
+  auto reason = validator.validate(proposal).reason();
+  size_t position = 0;
+  for (const auto &tx : txs) {
+    auto tx_reason = transaction_validator.validate(tx).reason();
+    ASSERT_NE(tx_reason.find("0 AddAssetQuantity"), std::string::npos);
+    ASSERT_NE(tx_reason.find("1 TransferAsset"), std::string::npos);
+    auto found = reason.find(
+        (boost::format("Tx %s : %s") % tx.hash().hex() % tx_reason).str(),
+        position);
+    ASSERT_NE(found, std::string::npos) << reason;
+    position = found + 1;
+  }
+
+  for (size_t i = 0; i < 10; ++i) {
+    ASSERT_EQ(validator.validate(proposal).reason(), reason);
+  }
+}